@@ -14,6 +14,62 @@
 #include "affichage.h"
 #include <stdio.h>
 #include "bouton.h"
+#include "ecrans.h"
+#include "scores.h"
+#include "stm32g4_dlog.h"
+
+/**
+ * @brief Dessine la partie statique d'un écran primitive par primitive (cf. ecrans.c).
+ *
+ * @param ecran La description de l'écran.
+ */
+static void dessiner_ecran(const description_ecran_t *ecran) {
+    for (int i = 0; i < ecran->nb_operations; i++) {
+        const operation_ecran_t *op = &ecran->operations[i];
+
+        switch (op->type) {
+        case OPERATION_REMPLIR:
+            ILI9341_Fill(op->couleur);
+            break;
+        case OPERATION_RECTANGLE:
+            ILI9341_DrawRectangle(op->x0, op->y0, op->x1, op->y1, op->couleur);
+            break;
+        case OPERATION_RECTANGLE_PLEIN:
+            ILI9341_DrawFilledRectangle(op->x0, op->y0, op->x1, op->y1, op->couleur);
+            break;
+        case OPERATION_TEXTE:
+            ILI9341_Puts(op->x0, op->y0, op->texte, op->police, op->couleur, op->fond);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Affiche la partie statique d'un écran fixe.
+ *
+ * Avec USE_ECRANS_PRECALCULES, l'image générée par tools/ecrans_gen.c est envoyée en un seul
+ * transfert, au lieu de plusieurs remplissages et de milliers de pixels de texte envoyés un par un.
+ * Si les images ne correspondent plus aux descriptions (ecrans.c modifié sans régénérer
+ * ecrans_images.c), l'écran est dessiné primitive par primitive.
+ *
+ * @param ecran L'écran à afficher.
+ */
+static void afficher_ecran(ecran_t ecran) {
+#if USE_ECRANS_PRECALCULES
+    static int8_t images_a_jour = -1; /**< -1 tant que l'empreinte n'a pas été vérifiée. */
+
+    if (images_a_jour < 0) {
+        images_a_jour = (empreinte_ecrans() == empreinte_images_ecrans);
+        if (!images_a_jour)
+            DLOG("ecrans_images.c perime : regenerer avec tools/ecrans_gen.c\n");
+    }
+    if (images_a_jour) {
+        ILI9341_putImage_rle(0, 0, &images_ecrans[ecran]);
+        return;
+    }
+#endif
+    dessiner_ecran(&descriptions_ecrans[ecran]);
+}
 
 /**
  * @brief Affiche la somme totale d'argent restante.
@@ -44,14 +100,10 @@ void afficher_argent_trappes(void) {
  * @param argent_restant La somme d'argent restante.
  */
 void afficher_argent_restant(int argent_restant) {
-    ILI9341_Fill(ILI9341_COLOR_CYAN);
-    ILI9341_DrawRectangle(20, 50, 300, 150, ILI9341_COLOR_BLACK);
-    ILI9341_DrawFilledRectangle(21, 51, 299, 149, ILI9341_COLOR_WHITE);
-    ILI9341_Puts(50, 60, "Argent restant", &Font_16x26, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
+    afficher_ecran(ECRAN_ARGENT_RESTANT);
     char argent_str[20];
     sprintf(argent_str, "%d$", argent_restant);
     ILI9341_Puts(100, 100, argent_str, &Font_16x26, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE);
-    ILI9341_Puts(20, 160, "Bonne chance pour la suite", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
 }
 
 /**
@@ -59,12 +111,12 @@ void afficher_argent_restant(int argent_restant) {
  *
  * @param q La question à afficher.
  */
-void afficher_question(Question q) {
+void afficher_question(const Question *q) {
     ILI9341_Fill(ILI9341_COLOR_BLUE);
     char numero_str[20];
-    sprintf(numero_str, "Question %d/10", numero_question);
+    sprintf(numero_str, "Question %d/%d", numero_question, QUESTIONS_PAR_PARTIE);
     ILI9341_Puts(10, 10, numero_str, &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE);
-    ILI9341_Puts(10, 40, q.question, &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE);
+    ILI9341_Puts(10, 40, q->question, &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE);
     afficher_argent_total();
 }
 
@@ -73,34 +125,59 @@ void afficher_question(Question q) {
  *
  * @param q La question contenant les réponses à afficher.
  */
-void afficher_reponses(Question q) {
-    ILI9341_Puts(10, 100, q.reponses[0], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
-    ILI9341_Puts(113, 100, q.reponses[1], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
-    ILI9341_Puts(216, 100, q.reponses[2], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
+void afficher_reponses(const Question *q) {
+    ILI9341_Puts(10, 100, q->reponses[0], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
+    ILI9341_Puts(113, 100, q->reponses[1], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
+    ILI9341_Puts(216, 100, q->reponses[2], &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE);
 
     switch (etat_trappe) {
     case TRAPPE1:
-        ILI9341_Puts(10, 100, q.reponses[0], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
+        ILI9341_Puts(10, 100, q->reponses[0], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
         break;
     case TRAPPE2:
-        ILI9341_Puts(113, 100, q.reponses[1], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
+        ILI9341_Puts(113, 100, q->reponses[1], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
         break;
     case TRAPPE3:
-        ILI9341_Puts(216, 100, q.reponses[2], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
+        ILI9341_Puts(216, 100, q->reponses[2], &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
         break;
     }
 }
 
+#define BARRE_X 10 /**< Coordonnée X du début de la barre du compte à rebours. */
+#define BARRE_Y 228 /**< Coordonnée Y du haut de la barre. */
+#define BARRE_LARGEUR 300 /**< Largeur de la barre pleine. */
+#define BARRE_HAUTEUR 8 /**< Hauteur de la barre. */
+
+/**
+ * @brief Affiche la barre du compte à rebours, sous l'écran de la question.
+ *
+ * La barre raccourcit par la droite. Redessiner toute la barre à chaque exécution de la
+ * machine à états coûterait un transfert de 300 x 8 pixels toutes les 10 ms ; seule la
+ * tranche perdue depuis l'appel précédent est effacée (le plus souvent rien, parfois une colonne).
+ *
+ * @param restant_ms Temps restant.
+ * @param duree_ms Durée totale du compte à rebours.
+ */
+void afficher_compte_a_rebours(uint32_t restant_ms, uint32_t duree_ms) {
+    static uint16_t largeur_affichee = 0; /**< Largeur de la barre actuellement à l'écran. */
+    uint16_t largeur = (uint16_t)(((uint64_t)restant_ms * BARRE_LARGEUR + duree_ms - 1) / duree_ms);
+
+    if (restant_ms >= duree_ms) {
+        largeur_affichee = BARRE_LARGEUR;
+        ILI9341_DrawFilledRectangle(BARRE_X, BARRE_Y, BARRE_X + BARRE_LARGEUR - 1, BARRE_Y + BARRE_HAUTEUR - 1,
+                                    ILI9341_COLOR_YELLOW);
+    } else if (largeur < largeur_affichee) {
+        ILI9341_DrawFilledRectangle(BARRE_X + largeur, BARRE_Y, BARRE_X + largeur_affichee - 1,
+                                    BARRE_Y + BARRE_HAUTEUR - 1, ILI9341_COLOR_BLUE);
+        largeur_affichee = largeur;
+    }
+}
+
 /**
  * @brief Affiche l'écran "PERDU" lorsque le joueur perd la partie.
  */
 void afficher_ecran_perdu(void) {
-    ILI9341_Fill(ILI9341_COLOR_RED);
-    ILI9341_DrawRectangle(20, 50, 300, 200, ILI9341_COLOR_WHITE);
-    ILI9341_DrawFilledRectangle(21, 51, 299, 199, ILI9341_COLOR_BLACK);
-    ILI9341_Puts(45, 70, "Vous avez perdu", &Font_16x26, ILI9341_COLOR_RED, ILI9341_COLOR_BLACK);
-    ILI9341_Puts(40, 120, "Plus d'argent restant.", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
-    ILI9341_Puts(37, 170, "Reessayez pour gagner !", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
+    afficher_ecran(ECRAN_PERDU);
 }
 
 /**
@@ -109,45 +186,32 @@ void afficher_ecran_perdu(void) {
  * @param argent_total La somme totale d'argent restante.
  */
 void afficher_ecran_fin(int argent_total) {
-    ILI9341_Fill(ILI9341_COLOR_GREEN);
-    ILI9341_DrawRectangle(20, 50, 300, 200, ILI9341_COLOR_BLACK);
-    ILI9341_DrawFilledRectangle(21, 51, 299, 199, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(55, 70, "Fin du jeu !", &Font_16x26, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(50, 120, "Merci d'avoir joue.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
+    afficher_ecran(ECRAN_FIN);
     char argent_final_str[20];
     sprintf(argent_final_str, "Total: %d$", argent_total);
     ILI9341_Puts(50, 160, argent_final_str, &Font_16x26, ILI9341_COLOR_YELLOW, ILI9341_COLOR_CYAN);
 }
 
 /**
- * @brief Affiche l'écran de début du jeu.
+ * @brief Affiche l'écran de début du jeu, avec le meilleur score s'il y en a un.
  */
 void afficher_ecran_debut(void) {
-    ILI9341_Init();
-    ILI9341_Rotate(ILI9341_Orientation_Landscape_2);
-    ILI9341_Fill(ILI9341_COLOR_BLUE);
-    ILI9341_DrawRectangle(20, 30, 300, 100, ILI9341_COLOR_WHITE);
-    ILI9341_DrawFilledRectangle(21, 31, 299, 99, ILI9341_COLOR_BLACK);
-    ILI9341_Puts(80, 50, "Money Drop", &Font_16x26, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK);
-    ILI9341_Puts(40, 140, "Appuyez sur un bouton", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE);
-    ILI9341_Puts(80, 160, "pour commencer", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE);
-    ILI9341_Puts(80, 200, "Bonne chance !", &Font_11x18, ILI9341_COLOR_YELLOW, ILI9341_COLOR_BLUE);
+    afficher_ecran(ECRAN_DEBUT);
+#if USE_SCORES
+    const scores_t *scores = scores_obtenir();
+    if (scores->nb_meilleurs > 0 && scores->meilleurs[0] > 0) {
+        char record_str[24];
+        sprintf(record_str, "Record : %lu$", (unsigned long)scores->meilleurs[0]);
+        ILI9341_Puts(80, 110, record_str, &Font_11x18, ILI9341_COLOR_YELLOW, ILI9341_COLOR_BLUE);
+    }
+#endif
 }
 
 /**
  * @brief Affiche l'écran des règles du jeu.
  */
 void afficher_ecran_regles(void) {
-    ILI9341_Fill(ILI9341_COLOR_CYAN);
-    ILI9341_Puts(50, 10, "Regles du jeu", &Font_16x26, ILI9341_COLOR_WHITE, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(37, 50, "Vous avez 20 liasses de", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(70, 70, "billets au debut.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(37, 100, "Repartissez les billets", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(70, 120, "sur les trappes.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(50, 150, "Chaque manche, les", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(13, 170, "mauvaises trappes tombent !", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(30, 200, "Conservez un maximum de", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
-    ILI9341_Puts(110, 220, "billets !", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN);
+    afficher_ecran(ECRAN_REGLES);
 }
 
 /**
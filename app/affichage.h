@@ -40,14 +40,25 @@ void afficher_argent_restant(int argent_restant);
  *
  * @param q La question à afficher.
  */
-void afficher_question(Question q);
+void afficher_question(const Question *q);
 
 /**
  * @brief Affiche les réponses possibles pour la question actuelle.
  *
  * @param q La question contenant les réponses à afficher.
  */
-void afficher_reponses(Question q);
+void afficher_reponses(const Question *q);
+
+/**
+ * @brief Affiche la barre du compte à rebours, sous l'écran de la question.
+ *
+ * Appelée avec restant_ms == duree_ms, dessine la barre entière ; ensuite, seule
+ * la tranche perdue depuis l'appel précédent est effacée.
+ *
+ * @param restant_ms Temps restant.
+ * @param duree_ms Durée totale du compte à rebours.
+ */
+void afficher_compte_a_rebours(uint32_t restant_ms, uint32_t duree_ms);
 
 /**
  * @brief Affiche l'écran "PERDU" lorsque le joueur perd la partie.
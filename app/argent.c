@@ -11,6 +11,7 @@
  */
 
 #include "argent.h"
+#include "tft_ili9341/stm32g4_ili9341_anim.h"
 
 /**
  * @brief Somme d'argent actuellement placée sur les trappes.
@@ -41,17 +42,69 @@ int tout_argent_place(void) {
     return argent_total == 0;
 }
 
+#if USE_ILI9341_ANIM
+#define TRAPPE_Y 90           /**< Haut des trappes. */
+#define TRAPPE_LARGEUR 94     /**< Largeur d'une trappe (battants gauche et droit). */
+#define TRAPPE_HAUTEUR 41     /**< Hauteur d'une trappe. */
+#define OUVERTURE_MS 600      /**< Durée de l'ouverture des battants. */
+#define CHUTE_MS 800          /**< Durée de la chute de l'argent, une fois les battants ouverts. */
+#define COULEUR_BATTANT ILI9341_COLOR_BROWN
+#define COULEUR_LIASSE ILI9341_COLOR_GREEN
+
+static ILI9341_anim_key_t cles_battants[3][2][2]; /**< Images clés des battants gauche et droit de chaque trappe. */
+static ILI9341_anim_key_t cles_liasses[3][3];     /**< Images clés de la liasse de chaque trappe. */
+static ILI9341_anim_sprite_t battants[3][2];
+static ILI9341_anim_sprite_t liasses[3];
+
+/**
+ * @brief Ouvrir une mauvaise trappe : les battants s'écartent, puis l'argent tombe dans le vide.
+ *
+ * La scène de départ est dessinée une fois (battants pleins, liasse à la place de la somme) ;
+ * ensuite le moteur d'animation ne redessine que les bandes qui changent.
+ */
+static void ouvrir_trappe(int i) {
+    int16_t x = 10 + (i * 103);
+    int16_t demi = TRAPPE_LARGEUR / 2;
+    ILI9341_anim_rect_t liasse = {x + 15, 142, 64, 30};
+
+    // Battants : le gauche se replie vers la gauche, le droit vers la droite
+    ILI9341_DrawFilledRectangle(x, TRAPPE_Y, x + TRAPPE_LARGEUR - 1, TRAPPE_Y + TRAPPE_HAUTEUR - 1, COULEUR_BATTANT);
+    cles_battants[i][0][0] = (ILI9341_anim_key_t){0, ILI9341_ANIM_LINEAR, {x, TRAPPE_Y, demi, TRAPPE_HAUTEUR}};
+    cles_battants[i][0][1] = (ILI9341_anim_key_t){OUVERTURE_MS, ILI9341_ANIM_EASE_IN, {x, TRAPPE_Y, 0, TRAPPE_HAUTEUR}};
+    cles_battants[i][1][0] = (ILI9341_anim_key_t){0, ILI9341_ANIM_LINEAR,
+                                                  {x + demi, TRAPPE_Y, TRAPPE_LARGEUR - demi, TRAPPE_HAUTEUR}};
+    cles_battants[i][1][1] = (ILI9341_anim_key_t){OUVERTURE_MS, ILI9341_ANIM_EASE_IN,
+                                                  {x + TRAPPE_LARGEUR, TRAPPE_Y, 0, TRAPPE_HAUTEUR}};
+    for (int b = 0; b < 2; b++) {
+        ILI9341_ANIM_start(&battants[i][b], cles_battants[i][b], 2, COULEUR_BATTANT, ILI9341_COLOR_BLACK);
+    }
+
+    // Liasse : immobile pendant l'ouverture, puis chute hors de l'écran
+    if (argent_trappes[i] > 0) {
+        ILI9341_DrawFilledRectangle(x, 140, x + 102, 180, ILI9341_COLOR_BLUE);
+        ILI9341_DrawFilledRectangle(liasse.x, liasse.y, liasse.x + liasse.width - 1, liasse.y + liasse.height - 1,
+                                    COULEUR_LIASSE);
+        cles_liasses[i][0] = (ILI9341_anim_key_t){0, ILI9341_ANIM_LINEAR, liasse};
+        cles_liasses[i][1] = (ILI9341_anim_key_t){OUVERTURE_MS, ILI9341_ANIM_LINEAR, liasse};
+        liasse.y = 240;
+        cles_liasses[i][2] = (ILI9341_anim_key_t){OUVERTURE_MS + CHUTE_MS, ILI9341_ANIM_EASE_IN, liasse};
+        ILI9341_ANIM_start(&liasses[i], cles_liasses[i], 3, COULEUR_LIASSE, ILI9341_COLOR_BLUE);
+    }
+}
+#endif
+
 /**
  * @brief Valide les réponses pour une question donnée.
  *
  * Cette fonction compare les réponses placées sur les trappes avec la bonne réponse
- * pour une question donnée. Elle met à jour l'affichage des trappes en colorant
- * la bonne trappe en vert et les autres en noir.
+ * pour une question donnée. La bonne trappe est colorée en vert ; les autres s'ouvrent
+ * et l'argent qu'elles portent tombe (animation, USE_ILI9341_ANIM), ou sont colorées
+ * en noir sans le moteur d'animation.
  *
  * @param q La question actuelle.
  */
-void valider_reponses(Question q) {
-    int bonne_trappe = q.bonne_reponse;
+void valider_reponses(const Question *q) {
+    int bonne_trappe = q->bonne_reponse;
 
     for (int i = 0; i < 3; i++) {
         int x_debut = 10 + (i * 103); /**< Coordonnée X de début pour la trappe. */
@@ -60,7 +113,11 @@ void valider_reponses(Question q) {
         if (i == bonne_trappe) {
             ILI9341_DrawFilledRectangle(x_debut, 90, x_fin, 130, ILI9341_COLOR_GREEN); /**< Colorer la bonne trappe en vert. */
         } else {
+#if USE_ILI9341_ANIM
+            ouvrir_trappe(i); /**< Ouvrir les autres trappes. */
+#else
             ILI9341_DrawFilledRectangle(x_debut, 90, x_fin, 130, ILI9341_COLOR_BLACK); /**< Colorer les autres trappes en noir. */
+#endif
         }
     }
 }
@@ -74,6 +131,6 @@ void valider_reponses(Question q) {
  * @param q La question actuelle.
  * @return La somme d'argent restante sur la bonne trappe.
  */
-int calculer_argent_restant(Question q) {
-    return argent_trappes[q.bonne_reponse];
+int calculer_argent_restant(const Question *q) {
+    return argent_trappes[q->bonne_reponse];
 }
@@ -50,7 +50,7 @@ int tout_argent_place(void);
  *
  * @param q La question actuelle.
  */
-void valider_reponses(Question q);
+void valider_reponses(const Question *q);
 
 /**
  * @brief Calcule l'argent restant après validation des réponses.
@@ -61,6 +61,6 @@ void valider_reponses(Question q);
  * @param q La question actuelle.
  * @return La somme d'argent restante.
  */
-int calculer_argent_restant(Question q);
+int calculer_argent_restant(const Question *q);
 
 #endif /* ARGENT_H_ */
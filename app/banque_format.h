@@ -0,0 +1,75 @@
+/**
+ * @file banque_format.h
+ * @brief Format du fichier de banque de questions (carte SD).
+ *
+ * Fichier partagé par le jeu (banque_sd.c) et les outils PC (tools/banque_csv.c,
+ * tools/banque_bench.c) : il ne dépend que de la bibliothèque C.
+ *
+ * Organisation du fichier (entiers en little-endian) :
+ * - secteur 0 : en-tête (entete_banque_t), complété par des zéros ;
+ * - à partir du secteur 1 : index (entree_banque_t, 8 octets par question), complété
+ *   par des zéros jusqu'à la fin de son dernier secteur ;
+ * - à partir de debut_textes : les enregistrements, bout à bout.
+ *
+ * Les questions sont rangées par difficulté puis par catégorie : les questions
+ * d'une pile (difficulté, catégorie) se suivent, piles[] donne le début de chacune.
+ *
+ * Un enregistrement : index de la bonne réponse (1 octet, 0 à 2), puis la question et
+ * les trois réponses, chacune terminée par un '\0'.
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#ifndef BANQUE_FORMAT_H_
+#define BANQUE_FORMAT_H_
+
+#include <stdint.h>
+
+#define BANQUE_SIGNATURE          "QBNK"
+#define BANQUE_VERSION            1
+#define BANQUE_SECTEUR            512 /**< Taille d'un secteur de la carte SD. */
+#define BANQUE_DEBUT_INDEX        BANQUE_SECTEUR
+#define BANQUE_ENREGISTREMENT_MAX 256 /**< Taille maximale d'un enregistrement, '\0' compris. */
+
+#define BANQUE_DIFFICULTES 3 /**< Difficultés (difficulte_t de question.h). */
+#define BANQUE_CATEGORIES  6 /**< Catégories (categorie_t de question.h). */
+#define BANQUE_PILES       (BANQUE_DIFFICULTES * BANQUE_CATEGORIES)
+
+/**
+ * @brief Encodage des textes.
+ */
+typedef enum {
+    BANQUE_LATIN1 = 0, /**< ISO 8859-1 : un octet par caractère. */
+    BANQUE_UTF8        /**< UTF-8. */
+} encodage_banque_t;
+
+/**
+ * @brief En-tête du fichier (secteur 0).
+ */
+typedef struct {
+    char signature[4];             /**< BANQUE_SIGNATURE, sans '\0'. */
+    uint16_t version;              /**< BANQUE_VERSION. */
+    uint8_t encodage;              /**< encodage_banque_t. */
+    uint8_t nb_difficultes;        /**< BANQUE_DIFFICULTES. */
+    uint8_t nb_categories;         /**< BANQUE_CATEGORIES. */
+    uint8_t reserve[3];
+    uint32_t nombre;               /**< Nombre de questions. */
+    uint32_t debut_textes;         /**< Position du premier enregistrement (début de secteur). */
+    uint32_t piles[BANQUE_PILES + 1]; /**< Première question de chaque pile (difficulté * BANQUE_CATEGORIES + catégorie), puis nombre. */
+} entete_banque_t;
+
+/**
+ * @brief Entrée de l'index : une par question.
+ */
+typedef struct {
+    uint32_t position;  /**< Position de l'enregistrement dans le fichier. */
+    uint16_t longueur;  /**< Longueur de l'enregistrement (au plus BANQUE_ENREGISTREMENT_MAX). */
+    uint8_t categorie;  /**< categorie_t. */
+    uint8_t difficulte; /**< difficulte_t. */
+} entree_banque_t;
+
+_Static_assert(sizeof(entete_banque_t) == 96, "entete_banque_t : format du fichier modifié");
+_Static_assert(sizeof(entree_banque_t) == 8, "entree_banque_t : format du fichier modifié");
+
+#endif /* BANQUE_FORMAT_H_ */
@@ -0,0 +1,338 @@
+/**
+ * @file banque_sd.c
+ * @brief Banque de questions sur carte SD.
+ *
+ * Le fichier (format décrit dans banque_format.h) n'est jamais chargé en entier :
+ * - à l'ouverture, l'en-tête, puis l'index en une seule lecture de plusieurs secteurs
+ *   (CMD18) s'il tient dans BANQUE_SD_INDEX_MAX entrées ; au-delà, chaque entrée est lue
+ *   à la demande ;
+ * - à chaque tirage, seul l'enregistrement de la question est lu (256 octets au plus) ;
+ * - la question suivante est tirée et lue à l'avance, pendant que le joueur réfléchit
+ *   (banque_sd_prechargement(), appelée par l'ordonnanceur quand il n'a rien à faire) :
+ *   deux tampons, celui de la question affichée et celui de la question préchargée.
+ *
+ * La table des fragments du fichier (recherche rapide de FatFs, _USE_FASTSEEK) évite de
+ * parcourir la FAT à chaque déplacement dans le fichier.
+ * L'écran n'a que des caractères ASCII : les lettres accentuées sont remplacées par
+ * leur lettre de base au chargement.
+ *
+ * Mesure sur la cible : zone BANQUE_SD_CHARGER de stm32g4_prof.h (USE_PROF) ;
+ * estimation sur PC : tools/banque_bench.c.
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#include "banque_sd.h"
+
+#if USE_BANQUE_SD
+#if !USE_SD_CARD
+#error "USE_BANQUE_SD nécessite USE_SD_CARD"
+#endif
+
+#include "banque_format.h"
+#include "stm32g4_prof.h"
+#include "SD/stm32g4_sd.h"
+#include "SD/FatFs/src/ff.h"
+#include "SD/FatFs/src/ff_gen_drv.h"
+#include "SD/FatFs/src/drivers/sd_diskio.h"
+#include <string.h>
+
+#define BANQUE_SD_FRAGMENTS 16 /**< Fragments du fichier connus de la recherche rapide. */
+
+_Static_assert(BANQUE_DIFFICULTES == DIFFICULTE_NB && BANQUE_CATEGORIES == CATEGORIE_NB,
+               "banque_format.h ne correspond plus à question.h");
+_Static_assert((BANQUE_SD_INDEX_MAX * sizeof(entree_banque_t)) % BANQUE_SECTEUR == 0,
+               "BANQUE_SD_INDEX_MAX : l'index en RAM doit occuper des secteurs entiers");
+
+/**
+ * @brief Question chargée : les textes pointent dans son propre tampon.
+ */
+typedef struct {
+    Question question;
+    char enregistrement[BANQUE_ENREGISTREMENT_MAX];
+} question_chargee_t;
+
+static FATFS systeme_fichiers;
+static FIL fichier;
+static char lecteur[4];                                /**< Lecteur FatFs de la carte ("0:/"). */
+static DWORD fragments[2 * BANQUE_SD_FRAGMENTS + 1];    /**< Table de la recherche rapide. */
+static entete_banque_t entete;
+static entree_banque_t index_ram[BANQUE_SD_INDEX_MAX];
+static bool index_en_ram;
+static bool ouverte = false;
+
+static question_chargee_t tampons[2]; /**< Question affichée et question préchargée. */
+static uint8_t affichee;              /**< Tampon de la question affichée. */
+static bool prechargee;               /**< La question suivante est dans tampons[affichee ^ 1]. */
+
+static uint32_t tirees[QUESTIONS_PAR_PARTIE]; /**< Questions de la partie en cours. */
+static uint8_t nb_tirees;
+static uint8_t tirees_par_pile[NB_PILES];
+
+/**
+ * @brief Lettre de base des caractères Latin-1 0xC0 à 0xFF.
+ */
+static const char lettres_de_base[64] = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYTs"
+                                        "aaaaaaaceeeeiiiidnooooo/ouuuuyty";
+
+/**
+ * @brief Lire une partie du fichier.
+ */
+static bool lire(uint32_t position, void *destination, uint32_t taille) {
+    UINT lus;
+
+    return f_lseek(&fichier, position) == FR_OK && f_read(&fichier, destination, taille, &lus) == FR_OK && lus == taille;
+}
+
+/**
+ * @brief Lire l'entrée d'index d'une question (en RAM, ou sur la carte pour les grandes banques).
+ */
+static bool lire_entree(uint32_t question, entree_banque_t *entree) {
+    if (index_en_ram) {
+        *entree = index_ram[question];
+        return true;
+    }
+    return lire(BANQUE_DEBUT_INDEX + question * sizeof(entree_banque_t), entree, sizeof(entree_banque_t));
+}
+
+/**
+ * @brief Caractère ASCII affichable le plus proche d'un point de code Unicode.
+ */
+static char vers_ascii(uint32_t code) {
+    if (code < 0x80) {
+        return (char)code;
+    }
+    if (code >= 0xC0 && code <= 0xFF) {
+        return lettres_de_base[code - 0xC0];
+    }
+    switch (code) {
+    case 0xA0:   // Espace insécable
+        return ' ';
+    case 0xAB:   // Guillemets
+    case 0xBB:
+    case 0x201C:
+    case 0x201D:
+        return '"';
+    case 0x2018: // Apostrophes typographiques
+    case 0x2019:
+        return '\'';
+    case 0x2013: // Tirets
+    case 0x2014:
+        return '-';
+    default:
+        return '?';
+    }
+}
+
+/**
+ * @brief Remplacer, sur place, les caractères que l'écran ne sait pas afficher.
+ *
+ * @param texte Chaîne terminée par '\0' (le résultat n'est jamais plus long).
+ * @param encodage Encodage du fichier (encodage_banque_t).
+ */
+static void replier_en_ascii(char *texte, uint8_t encodage) {
+    const uint8_t *lu = (const uint8_t *)texte;
+    char *ecrit = texte;
+
+    while (*lu) {
+        uint32_t code = *lu++;
+        if (encodage == BANQUE_UTF8 && code >= 0xC0) {
+            int suite = (code >= 0xF0) ? 3 : (code >= 0xE0) ? 2 : 1;
+            code &= 0x3F >> suite;
+            while (suite-- && (*lu & 0xC0) == 0x80) {
+                code = (code << 6) | (*lu++ & 0x3F);
+            }
+        }
+        *ecrit++ = vers_ascii(code);
+    }
+    *ecrit = '\0';
+}
+
+/**
+ * @brief Lire et découper l'enregistrement d'une question.
+ */
+static bool charger(uint32_t question, question_chargee_t *destination) {
+    entree_banque_t entree;
+    char *champs[4];
+    char *texte;
+    char *fin;
+    bool ok = false;
+
+    PROF_ZONE_BEGIN(BANQUE_SD_CHARGER);
+    if (lire_entree(question, &entree) && entree.longueur > 4 && entree.longueur <= BANQUE_ENREGISTREMENT_MAX &&
+        lire(entree.position, destination->enregistrement, entree.longueur)) {
+        // Bonne réponse, puis quatre chaînes terminées par '\0'
+        texte = &destination->enregistrement[1];
+        fin = &destination->enregistrement[entree.longueur];
+        fin[-1] = '\0';
+        ok = ((uint8_t)destination->enregistrement[0] < 3);
+        for (int i = 0; i < 4 && ok; i++) {
+            champs[i] = texte;
+            texte += strlen(texte) + 1;
+            ok = (texte <= fin);
+        }
+        for (int i = 0; i < 4 && ok; i++) {
+            replier_en_ascii(champs[i], entete.encodage);
+        }
+        if (ok) {
+            destination->question = (Question){champs[0], {champs[1], champs[2], champs[3]},
+                                               destination->enregistrement[0]};
+        }
+    }
+    PROF_ZONE_END(BANQUE_SD_CHARGER);
+    return ok;
+}
+
+/**
+ * @brief Questions encore disponibles dans une pile de la banque.
+ */
+static uint32_t restantes_sd(int pile) {
+    return (entete.piles[pile + 1] - entete.piles[pile]) - tirees_par_pile[pile];
+}
+
+/**
+ * @brief Question de rang donné parmi celles de la pile pas encore tirées.
+ *
+ * Les questions déjà tirées sont sautées dans l'ordre croissant (tirees[] est trié) :
+ * un seul tirage au hasard, quel que soit le nombre de questions déjà posées dans la pile.
+ *
+ * @param rang De 0 à restantes_sd(pile) - 1.
+ */
+static uint32_t restante(int pile, uint32_t rang) {
+    uint32_t question = entete.piles[pile] + rang;
+
+    for (int i = 0; i < nb_tirees; i++) {
+        if (tirees[i] >= entete.piles[pile] && tirees[i] <= question) {
+            question++;
+        }
+    }
+    return question;
+}
+
+/**
+ * @brief Ajouter une question à celles de la partie, en gardant tirees[] trié.
+ */
+static void noter_tiree(uint32_t question) {
+    int i = nb_tirees++;
+
+    for (; i > 0 && tirees[i - 1] > question; i--) {
+        tirees[i] = tirees[i - 1];
+    }
+    tirees[i] = question;
+}
+
+/**
+ * @brief Tirer la question suivante et la lire dans le tampon libre.
+ *
+ * Une partie ne pose que QUESTIONS_PAR_PARTIE questions : le tirage se fait parmi les questions
+ * restantes de la pile, repérées par leur rang (pas de paquet de milliers d'entrées en RAM).
+ */
+static bool precharger(void) {
+    int pile;
+    uint32_t question;
+
+    if (nb_tirees >= QUESTIONS_PAR_PARTIE) {
+        return false;
+    }
+    pile = choisir_pile(nb_tirees, &restantes_sd);
+    if (pile < 0) {
+        return false;
+    }
+    question = restante(pile, hasard(restantes_sd(pile)));
+
+    if (!charger(question, &tampons[affichee ^ 1])) {
+        ouverte = false; /**< Carte retirée ou fichier abîmé : le jeu repasse sur la banque en flash. */
+        f_close(&fichier);
+        return false;
+    }
+    noter_tiree(question);
+    tirees_par_pile[pile]++;
+    prechargee = true;
+    return true;
+}
+
+/**
+ * @brief Vérifier les débuts de piles de l'en-tête : croissants, de 0 au nombre de questions.
+ *
+ * Sans cette vérification, un fichier abîmé donnerait des tailles de piles négatives
+ * (donc immenses en non signé), et des questions hors de la banque et de index_ram[].
+ */
+static bool piles_valides(void) {
+    if (entete.piles[0] != 0 || entete.piles[NB_PILES] != entete.nombre) {
+        return false;
+    }
+    for (int p = 0; p < NB_PILES; p++) {
+        if (entete.piles[p] > entete.piles[p + 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool banque_sd_ouvrir(const char *nom) {
+    uint32_t taille_index;
+
+    if (ouverte) {
+        f_close(&fichier);
+        ouverte = false;
+    }
+    if (BSP_SD_Init() != BSP_SD_OK) {
+        return false;
+    }
+    if (lecteur[0] == '\0' && FATFS_LinkDriver(&SD_Driver, lecteur) != 0) {
+        return false;
+    }
+    if (f_mount(&systeme_fichiers, lecteur, 1) != FR_OK || f_open(&fichier, nom, FA_READ) != FR_OK) {
+        return false;
+    }
+
+    // Recherche rapide : sans table (fichier trop fragmenté), FatFs parcourt la FAT
+    fragments[0] = ARRAY_SIZE(fragments);
+    fichier.cltbl = fragments;
+    if (f_lseek(&fichier, CREATE_LINKMAP) != FR_OK) {
+        fichier.cltbl = NULL;
+    }
+
+    if (!lire(0, &entete, sizeof(entete)) || memcmp(entete.signature, BANQUE_SIGNATURE, 4) != 0 ||
+        entete.version != BANQUE_VERSION || entete.nb_difficultes != DIFFICULTE_NB ||
+        entete.nb_categories != CATEGORIE_NB || entete.nombre == 0 || !piles_valides()) {
+        f_close(&fichier);
+        return false;
+    }
+
+    // Index : tous ses secteurs en une lecture, s'il tient en RAM
+    taille_index = ((entete.nombre * sizeof(entree_banque_t) + BANQUE_SECTEUR - 1) / BANQUE_SECTEUR) * BANQUE_SECTEUR;
+    index_en_ram = (taille_index <= sizeof(index_ram)) && lire(BANQUE_DEBUT_INDEX, index_ram, taille_index);
+
+    ouverte = true;
+    banque_sd_melanger();
+    return true;
+}
+
+bool banque_sd_ouverte(void) {
+    return ouverte;
+}
+
+void banque_sd_melanger(void) {
+    nb_tirees = 0;
+    prechargee = false;
+    memset(tirees_par_pile, 0, sizeof(tirees_par_pile));
+}
+
+const Question *banque_sd_question_suivante(void) {
+    if (!ouverte || (!prechargee && !precharger())) {
+        return NULL;
+    }
+    affichee ^= 1;
+    prechargee = false;
+    return &tampons[affichee].question;
+}
+
+void banque_sd_prechargement(void) {
+    if (ouverte && !prechargee) {
+        precharger();
+    }
+}
+
+#endif /* USE_BANQUE_SD */
@@ -0,0 +1,61 @@
+/**
+ * @file banque_sd.h
+ * @brief Banque de questions sur carte SD.
+ *
+ * Des milliers de questions, lues à la demande dans un fichier au format
+ * banque_format.h (produit par tools/banque_csv.c à partir d'un fichier CSV).
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#ifndef BANQUE_SD_H_
+#define BANQUE_SD_H_
+
+#include "question.h"
+
+#ifndef BANQUE_SD_FICHIER
+#define BANQUE_SD_FICHIER "0:questions.bnk" /**< Fichier de la banque, à la racine de la carte. */
+#endif
+
+#ifndef BANQUE_SD_INDEX_MAX
+#define BANQUE_SD_INDEX_MAX 256 /**< Questions dont l'index est gardé en RAM (8 octets chacune, multiple de 64). */
+#endif
+
+#if USE_BANQUE_SD
+
+/**
+ * @brief Monter la carte SD et ouvrir la banque.
+ *
+ * @param nom Chemin du fichier (BANQUE_SD_FICHIER).
+ * @return true si la banque est utilisable ; sinon le jeu garde la banque en flash.
+ */
+bool banque_sd_ouvrir(const char *nom);
+
+/**
+ * @brief Indique si la banque sur carte SD est ouverte (et la carte lisible).
+ */
+bool banque_sd_ouverte(void);
+
+/**
+ * @brief Nouvelle partie : toutes les questions redeviennent disponibles.
+ */
+void banque_sd_melanger(void);
+
+/**
+ * @brief Tirer la question suivante de la partie (préchargée si possible).
+ *
+ * @return La question, valable jusqu'au tirage suivant, ou NULL si la partie est finie,
+ *         les piles vides ou la carte illisible (banque_sd_ouverte() vaut alors false).
+ */
+const Question *banque_sd_question_suivante(void);
+
+/**
+ * @brief Précharger la question suivante. À appeler quand le processeur n'a rien à faire
+ * (fonction de repos de l'ordonnanceur).
+ */
+void banque_sd_prechargement(void);
+
+#endif /* USE_BANQUE_SD */
+
+#endif /* BANQUE_SD_H_ */
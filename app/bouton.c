@@ -10,6 +10,13 @@
  */
 
 #include "bouton.h"
+#include "stm32g4_prof.h"
+
+#if !USE_BUTTON
+#error "bouton.c nécessite USE_BUTTON"
+#endif
+
+#define PAS_ARGENT 10000 /**< Somme ajoutée ou retirée par appui (ou par répétition). */
 
 /**
  * @brief État actuel de la trappe sélectionnée.
@@ -19,79 +26,102 @@
  */
 etat_trappe_t etat_trappe = TRAPPE1;
 
-static uint8_t bouton_droit_prec = 1; /**< État précédent du bouton droit. */
-static uint8_t bouton_gauche_prec = 1; /**< État précédent du bouton gauche. */
-static uint8_t bouton_haut_prec = 1; /**< État précédent du bouton haut. */
-static uint8_t bouton_bas_prec = 1; /**< État précédent du bouton bas. */
+/**
+ * @brief Répétition des boutons haut et bas : première répétition 400 ms après l'appui,
+ * puis toutes les 200 ms, de plus en plus vite (15 % à chaque fois), jusqu'à toutes les 40 ms.
+ */
+static const button_repeat_t repetition_argent = {400, 200, 40, 15};
+
+void initialiser_boutons(void) {
+    BSP_BUTTON_add(BOUTON_HAUT, GPIOA, GPIO_PIN_0, &repetition_argent);
+    BSP_BUTTON_add(BOUTON_DROIT, GPIOA, GPIO_PIN_1, NULL);
+    BSP_BUTTON_add(BOUTON_CENTRE, GPIOB, GPIO_PIN_5, NULL);
+    BSP_BUTTON_add(BOUTON_GAUCHE, GPIOA, GPIO_PIN_9, NULL);
+    BSP_BUTTON_add(BOUTON_BAS, GPIOA, GPIO_PIN_10, &repetition_argent);
+}
+
+bool appui_bouton(void) {
+    button_event_t evenement;
+    bool appui = false;
+
+    while (BSP_BUTTON_get_event(&evenement)) {
+        appui |= (evenement.type == BUTTON_EVENT_PRESS);
+    }
+    return appui;
+}
+
+/**
+ * @brief Déplacer une somme d'une réserve à l'autre, si elle y est.
+ */
+static bool deplacer_argent(int *depuis, int *vers) {
+    if (*depuis < PAS_ARGENT) {
+        return false;
+    }
+    *depuis -= PAS_ARGENT;
+    *vers += PAS_ARGENT;
+    return true;
+}
 
 /**
  * @brief Gérer les boutons pour interagir avec les trappes.
  *
- * Cette fonction gère les actions des boutons pour :
+ * Cette fonction traite, dans l'ordre, les évènements des boutons survenus
+ * depuis le dernier appel :
  * - Naviguer entre les trappes (boutons gauche et droit).
- * - Ajouter de l'argent à une trappe (bouton haut).
- * - Retirer de l'argent d'une trappe (bouton bas).
+ * - Ajouter de l'argent à une trappe (bouton haut, répété tant qu'il est maintenu).
+ * - Retirer de l'argent d'une trappe (bouton bas, répété tant qu'il est maintenu).
+ * - Valider (bouton centre), si tout l'argent est placé.
+ *
+ * Les affichages ne sont refaits qu'une fois, après tous les évènements : un appui bref
+ * pendant un rafraîchissement de l'écran n'est plus perdu, il est traité au passage suivant.
  *
  * @param q La question actuelle, utilisée pour mettre à jour les réponses affichées.
+ * @return true si le joueur valide alors que tout l'argent est placé.
  */
-void gerer_boutons(Question q) {
-    static uint32_t dernier_temps_haut = 0; /**< Dernier temps où le bouton haut a été traité. */
-    static uint32_t dernier_temps_bas = 0;  /**< Dernier temps où le bouton bas a été traité. */
+bool gerer_boutons(const Question *q) {
+    button_event_t evenement;
+    bool trappe_changee = false;
+    bool argent_change = false;
+    bool validation = false;
 
-    uint8_t bouton_droit = HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_1); /**< État du bouton droit. */
-    uint8_t bouton_gauche = HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_9); /**< État du bouton gauche. */
-    uint8_t bouton_haut = HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_0); /**< État du bouton haut. */
-    uint8_t bouton_bas = HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_10); /**< État du bouton bas. */
-
-    // Gestion du bouton droit
-    if (bouton_droit == 0 && bouton_droit_prec == 1) {
-        if (etat_trappe < TRAPPE3) etat_trappe++;
-        mettre_a_jour_couleurs_trappes();
-        afficher_reponses(q);
+    PROF_ZONE_BEGIN(GERER_BOUTONS);
+    while (!validation && BSP_BUTTON_get_event(&evenement)) {
+        if (evenement.type != BUTTON_EVENT_PRESS && evenement.type != BUTTON_EVENT_REPEAT) {
+            continue;
+        }
+        switch (evenement.button) {
+        case BOUTON_DROIT:
+            if (evenement.type == BUTTON_EVENT_PRESS && etat_trappe < TRAPPE3) {
+                etat_trappe++;
+                trappe_changee = true;
+            }
+            break;
+        case BOUTON_GAUCHE:
+            if (evenement.type == BUTTON_EVENT_PRESS && etat_trappe > TRAPPE1) {
+                etat_trappe--;
+                trappe_changee = true;
+            }
+            break;
+        case BOUTON_HAUT:
+            argent_change |= deplacer_argent(&argent_total, &argent_trappes[etat_trappe]);
+            break;
+        case BOUTON_BAS:
+            argent_change |= deplacer_argent(&argent_trappes[etat_trappe], &argent_total);
+            break;
+        case BOUTON_CENTRE:
+            validation = (evenement.type == BUTTON_EVENT_PRESS && tout_argent_place());
+            break;
+        }
     }
 
-    // Gestion du bouton gauche
-    if (bouton_gauche == 0 && bouton_gauche_prec == 1) {
-        if (etat_trappe > TRAPPE1) etat_trappe--;
+    if (trappe_changee) {
         mettre_a_jour_couleurs_trappes();
         afficher_reponses(q);
     }
-
-    // Gestion du bouton haut (ajouter de l'argent)
-    if (bouton_haut == 0) {
-        uint32_t temps_actuel = HAL_GetTick();
-        if (temps_actuel - dernier_temps_haut >= 200) { // Ajouter toutes les 200 ms
-            if (argent_total >= 10000) {
-                argent_trappes[etat_trappe] += 10000;
-                argent_total -= 10000;
-                afficher_argent_total();
-                afficher_argent_trappes();
-            }
-            dernier_temps_haut = temps_actuel; // Mettre à jour le dernier temps
-        }
-    } else {
-        dernier_temps_haut = 0; // Réinitialiser si le bouton est relâché
+    if (argent_change) {
+        afficher_argent_total();
+        afficher_argent_trappes();
     }
-
-    // Gestion du bouton bas (retirer de l'argent)
-    if (bouton_bas == 0) {
-        uint32_t temps_actuel = HAL_GetTick();
-        if (temps_actuel - dernier_temps_bas >= 200) { // Retirer toutes les 200 ms
-            if (argent_trappes[etat_trappe] >= 10000) {
-                argent_trappes[etat_trappe] -= 10000;
-                argent_total += 10000;
-                afficher_argent_total();
-                afficher_argent_trappes();
-            }
-            dernier_temps_bas = temps_actuel; // Mettre à jour le dernier temps
-        }
-    } else {
-        dernier_temps_bas = 0; // Réinitialiser si le bouton est relâché
-    }
-
-    // Mettre à jour les états précédents des boutons
-    bouton_droit_prec = bouton_droit;
-    bouton_gauche_prec = bouton_gauche;
-    bouton_haut_prec = bouton_haut;
-    bouton_bas_prec = bouton_bas;
+    PROF_ZONE_END(GERER_BOUTONS);
+    return validation;
 }
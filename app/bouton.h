@@ -15,6 +15,7 @@
 #include "question.h"
 #include "argent.h"
 #include "affichage.h"
+#include "stm32g4_button.h"
 
 /**
  * @brief États des trappes.
@@ -27,11 +28,36 @@ typedef enum {
     TRAPPE3      /**< Trappe 3. */
 } etat_trappe_t;
 
+/**
+ * @brief Identifiants des boutons dans les évènements (stm32g4_button.h).
+ */
+typedef enum {
+    BOUTON_HAUT = 0, /**< PA0 : ajouter de l'argent (répété en accélérant tant qu'il est maintenu). */
+    BOUTON_DROIT,    /**< PA1 : trappe suivante. */
+    BOUTON_CENTRE,   /**< PB5 : valider. */
+    BOUTON_GAUCHE,   /**< PA9 : trappe précédente. */
+    BOUTON_BAS       /**< PA10 : retirer de l'argent (répété en accélérant tant qu'il est maintenu). */
+} bouton_t;
+
 /**
  * @brief État actuel de la trappe sélectionnée.
  */
 extern etat_trappe_t etat_trappe;
 
+/**
+ * @brief Configurer les cinq boutons (interruption sur les deux fronts, anti-rebond).
+ */
+void initialiser_boutons(void);
+
+/**
+ * @brief Indiquer si un bouton a été appuyé depuis le dernier appel.
+ *
+ * Consomme tous les évènements en attente.
+ *
+ * @return true si au moins un appui a eu lieu.
+ */
+bool appui_bouton(void);
+
 /**
  * @brief Gérer les boutons pour interagir avec les trappes.
  *
@@ -39,7 +65,8 @@ extern etat_trappe_t etat_trappe;
  * de l'argent sur les trappes en fonction de la question en cours.
  *
  * @param q La question actuelle.
+ * @return true si le joueur valide (bouton centre) alors que tout l'argent est placé.
  */
-void gerer_boutons(Question q);
+bool gerer_boutons(const Question *q);
 
 #endif /* BOUTON_H_ */
@@ -22,12 +22,24 @@
 
 #define UART2_ON_PA3_PA2
 #define UART1_ON_PA10_PA9
+//#define UART1_RX_BUFFER_SIZE	128	// Taille des buffers de réception UART (128 par défaut), cf. BSP_UART_get_stats() pour les dimensionner
+//#define UART2_RX_BUFFER_SIZE	128
 
 #define USE_BSP_TIMER		1
-#define USE_BSP_EXTIT		0
+#define USE_TIMEBASE		1 // Base de temps en us sur TIM2 (32 bits, 1 MHz) : TIM2 n'est alors plus disponible pour stm32g4_timer.c
+#define USE_IDLE			1 // Repos sans tick (SysTick suspendu, réveil par LPTIM1) quand l'ordonnanceur n'a rien à faire : BSP_IDLE_get_idle_percent()
+#if USE_IDLE
+	#define IDLE_STOP_MODE	0 // 1 : mode Stop 1 au lieu de Sleep, consommation minimale mais UART, DMA et TIM2 figés pendant le repos
+#endif
+#define USE_BSP_EXTIT		1
+#define USE_BUTTON			1 // Boutons : anti-rebond sur interruption externe, évènements datés (appui, relâchement, appui long, répétition) : BSP_BUTTON_get_event()
 
 #define USE_RTC				0
 
+#define USE_FLASHLOG		1 // Journal d'enregistrements en flash, sans effacement à chaque écriture, usure répartie sur les pages 61 et 62 (région FLASHLOG) : BSP_FLASHLOG_append()
+#define USE_SCORES			1 // Meilleurs scores et statistiques des parties, conservés en flash (app/scores.c) : nécessite USE_FLASHLOG
+#define USE_KVSTORE			1 // Stockage clé-valeur en flash, écritures à la suite sur les pages 58 à 60 (région KVSTORE), ramasse-miettes : BSP_KVSTORE_set(), et BSP_FLASH_set_doubleword sans effacement
+
 #define USE_ADC				1
 	/* Configuration pour activer les entrées analogiques souhaitées */
 	#define USE_IN1		1 //Broche correspondante: PA0
@@ -40,6 +52,8 @@
 
 #define USE_DAC				0
 
+#define USE_RNG				1 // Générateur de nombres aléatoires matériel (horloge HSI48) : BSP_RNG_get(), graine du jeu
+
 /*------------------Afficheurs------------------*/
 #define USE_ILI9341			1 // �cran TFT
 #if USE_ILI9341
@@ -47,6 +61,8 @@
 	#define USE_FONT7x10		1
 	#define USE_FONT11x18		1
 	#define USE_FONT16x26		1
+	#define USE_ILI9341_ANIM	1 // Animations à cadence fixe, redessin des seules bandes modifiées (ouverture des trappes)
+	#define USE_ECRANS_PRECALCULES	1 // Écrans fixes en images compressées générées par tools/ecrans_gen.c (app/ecrans_images.c)
 #endif
 
 #define USE_EPAPER			0 // e-paper (�cran basse consommation)
@@ -79,6 +95,7 @@
 #define USE_MCP23017		0 // GPIO expander qui communique en i2C
 #define USE_MCP23S17		0 // GPIO expander qui communique en SPI
 #define USE_SD_CARD			0 // Carte SD pour lire/�crire des fichiers
+#define USE_BANQUE_SD		0 // Banque de questions sur carte SD (questions.bnk, cf. tools/banque_csv.c) : nécessite USE_SD_CARD
 
 /*------------------Actionneurs------------------*/
 #define USE_MOTOR_DC		0
@@ -104,5 +121,13 @@
 
 #define USE_TESTBOARD				0
 
+/*------------------Mise au point------------------*/
+#define USE_DLOG			0 // Journalisation binaire différée (DLOG) : texte reconstruit sur PC avec tools/dlog_decode.c
+#define USE_TELEMETRY		0 // Trames binaires COBS + CRC16 sur UART : décodage sur PC avec tools/telemetry_decode.c
+#define USE_PROF			0 // Profilage par zones (cycles DWT) : PROF_ZONE_BEGIN/END, résultats avec BSP_PROF_dump()
+#define USE_IRQSTAT			0 // Latence/durée des IT et sections masquées : BSP_IRQSTAT_dump(), mise en forme sur PC avec tools/irqstat_report.c
+#define USE_MEMWATCH		0 // Pile (plus grande profondeur, garde de débordement) et tas par site d'allocation : BSP_MEMWATCH_dump(), bilan statique avec tools/mem_report.c
+#define USE_TRACE			0 // Trace des IT, transactions SPI, rafales UART et changements d'état (buffer circulaire en RAM) : BSP_TRACE_dump(), conversion avec tools/trace_to_chrome.c
+
 
 #endif /* CONFIG_H_ */
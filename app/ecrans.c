@@ -0,0 +1,113 @@
+/**
+ * @file ecrans.c
+ * @brief Description de la partie statique des écrans fixes du jeu.
+ *
+ * Les champs variables (montants des écrans de fin et de bilan) n'en font pas partie :
+ * affichage.c les dessine par-dessus. Toute modification doit être suivie de la
+ * régénération de ecrans_images.c (cf. ecrans.h).
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#include "ecrans.h"
+#include <string.h>
+
+#define REMPLIR(c) {OPERATION_REMPLIR, 0, 0, 0, 0, (c), 0, NULL, NULL}
+#define RECTANGLE(x0, y0, x1, y1, c) {OPERATION_RECTANGLE, (x0), (y0), (x1), (y1), (c), 0, NULL, NULL}
+#define RECTANGLE_PLEIN(x0, y0, x1, y1, c) {OPERATION_RECTANGLE_PLEIN, (x0), (y0), (x1), (y1), (c), 0, NULL, NULL}
+#define TEXTE(x, y, t, p, c, f) {OPERATION_TEXTE, (x), (y), 0, 0, (c), (f), (p), (t)}
+#define ECRAN(nom, operations) {(nom), (operations), sizeof(operations) / sizeof((operations)[0])}
+
+static const operation_ecran_t operations_debut[] = {
+    REMPLIR(ILI9341_COLOR_BLUE),
+    RECTANGLE(20, 30, 300, 100, ILI9341_COLOR_WHITE),
+    RECTANGLE_PLEIN(21, 31, 299, 99, ILI9341_COLOR_BLACK),
+    TEXTE(80, 50, "Money Drop", &Font_16x26, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK),
+    TEXTE(40, 140, "Appuyez sur un bouton", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE),
+    TEXTE(80, 160, "pour commencer", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE),
+    TEXTE(80, 200, "Bonne chance !", &Font_11x18, ILI9341_COLOR_YELLOW, ILI9341_COLOR_BLUE),
+};
+
+static const operation_ecran_t operations_regles[] = {
+    REMPLIR(ILI9341_COLOR_CYAN),
+    TEXTE(50, 10, "Regles du jeu", &Font_16x26, ILI9341_COLOR_WHITE, ILI9341_COLOR_CYAN),
+    TEXTE(37, 50, "Vous avez 20 liasses de", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(70, 70, "billets au debut.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(37, 100, "Repartissez les billets", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(70, 120, "sur les trappes.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(50, 150, "Chaque manche, les", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(13, 170, "mauvaises trappes tombent !", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(30, 200, "Conservez un maximum de", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(110, 220, "billets !", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+};
+
+static const operation_ecran_t operations_perdu[] = {
+    REMPLIR(ILI9341_COLOR_RED),
+    RECTANGLE(20, 50, 300, 200, ILI9341_COLOR_WHITE),
+    RECTANGLE_PLEIN(21, 51, 299, 199, ILI9341_COLOR_BLACK),
+    TEXTE(45, 70, "Vous avez perdu", &Font_16x26, ILI9341_COLOR_RED, ILI9341_COLOR_BLACK),
+    TEXTE(40, 120, "Plus d'argent restant.", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK),
+    TEXTE(37, 170, "Reessayez pour gagner !", &Font_11x18, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLACK),
+};
+
+static const operation_ecran_t operations_fin[] = {
+    REMPLIR(ILI9341_COLOR_GREEN),
+    RECTANGLE(20, 50, 300, 200, ILI9341_COLOR_BLACK),
+    RECTANGLE_PLEIN(21, 51, 299, 199, ILI9341_COLOR_CYAN),
+    TEXTE(55, 70, "Fin du jeu !", &Font_16x26, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+    TEXTE(50, 120, "Merci d'avoir joue.", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+};
+
+static const operation_ecran_t operations_argent_restant[] = {
+    REMPLIR(ILI9341_COLOR_CYAN),
+    RECTANGLE(20, 50, 300, 150, ILI9341_COLOR_BLACK),
+    RECTANGLE_PLEIN(21, 51, 299, 149, ILI9341_COLOR_WHITE),
+    TEXTE(50, 60, "Argent restant", &Font_16x26, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE),
+    TEXTE(20, 160, "Bonne chance pour la suite", &Font_11x18, ILI9341_COLOR_BLACK, ILI9341_COLOR_CYAN),
+};
+
+const description_ecran_t descriptions_ecrans[NB_ECRANS] = {
+    [ECRAN_DEBUT]          = ECRAN("debut", operations_debut),
+    [ECRAN_REGLES]         = ECRAN("regles", operations_regles),
+    [ECRAN_PERDU]          = ECRAN("perdu", operations_perdu),
+    [ECRAN_FIN]            = ECRAN("fin", operations_fin),
+    [ECRAN_ARGENT_RESTANT] = ECRAN("argent_restant", operations_argent_restant),
+};
+
+/**
+ * @brief Ajoute des octets à une empreinte FNV-1a.
+ */
+static uint32_t empreinte_ajouter(uint32_t empreinte, const void *donnees, size_t taille) {
+    const uint8_t *octets = donnees;
+
+    for (size_t i = 0; i < taille; i++) {
+        empreinte ^= octets[i];
+        empreinte *= 16777619u;
+    }
+    return empreinte;
+}
+
+/**
+ * @brief Empreinte des descriptions (FNV-1a sur les primitives et les textes).
+ *
+ * Champ par champ : le résultat ne dépend ni du remplissage des structures ni de l'adresse des polices.
+ *
+ * @return L'empreinte.
+ */
+uint32_t empreinte_ecrans(void) {
+    uint32_t empreinte = 2166136261u;
+
+    for (int e = 0; e < NB_ECRANS; e++) {
+        for (int i = 0; i < descriptions_ecrans[e].nb_operations; i++) {
+            const operation_ecran_t *op = &descriptions_ecrans[e].operations[i];
+            uint16_t champs[9] = {(uint16_t)op->type, op->x0, op->y0, op->x1, op->y1, op->couleur, op->fond,
+                                  op->police ? op->police->FontWidth : 0, op->police ? op->police->FontHeight : 0};
+
+            empreinte = empreinte_ajouter(empreinte, champs, sizeof(champs));
+            if (op->texte)
+                empreinte = empreinte_ajouter(empreinte, op->texte, strlen(op->texte) + 1);
+        }
+    }
+    return empreinte;
+}
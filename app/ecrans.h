@@ -0,0 +1,92 @@
+/**
+ * @file ecrans.h
+ * @brief Partie statique des écrans fixes du jeu.
+ *
+ * Fichier partagé par le jeu (affichage.c) et l'outil PC tools/ecrans_gen.c.
+ * Chaque écran est décrit par la liste des primitives qui le dessinent (remplissages,
+ * rectangles, textes fixes). L'outil dessine ces descriptions sur PC et les compresse en
+ * images (ecrans_images.c) : sur la cible, un écran s'affiche alors en un seul transfert,
+ * puis seuls les champs variables (montants) sont dessinés par-dessus.
+ *
+ * Après toute modification de ecrans.c, régénérer les images :
+ *     ecrans_gen > app/ecrans_images.c
+ * Sinon, l'empreinte des descriptions ne correspond plus et le jeu dessine les écrans
+ * primitive par primitive, comme avant.
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#ifndef ECRANS_H_
+#define ECRANS_H_
+
+#include "config.h"
+#include "tft_ili9341/stm32g4_ili9341.h"
+
+/**
+ * @brief Primitives de dessin des écrans fixes.
+ */
+typedef enum {
+    OPERATION_REMPLIR = 0,     /**< Tout l'écran, dans la couleur. */
+    OPERATION_RECTANGLE,       /**< Contour, coins (x0, y0) et (x1, y1) inclus. */
+    OPERATION_RECTANGLE_PLEIN, /**< Rectangle plein, coins (x0, y0) et (x1, y1) inclus. */
+    OPERATION_TEXTE            /**< Texte sur une ligne, à partir de (x0, y0). */
+} type_operation_t;
+
+/**
+ * @brief Une primitive de dessin.
+ */
+typedef struct {
+    type_operation_t type;
+    uint16_t x0;       /**< Coin supérieur gauche. */
+    uint16_t y0;
+    uint16_t x1;       /**< Coin inférieur droit (rectangles). */
+    uint16_t y1;
+    uint16_t couleur;
+    uint16_t fond;     /**< Fond des caractères (texte). */
+    FontDef_t *police; /**< Texte. */
+    const char *texte;
+} operation_ecran_t;
+
+/**
+ * @brief Partie statique d'un écran.
+ */
+typedef struct {
+    const char *nom; /**< Nom de l'écran dans ecrans_images.c. */
+    const operation_ecran_t *operations;
+    uint8_t nb_operations;
+} description_ecran_t;
+
+/**
+ * @brief Écrans fixes.
+ */
+typedef enum {
+    ECRAN_DEBUT = 0,      /**< Titre, en attente d'un appui. */
+    ECRAN_REGLES,         /**< Règles du jeu. */
+    ECRAN_PERDU,          /**< Plus d'argent. */
+    ECRAN_FIN,            /**< Fin de partie, suivi du total. */
+    ECRAN_ARGENT_RESTANT, /**< Bilan d'une question, suivi de l'argent restant. */
+    NB_ECRANS
+} ecran_t;
+
+/**
+ * @brief Description de chaque écran fixe, dans l'ordre de ecran_t.
+ */
+extern const description_ecran_t descriptions_ecrans[NB_ECRANS];
+
+/**
+ * @brief Empreinte des descriptions (FNV-1a sur les primitives et les textes).
+ *
+ * Calculée par l'outil au moment de générer les images, et par le jeu au démarrage :
+ * des images générées à partir d'autres descriptions ne sont pas utilisées.
+ *
+ * @return L'empreinte.
+ */
+uint32_t empreinte_ecrans(void);
+
+#if USE_ECRANS_PRECALCULES
+extern const ILI9341_rle_image_t images_ecrans[NB_ECRANS]; /**< ecrans_images.c, généré par tools/ecrans_gen.c. */
+extern const uint32_t empreinte_images_ecrans;             /**< empreinte_ecrans() des descriptions dessinées. */
+#endif
+
+#endif /* ECRANS_H_ */
@@ -0,0 +1,925 @@
+/**
+ * @file ecrans_images.c
+ * @brief Écrans fixes précalculés, compressés en plages (ILI9341_rle_image_t).
+ *
+ * Fichier généré par tools/ecrans_gen.c à partir de ecrans.c : ne pas le modifier.
+ * 320 x 240 pixels par écran, 153600 octets non compressés :
+ * - debut : 4 couleurs, 2496 octets ;
+ * - regles : 3 couleurs, 5047 octets ;
+ * - perdu : 3 couleurs, 2676 octets ;
+ * - fin : 3 couleurs, 1795 octets ;
+ * - argent_restant : 3 couleurs, 1884 octets ;
+ * soit 13930 octets de flash.
+ */
+
+#include "ecrans.h"
+
+#if USE_ECRANS_PRECALCULES
+
+const uint32_t empreinte_images_ecrans = 0x7D4FC51Bu;
+
+static const uint16_t palette_debut[] = {0x001F, 0xFFFF, 0x0000, 0xFFE0};
+
+static const uint8_t donnees_debut[] = {
+    0x00, 0x94, 0x25, 0x40, 0x19, 0x01, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0xBB, 0x45, 0x86, 0x45,
+    0xBF, 0x92, 0x4B, 0xBF, 0xB1, 0x41, 0x27, 0x41, 0xBB, 0x46, 0x85, 0x45, 0xBF, 0x92, 0x4D, 0xBF,
+    0xAF, 0x41, 0x27, 0x41, 0xBB, 0x46, 0x85, 0x45, 0xBF, 0x92, 0x44, 0x84, 0x46, 0xBF, 0xAE, 0x41,
+    0x27, 0x41, 0xBB, 0x47, 0x83, 0x46, 0x85, 0x47, 0x86, 0x44, 0x81, 0x47, 0x88, 0x47, 0x83, 0x45,
+    0x88, 0x43, 0x91, 0x44, 0x86, 0x45, 0x83, 0x45, 0x81, 0x47, 0x85, 0x47, 0x86, 0x44, 0x81, 0x46,
+    0xBF, 0x41, 0x27, 0x41, 0xBB, 0x47, 0x83, 0x46, 0x83, 0x4B, 0x84, 0x4D, 0x85, 0x4A, 0x83, 0x44,
+    0x87, 0x44, 0x91, 0x44, 0x86, 0x45, 0x83, 0x4D, 0x83, 0x4B, 0x84, 0x4D, 0xBD, 0x41, 0x27, 0x41,
+    0xBB, 0x47, 0x83, 0x46, 0x82, 0x45, 0x83, 0x45, 0x83, 0x47, 0x82, 0x44, 0x84, 0x45, 0x82, 0x45,
+    0x82, 0x45, 0x86, 0x44, 0x91, 0x44, 0x87, 0x44, 0x83, 0x48, 0x82, 0x43, 0x82, 0x45, 0x83, 0x45,
+    0x83, 0x46, 0x82, 0x45, 0xBD, 0x41, 0x27, 0x41, 0xBB, 0x48, 0x81, 0x47, 0x82, 0x44, 0x85, 0x45,
+    0x82, 0x46, 0x83, 0x45, 0x82, 0x45, 0x84, 0x44, 0x83, 0x44, 0x85, 0x44, 0x92, 0x44, 0x87, 0x44,
+    0x83, 0x47, 0x83, 0x43, 0x82, 0x44, 0x85, 0x45, 0x82, 0x45, 0x84, 0x45, 0xBC, 0x41, 0x27, 0x41,
+    0xBB, 0x48, 0x81, 0x43, 0x81, 0x43, 0x81, 0x45, 0x85, 0x45, 0x82, 0x45, 0x84, 0x45, 0x82, 0x44,
+    0x85, 0x45, 0x82, 0x44, 0x85, 0x44, 0x92, 0x44, 0x87, 0x44, 0x83, 0x46, 0x84, 0x43, 0x81, 0x45,
+    0x85, 0x45, 0x82, 0x44, 0x86, 0x44, 0xBC, 0x41, 0x27, 0x41, 0xBB, 0x48, 0x81, 0x43, 0x81, 0x43,
+    0x81, 0x44, 0x87, 0x44, 0x82, 0x44, 0x85, 0x45, 0x81, 0x45, 0x85, 0x45, 0x83, 0x44, 0x83, 0x44,
+    0x93, 0x44, 0x87, 0x44, 0x83, 0x45, 0x89, 0x44, 0x87, 0x44, 0x82, 0x44, 0x86, 0x44, 0xBC, 0x41,
+    0x27, 0x41, 0xBB, 0x44, 0x81, 0x47, 0x81, 0x43, 0x81, 0x44, 0x87, 0x44, 0x82, 0x44, 0x85, 0x45,
+    0x81, 0x4F, 0x83, 0x44, 0x83, 0x44, 0x93, 0x44, 0x87, 0x44, 0x83, 0x45, 0x89, 0x44, 0x87, 0x44,
+    0x82, 0x44, 0x86, 0x44, 0xBC, 0x41, 0x27, 0x41, 0xBB, 0x44, 0x81, 0x46, 0x82, 0x43, 0x81, 0x44,
+    0x87, 0x44, 0x82, 0x44, 0x85, 0x45, 0x81, 0x4F, 0x83, 0x45, 0x82, 0x44, 0x93, 0x44, 0x87, 0x44,
+    0x83, 0x45, 0x89, 0x44, 0x87, 0x44, 0x82, 0x44, 0x86, 0x44, 0xBC, 0x41, 0x27, 0x41, 0xBB, 0x44,
+    0x82, 0x45, 0x82, 0x43, 0x81, 0x44, 0x87, 0x44, 0x82, 0x44, 0x85, 0x45, 0x81, 0x45, 0x8E, 0x44,
+    0x81, 0x44, 0x94, 0x44, 0x87, 0x44, 0x83, 0x45, 0x89, 0x44, 0x87, 0x44, 0x82, 0x44, 0x86, 0x44,
+    0xBC, 0x41, 0x27, 0x41, 0xBB, 0x44, 0x82, 0x45, 0x82, 0x43, 0x81, 0x44, 0x87, 0x44, 0x82, 0x44,
+    0x85, 0x45, 0x81, 0x45, 0x8E, 0x49, 0x94, 0x44, 0x87, 0x44, 0x83, 0x45, 0x89, 0x44, 0x87, 0x44,
+    0x82, 0x44, 0x86, 0x44, 0xBC, 0x41, 0x27, 0x41, 0xBB, 0x44, 0x82, 0x44, 0x83, 0x43, 0x81, 0x45,
+    0x85, 0x45, 0x82, 0x44, 0x85, 0x45, 0x82, 0x44, 0x8F, 0x47, 0x95, 0x44, 0x86, 0x45, 0x83, 0x45,
+    0x89, 0x45, 0x85, 0x45, 0x82, 0x44, 0x85, 0x45, 0xBC, 0x41, 0x27, 0x41, 0xBB, 0x44, 0x89, 0x43,
+    0x82, 0x44, 0x85, 0x45, 0x82, 0x44, 0x85, 0x45, 0x82, 0x45, 0x8E, 0x47, 0x95, 0x44, 0x86, 0x44,
+    0x84, 0x45, 0x8A, 0x44, 0x85, 0x45, 0x82, 0x45, 0x84, 0x44, 0xBD, 0x41, 0x27, 0x41, 0xBB, 0x44,
+    0x89, 0x43, 0x82, 0x45, 0x83, 0x45, 0x83, 0x44, 0x85, 0x45, 0x83, 0x45, 0x85, 0x43, 0x86, 0x45,
+    0x96, 0x44, 0x84, 0x46, 0x84, 0x45, 0x8A, 0x45, 0x83, 0x45, 0x83, 0x46, 0x82, 0x45, 0xBD, 0x41,
+    0x27, 0x41, 0xBB, 0x44, 0x89, 0x43, 0x83, 0x4B, 0x84, 0x44, 0x85, 0x45, 0x84, 0x4C, 0x86, 0x45,
+    0x96, 0x4C, 0x86, 0x45, 0x8B, 0x4B, 0x84, 0x4C, 0xBE, 0x41, 0x27, 0x41, 0xBB, 0x44, 0x89, 0x43,
+    0x85, 0x47, 0x86, 0x44, 0x85, 0x45, 0x86, 0x49, 0x87, 0x44, 0x97, 0x4A, 0x88, 0x45, 0x8D, 0x47,
+    0x86, 0x4B, 0xBF, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x83, 0x44, 0xBF, 0x89, 0x44, 0xBF, 0x87, 0x41,
+    0x27, 0x41, 0xBF, 0xBF, 0x83, 0x44, 0xBF, 0x89, 0x44, 0xBF, 0x87, 0x41, 0x27, 0x41, 0xBF, 0xBF,
+    0x82, 0x44, 0xBF, 0x8A, 0x44, 0xBF, 0x87, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x81, 0x45, 0xBF, 0x8A,
+    0x44, 0xBF, 0x87, 0x41, 0x27, 0x41, 0xBF, 0xBD, 0x47, 0xBF, 0x8B, 0x44, 0xBF, 0x87, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x40, 0x19, 0x01, 0x00, 0x3F, 0x32, 0x43, 0x3F, 0x3F, 0x21, 0x42, 0x3F, 0x3F, 0x1E, 0x43, 0x3F,
+    0x3F, 0x21, 0x42, 0x22, 0x41, 0x3F, 0x39, 0x42, 0x01, 0x42, 0x3F, 0x3F, 0x20, 0x42, 0x21, 0x42,
+    0x3F, 0x39, 0x42, 0x01, 0x42, 0x04, 0x42, 0x01, 0x43, 0x05, 0x42, 0x01, 0x43, 0x10, 0x42, 0x04,
+    0x42, 0x3F, 0x32, 0x42, 0x21, 0x42, 0x3F, 0x39, 0x42, 0x01, 0x42, 0x04, 0x47, 0x04, 0x47, 0x04,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x44, 0x05, 0x49, 0x0F, 0x44, 0x05, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x02, 0x43, 0x0F, 0x42, 0x04, 0x42, 0x03, 0x42, 0x01, 0x44, 0x0F, 0x42, 0x01,
+    0x43, 0x07, 0x44, 0x05, 0x42, 0x04, 0x42, 0x03, 0x47, 0x06, 0x44, 0x05, 0x42, 0x01, 0x44, 0x3F,
+    0x20, 0x42, 0x01, 0x42, 0x04, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x04, 0x46, 0x04, 0x49, 0x0E, 0x47, 0x03, 0x42, 0x04, 0x42, 0x04, 0x47,
+    0x0E, 0x42, 0x04, 0x42, 0x03, 0x48, 0x0E, 0x47, 0x05, 0x46, 0x04, 0x42, 0x04, 0x42, 0x03, 0x47,
+    0x05, 0x46, 0x04, 0x48, 0x3F, 0x1E, 0x42, 0x03, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x43, 0x02, 0x42, 0x0A, 0x42, 0x0E,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x43, 0x02, 0x41, 0x0F, 0x42, 0x04, 0x42, 0x03,
+    0x43, 0x03, 0x42, 0x0E, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42, 0x05,
+    0x42, 0x07, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x3F, 0x1E, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x42, 0x04, 0x42,
+    0x04, 0x42, 0x08, 0x42, 0x0F, 0x42, 0x09, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42,
+    0x03, 0x42, 0x04, 0x42, 0x0E, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42,
+    0x05, 0x42, 0x07, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x3F, 0x1E, 0x47, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x01, 0x42, 0x04, 0x48, 0x07,
+    0x42, 0x10, 0x47, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x0E, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x07,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x3F, 0x1E, 0x47, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x01, 0x42, 0x04, 0x48, 0x06, 0x42, 0x12, 0x47,
+    0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x0E, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x07, 0x42, 0x04, 0x42,
+    0x03, 0x42, 0x04, 0x42, 0x3F, 0x1E, 0x42, 0x03, 0x42, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02,
+    0x43, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x01, 0x42, 0x04, 0x42, 0x0B, 0x42, 0x18, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x0E, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x07, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x3F, 0x1D, 0x42, 0x05, 0x42, 0x02, 0x47, 0x04, 0x47, 0x04, 0x42, 0x03, 0x43,
+    0x06, 0x43, 0x05, 0x43, 0x03, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x03, 0x43,
+    0x04, 0x42, 0x13, 0x42, 0x03, 0x43, 0x03, 0x42, 0x04, 0x42, 0x0E, 0x43, 0x02, 0x43, 0x03, 0x43,
+    0x02, 0x43, 0x03, 0x42, 0x03, 0x43, 0x05, 0x42, 0x07, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42,
+    0x3F, 0x1D, 0x42, 0x05, 0x42, 0x02, 0x42, 0x01, 0x43, 0x05, 0x42, 0x01, 0x43, 0x05, 0x48, 0x06,
+    0x43, 0x06, 0x46, 0x04, 0x49, 0x0D, 0x47, 0x04, 0x48, 0x04, 0x42, 0x13, 0x48, 0x03, 0x42, 0x04,
+    0x42, 0x0E, 0x47, 0x05, 0x46, 0x04, 0x48, 0x05, 0x46, 0x04, 0x46, 0x04, 0x42, 0x04, 0x42, 0x3F,
+    0x1D, 0x42, 0x05, 0x42, 0x02, 0x42, 0x09, 0x42, 0x0A, 0x44, 0x01, 0x42, 0x06, 0x43, 0x07, 0x44,
+    0x05, 0x49, 0x0F, 0x44, 0x06, 0x44, 0x01, 0x42, 0x04, 0x42, 0x14, 0x44, 0x01, 0x42, 0x03, 0x42,
+    0x04, 0x42, 0x0E, 0x42, 0x01, 0x43, 0x07, 0x44, 0x06, 0x44, 0x01, 0x42, 0x06, 0x45, 0x05, 0x44,
+    0x05, 0x42, 0x04, 0x42, 0x3F, 0x28, 0x42, 0x09, 0x42, 0x16, 0x43, 0x00, 0x1A, 0x01, 0x42, 0x09,
+    0x42, 0x14, 0x45, 0x00, 0x1A, 0x01, 0x42, 0x09, 0x42, 0x14, 0x43, 0x00, 0xB9, 0x08, 0x42, 0x01,
+    0x43, 0x00, 0x3A, 0x01, 0x47, 0x06, 0x44, 0x05, 0x42, 0x04, 0x42, 0x03, 0x42, 0x02, 0x43, 0x11,
+    0x44, 0x07, 0x44, 0x04, 0x42, 0x01, 0x43, 0x01, 0x42, 0x02, 0x42, 0x01, 0x43, 0x01, 0x42, 0x05,
+    0x44, 0x05, 0x42, 0x01, 0x44, 0x06, 0x44, 0x07, 0x44, 0x05, 0x42, 0x02, 0x43, 0x3F, 0x3F, 0x2C,
+    0x43, 0x02, 0x43, 0x04, 0x46, 0x04, 0x42, 0x04, 0x42, 0x04, 0x47, 0x0F, 0x46, 0x05, 0x46, 0x03,
+    0x4A, 0x01, 0x4A, 0x03, 0x46, 0x04, 0x48, 0x04, 0x46, 0x05, 0x46, 0x05, 0x47, 0x3F, 0x3F, 0x2B,
+    0x42, 0x04, 0x42, 0x03, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42, 0x04, 0x43, 0x02, 0x41, 0x0F,
+    0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x02, 0x42, 0x02, 0x43, 0x01, 0x42, 0x01, 0x42, 0x02,
+    0x43, 0x01, 0x42, 0x02, 0x43, 0x02, 0x42, 0x04, 0x43, 0x03, 0x42, 0x03, 0x43, 0x02, 0x43, 0x03,
+    0x43, 0x02, 0x42, 0x05, 0x43, 0x02, 0x41, 0x3F, 0x3F, 0x2C, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x02,
+    0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x3F, 0x3F, 0x30,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x09,
+    0x42, 0x04, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
+    0x48, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x09, 0x48, 0x04, 0x42, 0x3F, 0x3F, 0x30, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x09, 0x42, 0x04,
+    0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x48, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x09, 0x48, 0x04, 0x42, 0x3F, 0x3F, 0x30, 0x43, 0x02, 0x43, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x09,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x0A, 0x42, 0x3F, 0x3F, 0x30, 0x47, 0x04,
+    0x43, 0x02, 0x43, 0x03, 0x42, 0x03, 0x43, 0x04, 0x42, 0x13, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02,
+    0x43, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x43, 0x03,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x04, 0x42, 0x3F,
+    0x3F, 0x30, 0x42, 0x01, 0x43, 0x06, 0x46, 0x04, 0x48, 0x04, 0x42, 0x14, 0x46, 0x05, 0x46, 0x03,
+    0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x02, 0x42, 0x03, 0x46, 0x04, 0x42, 0x04,
+    0x42, 0x04, 0x46, 0x05, 0x46, 0x05, 0x42, 0x3F, 0x3F, 0x30, 0x42, 0x0B, 0x44, 0x06, 0x44, 0x01,
+    0x42, 0x04, 0x42, 0x15, 0x44, 0x07, 0x44, 0x04, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02,
+    0x42, 0x02, 0x42, 0x04, 0x44, 0x05, 0x42, 0x04, 0x42, 0x05, 0x44, 0x07, 0x44, 0x06, 0x42, 0x3F,
+    0x3F, 0x30, 0x42, 0x00, 0x3E, 0x01, 0x42, 0x00, 0x3E, 0x01, 0x42, 0x00, 0xFE, 0x1D, 0xC5, 0x3F,
+    0x09, 0xC2, 0x3F, 0x04, 0xC2, 0x3F, 0x3F, 0x2E, 0xC6, 0x3F, 0x08, 0xC2, 0x3F, 0x04, 0xC2, 0x3F,
+    0x3F, 0x2E, 0xC2, 0x03, 0xC2, 0x3F, 0x07, 0xC2, 0x3F, 0x04, 0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x03,
+    0xC2, 0x3F, 0x07, 0xC2, 0x3F, 0x04, 0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x03, 0xC2, 0x06, 0xC4, 0x05,
+    0xC2, 0x01, 0xC4, 0x04, 0xC2, 0x01, 0xC4, 0x06, 0xC4, 0x12, 0xC4, 0x05, 0xC2, 0x01, 0xC4, 0x06,
+    0xC5, 0x04, 0xC2, 0x01, 0xC4, 0x06, 0xC4, 0x07, 0xC4, 0x13, 0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x03,
+    0xC2, 0x05, 0xC6, 0x04, 0xC8, 0x03, 0xC8, 0x04, 0xC6, 0x10, 0xC6, 0x04, 0xC8, 0x04, 0xC7, 0x03,
+    0xC8, 0x04, 0xC6, 0x05, 0xC6, 0x12, 0xC2, 0x3F, 0x3F, 0x2E, 0xC6, 0x05, 0xC3, 0x02, 0xC3, 0x03,
+    0xC3, 0x03, 0xC2, 0x03, 0xC3, 0x03, 0xC2, 0x03, 0xC3, 0x02, 0xC2, 0x0F, 0xC3, 0x02, 0xC3, 0x03,
+    0xC3, 0x03, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC3, 0x03, 0xC2, 0x03, 0xC3, 0x02, 0xC3, 0x03,
+    0xC3, 0x02, 0xC2, 0x12, 0xC2, 0x3F, 0x3F, 0x2E, 0xC6, 0x05, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04,
+    0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x0E, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04,
+    0xC2, 0x09, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x11,
+    0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03,
+    0xC2, 0x04, 0xC2, 0x03, 0xC8, 0x0E, 0xC2, 0x09, 0xC2, 0x04, 0xC2, 0x05, 0xC6, 0x03, 0xC2, 0x04,
+    0xC2, 0x03, 0xC2, 0x09, 0xC8, 0x11, 0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04,
+    0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC8, 0x0E, 0xC2, 0x09, 0xC2, 0x04,
+    0xC2, 0x04, 0xC7, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x09, 0xC8, 0x11, 0xC2, 0x3F, 0x3F, 0x2E,
+    0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03,
+    0xC2, 0x14, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04,
+    0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x17, 0xC2, 0x3F, 0x3F, 0x2E, 0xC2, 0x03, 0xC3, 0x03,
+    0xC3, 0x02, 0xC3, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC3, 0x03, 0xC2, 0x0E,
+    0xC3, 0x02, 0xC3, 0x03, 0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x03, 0xC3, 0x03, 0xC2, 0x04, 0xC2, 0x03,
+    0xC3, 0x02, 0xC3, 0x03, 0xC3, 0x03, 0xC2, 0x00, 0xBF, 0x00, 0xC7, 0x05, 0xC6, 0x04, 0xC2, 0x04,
+    0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x04, 0xC6, 0x10, 0xC6, 0x04, 0xC2, 0x04, 0xC2, 0x03, 0xC8, 0x03,
+    0xC2, 0x04, 0xC2, 0x04, 0xC6, 0x05, 0xC6, 0x12, 0xC2, 0x3F, 0x3F, 0x2E, 0xC6, 0x07, 0xC4, 0x05,
+    0xC2, 0x04, 0xC2, 0x03, 0xC2, 0x04, 0xC2, 0x05, 0xC4, 0x12, 0xC4, 0x05, 0xC2, 0x04, 0xC2, 0x04,
+    0xC3, 0x03, 0xC2, 0x02, 0xC2, 0x04, 0xC2, 0x05, 0xC4, 0x07, 0xC4, 0x13, 0xC2, 0x00, 0x9B, 0x1F
+};
+
+static const uint16_t palette_regles[] = {0x07FF, 0xFFFF, 0x0000};
+
+static const uint8_t donnees_regles[] = {
+    0x00, 0xE3, 0x0C, 0x4B, 0x3F, 0x45, 0x28, 0x45, 0x00, 0xCA, 0x00, 0x45, 0x3F, 0x45, 0x28, 0x45,
+    0x00, 0xCA, 0x00, 0x45, 0x3F, 0x45, 0x00, 0xC2, 0x00, 0x4A, 0x2B, 0x45, 0x3F, 0x45, 0x00, 0xC2,
+    0x00, 0x4C, 0x29, 0x45, 0x3F, 0x45, 0x00, 0xC2, 0x00, 0x44, 0x03, 0x46, 0x28, 0x45, 0x3F, 0x45,
+    0x00, 0xC2, 0x00, 0x44, 0x04, 0x45, 0x07, 0x47, 0x08, 0x46, 0x01, 0x44, 0x07, 0x45, 0x0A, 0x47,
+    0x08, 0x49, 0x17, 0x4B, 0x02, 0x44, 0x05, 0x44, 0x13, 0x4B, 0x09, 0x47, 0x05, 0x44, 0x05, 0x44,
+    0x3F, 0x34, 0x44, 0x05, 0x44, 0x05, 0x4A, 0x05, 0x4D, 0x07, 0x45, 0x08, 0x4A, 0x05, 0x4C, 0x14,
+    0x4D, 0x02, 0x44, 0x05, 0x44, 0x13, 0x4B, 0x07, 0x4A, 0x04, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44,
+    0x05, 0x44, 0x04, 0x45, 0x02, 0x45, 0x03, 0x45, 0x02, 0x47, 0x07, 0x45, 0x07, 0x45, 0x02, 0x45,
+    0x04, 0x44, 0x05, 0x43, 0x13, 0x45, 0x03, 0x46, 0x02, 0x44, 0x05, 0x44, 0x19, 0x45, 0x06, 0x45,
+    0x02, 0x45, 0x03, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44, 0x04, 0x45, 0x03, 0x45, 0x04, 0x44, 0x03,
+    0x44, 0x05, 0x45, 0x07, 0x45, 0x06, 0x45, 0x04, 0x44, 0x03, 0x45, 0x1B, 0x44, 0x05, 0x45, 0x02,
+    0x44, 0x05, 0x44, 0x19, 0x45, 0x05, 0x45, 0x04, 0x44, 0x03, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44,
+    0x04, 0x44, 0x04, 0x44, 0x05, 0x45, 0x01, 0x45, 0x05, 0x45, 0x07, 0x45, 0x06, 0x44, 0x05, 0x45,
+    0x02, 0x45, 0x1A, 0x45, 0x05, 0x45, 0x02, 0x44, 0x05, 0x44, 0x19, 0x45, 0x05, 0x44, 0x05, 0x45,
+    0x02, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44, 0x02, 0x46, 0x03, 0x45, 0x05, 0x45, 0x01, 0x45, 0x05,
+    0x45, 0x07, 0x45, 0x05, 0x45, 0x05, 0x45, 0x02, 0x46, 0x19, 0x45, 0x05, 0x45, 0x02, 0x44, 0x05,
+    0x44, 0x19, 0x45, 0x04, 0x45, 0x05, 0x45, 0x02, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x4A, 0x05, 0x4F,
+    0x01, 0x44, 0x06, 0x45, 0x07, 0x45, 0x05, 0x4F, 0x03, 0x48, 0x16, 0x45, 0x05, 0x45, 0x02, 0x44,
+    0x05, 0x44, 0x19, 0x45, 0x04, 0x4F, 0x02, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x49, 0x06, 0x4F, 0x01,
+    0x44, 0x06, 0x45, 0x07, 0x45, 0x05, 0x4F, 0x05, 0x49, 0x13, 0x44, 0x06, 0x45, 0x02, 0x44, 0x05,
+    0x44, 0x19, 0x45, 0x04, 0x4F, 0x02, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44, 0x01, 0x45, 0x05, 0x45,
+    0x0B, 0x44, 0x06, 0x45, 0x07, 0x45, 0x05, 0x45, 0x12, 0x47, 0x12, 0x44, 0x06, 0x45, 0x02, 0x44,
+    0x05, 0x44, 0x19, 0x45, 0x04, 0x45, 0x0C, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44, 0x02, 0x45, 0x04,
+    0x45, 0x0B, 0x45, 0x05, 0x45, 0x07, 0x45, 0x05, 0x45, 0x14, 0x45, 0x12, 0x45, 0x05, 0x45, 0x02,
+    0x44, 0x05, 0x44, 0x19, 0x45, 0x04, 0x45, 0x0C, 0x44, 0x05, 0x44, 0x3F, 0x34, 0x44, 0x03, 0x45,
+    0x04, 0x44, 0x0B, 0x45, 0x05, 0x45, 0x07, 0x45, 0x06, 0x44, 0x15, 0x44, 0x12, 0x45, 0x05, 0x45,
+    0x02, 0x44, 0x04, 0x45, 0x19, 0x45, 0x05, 0x44, 0x0C, 0x44, 0x04, 0x45, 0x3F, 0x34, 0x44, 0x04,
+    0x45, 0x03, 0x45, 0x0B, 0x44, 0x04, 0x46, 0x07, 0x45, 0x06, 0x45, 0x14, 0x44, 0x13, 0x44, 0x04,
+    0x46, 0x02, 0x44, 0x03, 0x46, 0x19, 0x45, 0x05, 0x45, 0x0B, 0x44, 0x03, 0x46, 0x3F, 0x34, 0x44,
+    0x05, 0x44, 0x04, 0x45, 0x05, 0x43, 0x02, 0x45, 0x02, 0x47, 0x07, 0x45, 0x07, 0x45, 0x05, 0x43,
+    0x02, 0x44, 0x04, 0x45, 0x13, 0x45, 0x02, 0x47, 0x02, 0x45, 0x01, 0x47, 0x19, 0x45, 0x06, 0x45,
+    0x05, 0x43, 0x02, 0x45, 0x01, 0x47, 0x3F, 0x34, 0x44, 0x05, 0x45, 0x04, 0x4C, 0x03, 0x4D, 0x07,
+    0x45, 0x08, 0x4C, 0x02, 0x4C, 0x15, 0x4D, 0x03, 0x4C, 0x19, 0x45, 0x07, 0x4C, 0x03, 0x4C, 0x3F,
+    0x34, 0x44, 0x06, 0x44, 0x06, 0x49, 0x05, 0x46, 0x01, 0x45, 0x07, 0x45, 0x0A, 0x49, 0x04, 0x49,
+    0x18, 0x46, 0x01, 0x45, 0x04, 0x46, 0x01, 0x44, 0x19, 0x45, 0x09, 0x49, 0x05, 0x46, 0x01, 0x44,
+    0x3F, 0x3F, 0x1E, 0x44, 0x3F, 0x3A, 0x45, 0x00, 0xBE, 0x00, 0x44, 0x3F, 0x3A, 0x45, 0x00, 0xBE,
+    0x00, 0x44, 0x3F, 0x3A, 0x44, 0x3F, 0x3F, 0x38, 0x43, 0x04, 0x45, 0x3F, 0x34, 0x43, 0x03, 0x45,
+    0x3F, 0x3F, 0x38, 0x4B, 0x3F, 0x35, 0x4A, 0x00, 0x49, 0x13, 0x82, 0x05, 0x82, 0x3F, 0x28, 0x84,
+    0x07, 0x84, 0x11, 0x85, 0x09, 0x82, 0x3F, 0x0E, 0x82, 0x3F, 0x12, 0x82, 0x05, 0x82, 0x3F, 0x27,
+    0x86, 0x05, 0x86, 0x10, 0x85, 0x09, 0x82, 0x3F, 0x0E, 0x82, 0x3F, 0x12, 0x82, 0x05, 0x82, 0x3F,
+    0x26, 0x83, 0x02, 0x83, 0x04, 0x82, 0x02, 0x82, 0x13, 0x82, 0x3F, 0x19, 0x82, 0x3F, 0x13, 0x82,
+    0x03, 0x82, 0x3F, 0x27, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x12, 0x82, 0x3F, 0x19, 0x82,
+    0x3F, 0x13, 0x82, 0x03, 0x82, 0x05, 0x84, 0x05, 0x82, 0x04, 0x82, 0x05, 0x84, 0x12, 0x85, 0x04,
+    0x82, 0x05, 0x82, 0x04, 0x84, 0x05, 0x89, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x12,
+    0x82, 0x06, 0x85, 0x07, 0x85, 0x06, 0x84, 0x07, 0x84, 0x07, 0x84, 0x07, 0x84, 0x12, 0x83, 0x01,
+    0x82, 0x05, 0x84, 0x3F, 0x0A, 0x82, 0x03, 0x82, 0x04, 0x86, 0x04, 0x82, 0x04, 0x82, 0x04, 0x87,
+    0x0F, 0x87, 0x04, 0x82, 0x03, 0x82, 0x04, 0x86, 0x04, 0x89, 0x13, 0x82, 0x03, 0x82, 0x04, 0x82,
+    0x12, 0x82, 0x06, 0x85, 0x06, 0x87, 0x04, 0x87, 0x04, 0x87, 0x04, 0x86, 0x05, 0x87, 0x0F, 0x87,
+    0x04, 0x86, 0x3F, 0x0A, 0x82, 0x01, 0x82, 0x04, 0x83, 0x02, 0x83, 0x03, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x03, 0x83, 0x02, 0x82, 0x0A,
+    0x82, 0x13, 0x82, 0x04, 0x82, 0x01, 0x82, 0x01, 0x82, 0x12, 0x82, 0x09, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x0E, 0x83, 0x02, 0x83, 0x03, 0x83, 0x02, 0x82, 0x3F, 0x0A, 0x82, 0x01, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x1A, 0x82, 0x04, 0x82, 0x03, 0x82, 0x03, 0x82,
+    0x04, 0x82, 0x08, 0x82, 0x13, 0x82, 0x05, 0x82, 0x01, 0x82, 0x01, 0x82, 0x12, 0x82, 0x09, 0x82,
+    0x0B, 0x82, 0x03, 0x82, 0x09, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x82, 0x14, 0x82, 0x04, 0x82,
+    0x03, 0x82, 0x04, 0x82, 0x3F, 0x09, 0x82, 0x01, 0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x87, 0x11, 0x86, 0x05, 0x82, 0x01, 0x82, 0x04, 0x88, 0x07, 0x82, 0x13, 0x82, 0x06,
+    0x82, 0x04, 0x82, 0x12, 0x82, 0x09, 0x82, 0x07, 0x86, 0x03, 0x87, 0x04, 0x87, 0x04, 0x88, 0x03,
+    0x87, 0x0F, 0x82, 0x04, 0x82, 0x03, 0x88, 0x3F, 0x09, 0x82, 0x01, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x03, 0x82, 0x04, 0x82, 0x04, 0x87, 0x0F, 0x87, 0x05, 0x82, 0x01, 0x82, 0x04, 0x88, 0x06, 0x82,
+    0x13, 0x82, 0x07, 0x82, 0x04, 0x82, 0x12, 0x82, 0x09, 0x82, 0x06, 0x87, 0x04, 0x87, 0x04, 0x87,
+    0x03, 0x88, 0x04, 0x87, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x88, 0x3F, 0x0A, 0x83, 0x05, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x09, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x05, 0x82, 0x01, 0x82, 0x04,
+    0x82, 0x0B, 0x82, 0x13, 0x82, 0x08, 0x82, 0x04, 0x82, 0x12, 0x82, 0x09, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x09, 0x82, 0x09, 0x82, 0x03, 0x82, 0x0F, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x82, 0x3F,
+    0x10, 0x83, 0x05, 0x83, 0x02, 0x83, 0x03, 0x82, 0x03, 0x83, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x82,
+    0x03, 0x83, 0x06, 0x83, 0x05, 0x83, 0x03, 0x82, 0x04, 0x82, 0x13, 0x82, 0x0A, 0x82, 0x02, 0x82,
+    0x13, 0x82, 0x09, 0x82, 0x05, 0x82, 0x03, 0x83, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82,
+    0x03, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82,
+    0x3F, 0x0A, 0x83, 0x06, 0x86, 0x04, 0x88, 0x03, 0x87, 0x0F, 0x88, 0x06, 0x83, 0x06, 0x86, 0x04,
+    0x89, 0x0D, 0x88, 0x04, 0x86, 0x13, 0x82, 0x09, 0x82, 0x05, 0x88, 0x03, 0x87, 0x04, 0x87, 0x05,
+    0x86, 0x04, 0x87, 0x10, 0x87, 0x04, 0x86, 0x3F, 0x0C, 0x81, 0x08, 0x84, 0x06, 0x84, 0x01, 0x82,
+    0x05, 0x84, 0x11, 0x83, 0x03, 0x82, 0x06, 0x82, 0x07, 0x84, 0x05, 0x89, 0x0D, 0x88, 0x05, 0x84,
+    0x14, 0x82, 0x09, 0x82, 0x06, 0x83, 0x03, 0x82, 0x04, 0x84, 0x07, 0x84, 0x07, 0x84, 0x07, 0x84,
+    0x12, 0x83, 0x01, 0x82, 0x05, 0x84, 0x00, 0xE9, 0x07, 0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85,
+    0x3F, 0x19, 0x82, 0x0E, 0x82, 0x3F, 0x3F, 0x31, 0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85, 0x13,
+    0x81, 0x3F, 0x05, 0x82, 0x0E, 0x82, 0x17, 0x81, 0x3F, 0x3F, 0x19, 0x82, 0x18, 0x82, 0x09, 0x82,
+    0x12, 0x82, 0x3F, 0x05, 0x82, 0x0E, 0x82, 0x16, 0x82, 0x3F, 0x3F, 0x19, 0x82, 0x18, 0x82, 0x09,
+    0x82, 0x12, 0x82, 0x3F, 0x05, 0x82, 0x0E, 0x82, 0x16, 0x82, 0x3F, 0x3F, 0x19, 0x82, 0x01, 0x83,
+    0x06, 0x85, 0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x05, 0x87, 0x06, 0x84, 0x12, 0x85, 0x04, 0x82,
+    0x04, 0x82, 0x10, 0x83, 0x01, 0x82, 0x05, 0x84, 0x05, 0x82, 0x01, 0x83, 0x05, 0x82, 0x04, 0x82,
+    0x03, 0x87, 0x3F, 0x3F, 0x16, 0x87, 0x05, 0x85, 0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x04, 0x87,
+    0x05, 0x87, 0x0F, 0x87, 0x03, 0x82, 0x04, 0x82, 0x0F, 0x87, 0x04, 0x86, 0x04, 0x87, 0x04, 0x82,
+    0x04, 0x82, 0x03, 0x87, 0x3F, 0x3F, 0x16, 0x83, 0x02, 0x83, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82,
+    0x05, 0x83, 0x02, 0x82, 0x06, 0x82, 0x07, 0x82, 0x04, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x82,
+    0x04, 0x82, 0x0E, 0x83, 0x02, 0x83, 0x03, 0x83, 0x02, 0x82, 0x04, 0x83, 0x02, 0x83, 0x03, 0x82,
+    0x04, 0x82, 0x05, 0x82, 0x3F, 0x3F, 0x19, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82,
+    0x05, 0x82, 0x04, 0x82, 0x05, 0x82, 0x07, 0x82, 0x1A, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x82,
+    0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82,
+    0x3F, 0x3F, 0x19, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82,
+    0x07, 0x87, 0x11, 0x86, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x88, 0x03, 0x82,
+    0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x3F, 0x3F, 0x19, 0x82, 0x04, 0x82, 0x07, 0x82,
+    0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82, 0x08, 0x87, 0x0F, 0x87, 0x03, 0x82, 0x04, 0x82,
+    0x0E, 0x82, 0x04, 0x82, 0x03, 0x88, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82,
+    0x3F, 0x3F, 0x19, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x82, 0x0B, 0x82,
+    0x0D, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x82,
+    0x09, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x3F, 0x3F, 0x19, 0x83, 0x02, 0x83,
+    0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x83, 0x03, 0x82, 0x05, 0x82, 0x07, 0x82, 0x04, 0x82,
+    0x0E, 0x82, 0x03, 0x83, 0x03, 0x82, 0x03, 0x83, 0x0E, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82,
+    0x03, 0x83, 0x02, 0x83, 0x03, 0x82, 0x03, 0x83, 0x05, 0x82, 0x3F, 0x3F, 0x19, 0x87, 0x08, 0x82,
+    0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x06, 0x86, 0x03, 0x87, 0x0F, 0x88, 0x03, 0x88, 0x0F, 0x87,
+    0x04, 0x86, 0x04, 0x87, 0x04, 0x88, 0x05, 0x86, 0x06, 0x82, 0x3F, 0x3F, 0x0D, 0x82, 0x01, 0x83,
+    0x09, 0x82, 0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x08, 0x85, 0x05, 0x84, 0x11, 0x83, 0x03, 0x82,
+    0x03, 0x84, 0x01, 0x82, 0x10, 0x83, 0x01, 0x82, 0x05, 0x84, 0x05, 0x82, 0x01, 0x83, 0x06, 0x84,
+    0x01, 0x82, 0x06, 0x85, 0x06, 0x82, 0x00, 0x6A, 0x14, 0x86, 0x3F, 0x01, 0x82, 0x3D, 0x85, 0x26,
+    0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85, 0x3F, 0x2A, 0x87, 0x33, 0x81, 0x0B, 0x82, 0x3D, 0x85,
+    0x26, 0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85, 0x13, 0x81, 0x3F, 0x16, 0x82, 0x03, 0x83, 0x31,
+    0x82, 0x3F, 0x0E, 0x82, 0x26, 0x82, 0x18, 0x82, 0x09, 0x82, 0x12, 0x82, 0x3F, 0x16, 0x82, 0x04,
+    0x82, 0x0E, 0x82, 0x01, 0x83, 0x1D, 0x82, 0x3F, 0x0E, 0x82, 0x26, 0x82, 0x18, 0x82, 0x09, 0x82,
+    0x12, 0x82, 0x3F, 0x16, 0x82, 0x04, 0x82, 0x05, 0x84, 0x05, 0x87, 0x06, 0x85, 0x04, 0x82, 0x02,
+    0x83, 0x04, 0x87, 0x05, 0x85, 0x07, 0x84, 0x07, 0x84, 0x07, 0x84, 0x05, 0x89, 0x11, 0x82, 0x07,
+    0x84, 0x07, 0x84, 0x10, 0x82, 0x01, 0x83, 0x06, 0x85, 0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x05,
+    0x87, 0x06, 0x84, 0x3F, 0x09, 0x82, 0x03, 0x83, 0x04, 0x86, 0x04, 0x83, 0x02, 0x83, 0x04, 0x87,
+    0x04, 0x87, 0x03, 0x87, 0x05, 0x85, 0x06, 0x87, 0x04, 0x87, 0x04, 0x86, 0x04, 0x89, 0x11, 0x82,
+    0x06, 0x86, 0x05, 0x87, 0x0E, 0x87, 0x05, 0x85, 0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x04, 0x87,
+    0x05, 0x87, 0x3F, 0x07, 0x87, 0x04, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x04, 0x83, 0x02, 0x81, 0x06, 0x82, 0x0B, 0x82, 0x05, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x83, 0x02, 0x82, 0x0A, 0x82, 0x12, 0x82, 0x05, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x0E, 0x83, 0x02, 0x83, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x83, 0x02, 0x82, 0x06,
+    0x82, 0x07, 0x82, 0x04, 0x82, 0x3F, 0x07, 0x86, 0x05, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82,
+    0x09, 0x82, 0x04, 0x82, 0x0A, 0x82, 0x0B, 0x82, 0x05, 0x82, 0x09, 0x82, 0x09, 0x82, 0x04, 0x82,
+    0x08, 0x82, 0x13, 0x82, 0x05, 0x82, 0x04, 0x82, 0x03, 0x82, 0x14, 0x82, 0x04, 0x82, 0x07, 0x82,
+    0x09, 0x82, 0x09, 0x82, 0x05, 0x82, 0x04, 0x82, 0x05, 0x82, 0x07, 0x82, 0x3F, 0x0D, 0x82, 0x02,
+    0x82, 0x05, 0x88, 0x03, 0x82, 0x04, 0x82, 0x05, 0x86, 0x04, 0x82, 0x0A, 0x82, 0x0B, 0x82, 0x05,
+    0x87, 0x04, 0x87, 0x04, 0x88, 0x07, 0x82, 0x14, 0x82, 0x05, 0x88, 0x03, 0x87, 0x0F, 0x82, 0x04,
+    0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82, 0x07, 0x87, 0x3F, 0x08, 0x82,
+    0x03, 0x82, 0x04, 0x88, 0x03, 0x82, 0x04, 0x82, 0x04, 0x87, 0x04, 0x82, 0x0A, 0x82, 0x0B, 0x82,
+    0x06, 0x87, 0x04, 0x87, 0x03, 0x88, 0x06, 0x82, 0x15, 0x82, 0x05, 0x88, 0x04, 0x87, 0x0E, 0x82,
+    0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82, 0x08, 0x87, 0x3F, 0x07,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x09, 0x83, 0x02, 0x83, 0x03, 0x82, 0x04, 0x82, 0x04, 0x82, 0x0A,
+    0x82, 0x0B, 0x82, 0x0B, 0x82, 0x09, 0x82, 0x03, 0x82, 0x0B, 0x82, 0x16, 0x82, 0x05, 0x82, 0x0F,
+    0x82, 0x0E, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x82, 0x0B, 0x82, 0x0D,
+    0x82, 0x3F, 0x07, 0x82, 0x04, 0x82, 0x03, 0x83, 0x03, 0x82, 0x03, 0x87, 0x04, 0x82, 0x03, 0x83,
+    0x04, 0x82, 0x0A, 0x82, 0x0B, 0x82, 0x05, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83,
+    0x03, 0x82, 0x04, 0x82, 0x17, 0x82, 0x05, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0E, 0x83,
+    0x02, 0x83, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x83, 0x03, 0x82, 0x05, 0x82, 0x07, 0x82,
+    0x04, 0x82, 0x3F, 0x07, 0x82, 0x04, 0x82, 0x04, 0x86, 0x04, 0x82, 0x01, 0x83, 0x05, 0x88, 0x04,
+    0x82, 0x0A, 0x86, 0x07, 0x82, 0x05, 0x87, 0x04, 0x87, 0x05, 0x86, 0x04, 0x89, 0x11, 0x82, 0x06,
+    0x86, 0x04, 0x87, 0x0F, 0x87, 0x08, 0x82, 0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x06, 0x86, 0x03,
+    0x87, 0x3F, 0x08, 0x82, 0x05, 0x82, 0x04, 0x84, 0x05, 0x82, 0x0A, 0x83, 0x03, 0x82, 0x03, 0x82,
+    0x0B, 0x85, 0x07, 0x82, 0x07, 0x84, 0x07, 0x84, 0x07, 0x84, 0x05, 0x89, 0x11, 0x82, 0x07, 0x84,
+    0x07, 0x84, 0x10, 0x82, 0x01, 0x83, 0x09, 0x82, 0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x08, 0x85,
+    0x05, 0x84, 0x3F, 0x1F, 0x82, 0x00, 0x3E, 0x01, 0x82, 0x00, 0x3E, 0x01, 0x82, 0x00, 0x36, 0x05,
+    0x85, 0x00, 0x3B, 0x01, 0x85, 0x29, 0x81, 0x00, 0x14, 0x01, 0x82, 0x28, 0x82, 0x00, 0x14, 0x01,
+    0x82, 0x28, 0x82, 0x1D, 0x82, 0x01, 0x83, 0x05, 0x82, 0x01, 0x83, 0x3F, 0x3F, 0x3A, 0x84, 0x05,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x02, 0x83, 0x13, 0x82, 0x07, 0x84, 0x07, 0x84, 0x10, 0x87, 0x04,
+    0x82, 0x02, 0x83, 0x06, 0x85, 0x04, 0x87, 0x04, 0x87, 0x06, 0x84, 0x07, 0x84, 0x3F, 0x3F, 0x23,
+    0x87, 0x03, 0x82, 0x04, 0x82, 0x04, 0x87, 0x12, 0x82, 0x06, 0x86, 0x05, 0x87, 0x0E, 0x87, 0x05,
+    0x87, 0x04, 0x87, 0x03, 0x83, 0x02, 0x83, 0x03, 0x83, 0x02, 0x83, 0x04, 0x86, 0x05, 0x87, 0x3F,
+    0x3F, 0x20, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x04, 0x83, 0x02, 0x81, 0x13, 0x82, 0x05,
+    0x83, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x10, 0x82, 0x08, 0x83, 0x02, 0x81, 0x04, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x3F, 0x3F, 0x20, 0x82, 0x09, 0x82, 0x04, 0x82, 0x04, 0x82, 0x17, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x16, 0x82, 0x08, 0x82, 0x0E, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x3F, 0x3F, 0x26, 0x87, 0x04, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x17, 0x82, 0x05, 0x88, 0x03, 0x87, 0x11, 0x82, 0x08, 0x82, 0x0A, 0x86, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x88, 0x03, 0x87, 0x3F, 0x3F, 0x22, 0x87, 0x03, 0x82, 0x04,
+    0x82, 0x04, 0x82, 0x17, 0x82, 0x05, 0x88, 0x04, 0x87, 0x10, 0x82, 0x08, 0x82, 0x09, 0x87, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x88, 0x04, 0x87, 0x3F, 0x3F, 0x26, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x04, 0x82, 0x17, 0x82, 0x05, 0x82, 0x0F, 0x82, 0x10, 0x82, 0x08, 0x82, 0x08,
+    0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x83, 0x03, 0x83, 0x02, 0x83, 0x03, 0x82, 0x0F, 0x82, 0x3F,
+    0x3F, 0x20, 0x82, 0x04, 0x82, 0x03, 0x82, 0x03, 0x83, 0x04, 0x82, 0x17, 0x82, 0x05, 0x83, 0x03,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x10, 0x82, 0x08, 0x82, 0x08, 0x82, 0x03, 0x83, 0x03, 0x87, 0x04,
+    0x87, 0x04, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x3F, 0x3F, 0x20, 0x87, 0x04, 0x88, 0x04,
+    0x82, 0x17, 0x82, 0x06, 0x86, 0x04, 0x87, 0x11, 0x86, 0x04, 0x82, 0x08, 0x88, 0x03, 0x82, 0x01,
+    0x83, 0x05, 0x82, 0x01, 0x83, 0x06, 0x86, 0x04, 0x87, 0x07, 0x82, 0x3F, 0x3F, 0x1A, 0x84, 0x06,
+    0x84, 0x01, 0x82, 0x04, 0x82, 0x17, 0x82, 0x07, 0x84, 0x07, 0x84, 0x13, 0x85, 0x04, 0x82, 0x09,
+    0x83, 0x03, 0x82, 0x02, 0x82, 0x09, 0x82, 0x0B, 0x84, 0x07, 0x84, 0x08, 0x82, 0x00, 0x0F, 0x01,
+    0x82, 0x09, 0x82, 0x00, 0x33, 0x01, 0x82, 0x09, 0x82, 0x00, 0x33, 0x01, 0x82, 0x09, 0x82, 0x00,
+    0xE8, 0x10, 0x84, 0x05, 0x82, 0x3F, 0x2D, 0x82, 0x2B, 0x85, 0x3F, 0x3F, 0x18, 0x86, 0x04, 0x82,
+    0x3F, 0x2D, 0x82, 0x2B, 0x85, 0x3F, 0x3F, 0x18, 0x82, 0x03, 0x82, 0x03, 0x82, 0x3F, 0x2D, 0x82,
+    0x2E, 0x82, 0x3F, 0x3F, 0x17, 0x82, 0x04, 0x82, 0x03, 0x82, 0x16, 0x83, 0x01, 0x82, 0x3F, 0x11,
+    0x82, 0x2E, 0x82, 0x3F, 0x3F, 0x17, 0x82, 0x09, 0x82, 0x01, 0x84, 0x06, 0x85, 0x05, 0x87, 0x03,
+    0x82, 0x04, 0x82, 0x05, 0x84, 0x0F, 0x82, 0x01, 0x83, 0x01, 0x82, 0x05, 0x85, 0x04, 0x82, 0x01,
+    0x84, 0x06, 0x84, 0x05, 0x82, 0x01, 0x84, 0x06, 0x84, 0x1F, 0x82, 0x07, 0x84, 0x07, 0x84, 0x3F,
+    0x3F, 0x01, 0x82, 0x09, 0x88, 0x04, 0x87, 0x03, 0x83, 0x02, 0x83, 0x03, 0x82, 0x04, 0x82, 0x04,
+    0x86, 0x0E, 0x8A, 0x03, 0x87, 0x03, 0x88, 0x04, 0x86, 0x04, 0x88, 0x04, 0x86, 0x1E, 0x82, 0x06,
+    0x86, 0x05, 0x87, 0x3F, 0x3E, 0x82, 0x09, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82,
+    0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x82, 0x0E, 0x82, 0x02, 0x83, 0x01, 0x82,
+    0x02, 0x82, 0x04, 0x82, 0x03, 0x83, 0x03, 0x82, 0x03, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82,
+    0x03, 0x83, 0x02, 0x82, 0x1E, 0x82, 0x05, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x3F, 0x3E,
+    0x82, 0x09, 0x82, 0x04, 0x82, 0x09, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x08, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x1D, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x3F, 0x3F, 0x05, 0x82, 0x09, 0x82, 0x04, 0x82, 0x05, 0x86, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x88, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x86, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x88, 0x1D, 0x82, 0x05, 0x88, 0x03,
+    0x87, 0x3F, 0x3F, 0x82, 0x09, 0x82, 0x04, 0x82, 0x04, 0x87, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82,
+    0x04, 0x82, 0x03, 0x88, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x87, 0x03, 0x82, 0x04, 0x82,
+    0x03, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x88, 0x1D, 0x82, 0x05, 0x88, 0x04, 0x87, 0x3F, 0x3E,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x83, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x13, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x23, 0x82, 0x05,
+    0x82, 0x0F, 0x82, 0x3F, 0x3F, 0x82, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x03, 0x83,
+    0x04, 0x87, 0x03, 0x82, 0x03, 0x83, 0x03, 0x83, 0x03, 0x82, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82,
+    0x02, 0x82, 0x03, 0x83, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x83, 0x03, 0x82, 0x04, 0x82,
+    0x03, 0x83, 0x03, 0x82, 0x1D, 0x82, 0x05, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x3F, 0x3F,
+    0x86, 0x04, 0x82, 0x04, 0x82, 0x03, 0x88, 0x05, 0x83, 0x01, 0x82, 0x03, 0x88, 0x04, 0x86, 0x0E,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x88, 0x03, 0x82, 0x04, 0x82, 0x04, 0x86, 0x04, 0x82, 0x04,
+    0x82, 0x04, 0x86, 0x07, 0x82, 0x15, 0x82, 0x06, 0x86, 0x04, 0x87, 0x3F, 0x3F, 0x02, 0x84, 0x05,
+    0x82, 0x04, 0x82, 0x04, 0x83, 0x03, 0x82, 0x08, 0x82, 0x04, 0x84, 0x01, 0x82, 0x05, 0x84, 0x0F,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x03, 0x82, 0x02, 0x82, 0x04, 0x82, 0x05, 0x84, 0x05,
+    0x82, 0x04, 0x82, 0x05, 0x84, 0x08, 0x82, 0x15, 0x82, 0x07, 0x84, 0x07, 0x84, 0x3F, 0x3F, 0x28,
+    0x82, 0x3F, 0x2B, 0x81, 0x00, 0xD3, 0x00, 0x82, 0x3F, 0x2B, 0x81, 0x00, 0xD3, 0x00, 0x82, 0x3F,
+    0x2A, 0x81, 0x00, 0x83, 0x04, 0x82, 0x3F, 0x3F, 0x2C, 0x82, 0x38, 0x82, 0x3F, 0x19, 0x82, 0x34,
+    0x81, 0x3F, 0x18, 0x81, 0x1D, 0x82, 0x22, 0x81, 0x15, 0x82, 0x3F, 0x3F, 0x0F, 0x82, 0x3F, 0x17,
+    0x82, 0x1D, 0x82, 0x21, 0x82, 0x15, 0x82, 0x3F, 0x3F, 0x0F, 0x82, 0x1D, 0x82, 0x01, 0x83, 0x05,
+    0x82, 0x01, 0x83, 0x28, 0x82, 0x1D, 0x82, 0x21, 0x82, 0x15, 0x82, 0x1C, 0x82, 0x01, 0x83, 0x01,
+    0x82, 0x05, 0x85, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x05, 0x82, 0x04, 0x85, 0x05, 0x85, 0x07,
+    0x84, 0x07, 0x84, 0x07, 0x84, 0x10, 0x87, 0x04, 0x82, 0x02, 0x83, 0x06, 0x85, 0x04, 0x87, 0x04,
+    0x87, 0x06, 0x84, 0x07, 0x84, 0x10, 0x87, 0x06, 0x84, 0x04, 0x82, 0x01, 0x83, 0x01, 0x82, 0x03,
+    0x82, 0x01, 0x83, 0x07, 0x84, 0x05, 0x82, 0x01, 0x84, 0x04, 0x87, 0x12, 0x82, 0x1C, 0x8A, 0x03,
+    0x87, 0x03, 0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x87, 0x04, 0x85, 0x06, 0x87, 0x04,
+    0x86, 0x05, 0x87, 0x0E, 0x87, 0x05, 0x87, 0x04, 0x87, 0x03, 0x83, 0x02, 0x83, 0x03, 0x83, 0x02,
+    0x83, 0x04, 0x86, 0x05, 0x87, 0x0E, 0x87, 0x05, 0x86, 0x03, 0x8A, 0x02, 0x87, 0x05, 0x86, 0x04,
+    0x88, 0x03, 0x87, 0x12, 0x82, 0x1C, 0x82, 0x02, 0x83, 0x01, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x07, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x03, 0x83, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x10, 0x82, 0x08, 0x83, 0x02, 0x81, 0x04,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02, 0x82, 0x04,
+    0x82, 0x04, 0x82, 0x10, 0x82, 0x07, 0x83, 0x02, 0x83, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x02,
+    0x83, 0x02, 0x83, 0x03, 0x83, 0x02, 0x82, 0x04, 0x83, 0x03, 0x82, 0x05, 0x82, 0x15, 0x82, 0x1C,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x08, 0x82, 0x03, 0x82, 0x04, 0x82, 0x04, 0x82, 0x03, 0x82, 0x09,
+    0x82, 0x07, 0x82, 0x05, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x82, 0x16, 0x82, 0x08, 0x82, 0x0E,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x16,
+    0x82, 0x07, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x15, 0x82, 0x1C, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x04, 0x86, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x01, 0x82, 0x06, 0x86, 0x07, 0x82, 0x05,
+    0x87, 0x04, 0x88, 0x03, 0x87, 0x11, 0x82, 0x08, 0x82, 0x0A, 0x86, 0x03, 0x82, 0x04, 0x82, 0x03,
+    0x82, 0x04, 0x82, 0x03, 0x88, 0x03, 0x87, 0x11, 0x82, 0x07, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03, 0x88, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x15,
+    0x82, 0x1C, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x87, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x01,
+    0x82, 0x05, 0x87, 0x07, 0x82, 0x06, 0x87, 0x03, 0x88, 0x04, 0x87, 0x10, 0x82, 0x08, 0x82, 0x09,
+    0x87, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x88, 0x04, 0x87, 0x10, 0x82, 0x07,
+    0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03, 0x88, 0x03,
+    0x82, 0x04, 0x82, 0x05, 0x82, 0x15, 0x82, 0x1C, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x82, 0x01, 0x82, 0x04, 0x82, 0x04, 0x82, 0x07, 0x82, 0x0B,
+    0x82, 0x03, 0x82, 0x0F, 0x82, 0x10, 0x82, 0x08, 0x82, 0x08, 0x82, 0x04, 0x82, 0x03, 0x83, 0x02,
+    0x83, 0x03, 0x83, 0x02, 0x83, 0x03, 0x82, 0x0F, 0x82, 0x10, 0x82, 0x07, 0x82, 0x04, 0x82, 0x02,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x03, 0x82, 0x09, 0x82, 0x04, 0x82, 0x05,
+    0x82, 0x15, 0x82, 0x1C, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x03, 0x82, 0x03,
+    0x83, 0x06, 0x83, 0x05, 0x82, 0x03, 0x83, 0x07, 0x82, 0x05, 0x82, 0x04, 0x82, 0x03, 0x83, 0x03,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x10, 0x82, 0x08, 0x82, 0x08, 0x82, 0x03, 0x83, 0x03, 0x87, 0x04,
+    0x87, 0x04, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x10, 0x82, 0x07, 0x83, 0x02, 0x83, 0x02,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x05, 0x82, 0x33, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x88, 0x03, 0x88, 0x06, 0x83, 0x05,
+    0x88, 0x07, 0x82, 0x05, 0x87, 0x05, 0x86, 0x04, 0x87, 0x11, 0x86, 0x04, 0x82, 0x08, 0x88, 0x03,
+    0x82, 0x01, 0x83, 0x05, 0x82, 0x01, 0x83, 0x06, 0x86, 0x04, 0x87, 0x11, 0x86, 0x04, 0x86, 0x03,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x87, 0x05, 0x86, 0x04, 0x82, 0x04, 0x82, 0x05, 0x86, 0x11,
+    0x82, 0x1C, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x03, 0x82, 0x03, 0x84, 0x01, 0x82, 0x07,
+    0x82, 0x06, 0x83, 0x03, 0x82, 0x06, 0x82, 0x07, 0x84, 0x07, 0x84, 0x07, 0x84, 0x13, 0x85, 0x04,
+    0x82, 0x09, 0x83, 0x03, 0x82, 0x02, 0x82, 0x09, 0x82, 0x0B, 0x84, 0x07, 0x84, 0x13, 0x85, 0x05,
+    0x84, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x83, 0x07, 0x84, 0x05, 0x82, 0x04,
+    0x82, 0x06, 0x85, 0x11, 0x82, 0x3F, 0x3F, 0x2E, 0x82, 0x09, 0x82, 0x00, 0x33, 0x01, 0x82, 0x09,
+    0x82, 0x00, 0x33, 0x01, 0x82, 0x09, 0x82, 0x00, 0xF7, 0x10, 0x84, 0x3F, 0x3F, 0x30, 0x82, 0x37,
+    0x82, 0x3F, 0x13, 0x86, 0x3F, 0x3F, 0x2F, 0x82, 0x37, 0x82, 0x3F, 0x13, 0x82, 0x03, 0x82, 0x00,
+    0xE5, 0x00, 0x82, 0x3F, 0x12, 0x82, 0x04, 0x82, 0x00, 0xE5, 0x00, 0x82, 0x3F, 0x12, 0x82, 0x0B,
+    0x84, 0x05, 0x82, 0x01, 0x84, 0x06, 0x84, 0x07, 0x84, 0x05, 0x82, 0x02, 0x83, 0x04, 0x82, 0x05,
+    0x82, 0x04, 0x84, 0x05, 0x89, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x82, 0x01, 0x84, 0x0E, 0x82, 0x01,
+    0x83, 0x01, 0x82, 0x05, 0x85, 0x04, 0x82, 0x04, 0x82, 0x04, 0x85, 0x04, 0x82, 0x01, 0x83, 0x01,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x10, 0x83, 0x01, 0x82, 0x05,
+    0x84, 0x3F, 0x09, 0x82, 0x0A, 0x86, 0x04, 0x88, 0x04, 0x87, 0x04, 0x86, 0x05, 0x87, 0x04, 0x82,
+    0x03, 0x82, 0x04, 0x86, 0x04, 0x89, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x88, 0x0D, 0x8A, 0x03, 0x87,
+    0x04, 0x82, 0x02, 0x82, 0x05, 0x85, 0x04, 0x8A, 0x02, 0x82, 0x04, 0x82, 0x02, 0x8A, 0x0E, 0x87,
+    0x04, 0x86, 0x3F, 0x08, 0x82, 0x09, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82, 0x03, 0x82, 0x04,
+    0x82, 0x03, 0x83, 0x02, 0x82, 0x05, 0x83, 0x02, 0x81, 0x05, 0x82, 0x03, 0x82, 0x03, 0x83, 0x02,
+    0x82, 0x0A, 0x82, 0x0E, 0x82, 0x04, 0x82, 0x03, 0x83, 0x03, 0x82, 0x0D, 0x82, 0x02, 0x83, 0x01,
+    0x82, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x02, 0x82, 0x08, 0x82, 0x04, 0x82, 0x02, 0x83, 0x01,
+    0x82, 0x02, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x0D, 0x83, 0x02, 0x83, 0x03,
+    0x83, 0x02, 0x82, 0x3F, 0x08, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82,
+    0x09, 0x82, 0x04, 0x82, 0x04, 0x82, 0x09, 0x82, 0x03, 0x82, 0x03, 0x82, 0x04, 0x82, 0x08, 0x82,
+    0x0F, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x08, 0x82,
+    0x05, 0x84, 0x09, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x02, 0x82,
+    0x02, 0x82, 0x02, 0x82, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x3F, 0x07, 0x82, 0x09,
+    0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x87, 0x04, 0x88, 0x04, 0x82, 0x0A, 0x82, 0x01,
+    0x82, 0x04, 0x88, 0x07, 0x82, 0x10, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x0D, 0x82, 0x02,
+    0x82, 0x02, 0x82, 0x04, 0x86, 0x06, 0x82, 0x0A, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x88, 0x3F,
+    0x07, 0x82, 0x09, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x04, 0x87, 0x03, 0x88, 0x04, 0x82,
+    0x0A, 0x82, 0x01, 0x82, 0x04, 0x88, 0x06, 0x82, 0x11, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82,
+    0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x87, 0x06, 0x82, 0x0A, 0x82, 0x04, 0x82, 0x02, 0x82,
+    0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x0D, 0x82, 0x04, 0x82,
+    0x03, 0x88, 0x3F, 0x07, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x09,
+    0x82, 0x03, 0x82, 0x0A, 0x82, 0x0A, 0x82, 0x01, 0x82, 0x04, 0x82, 0x0B, 0x82, 0x12, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x04, 0x82, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x05,
+    0x84, 0x09, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x04, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x02, 0x82, 0x0D, 0x82, 0x04, 0x82, 0x03, 0x82, 0x3F, 0x0E, 0x82, 0x03, 0x82, 0x03, 0x83,
+    0x02, 0x83, 0x03, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x82, 0x03, 0x83, 0x03, 0x82, 0x04, 0x82,
+    0x0B, 0x83, 0x05, 0x83, 0x03, 0x82, 0x04, 0x82, 0x13, 0x82, 0x03, 0x83, 0x03, 0x82, 0x04, 0x82,
+    0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x04, 0x82, 0x02, 0x82, 0x08, 0x82,
+    0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82,
+    0x0D, 0x83, 0x02, 0x83, 0x03, 0x83, 0x03, 0x82, 0x3F, 0x08, 0x86, 0x05, 0x86, 0x04, 0x82, 0x04,
+    0x82, 0x03, 0x87, 0x05, 0x86, 0x05, 0x82, 0x0B, 0x83, 0x06, 0x86, 0x04, 0x89, 0x0D, 0x88, 0x03,
+    0x82, 0x04, 0x82, 0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x88, 0x04, 0x82, 0x02, 0x82, 0x08,
+    0x82, 0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x88, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x0E,
+    0x87, 0x04, 0x86, 0x3F, 0x0A, 0x84, 0x07, 0x84, 0x05, 0x82, 0x04, 0x82, 0x05, 0x84, 0x07, 0x84,
+    0x06, 0x82, 0x0C, 0x82, 0x07, 0x84, 0x05, 0x89, 0x0E, 0x84, 0x01, 0x82, 0x03, 0x82, 0x04, 0x82,
+    0x0D, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x83, 0x03, 0x82, 0x02, 0x82, 0x04, 0x82, 0x07, 0x82,
+    0x04, 0x82, 0x02, 0x82, 0x02, 0x82, 0x03, 0x84, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82,
+    0x0F, 0x83, 0x01, 0x82, 0x05, 0x84, 0x00, 0x18, 0x08, 0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85,
+    0x34, 0x82, 0x00, 0xE3, 0x00, 0x82, 0x0D, 0x82, 0x06, 0x85, 0x06, 0x85, 0x13, 0x81, 0x20, 0x82,
+    0x00, 0xE3, 0x00, 0x82, 0x18, 0x82, 0x09, 0x82, 0x12, 0x82, 0x20, 0x82, 0x00, 0xE3, 0x00, 0x82,
+    0x18, 0x82, 0x09, 0x82, 0x12, 0x82, 0x20, 0x82, 0x00, 0xE3, 0x00, 0x82, 0x01, 0x83, 0x06, 0x85,
+    0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x05, 0x87, 0x06, 0x84, 0x13, 0x82, 0x00, 0xE3, 0x00, 0x87,
+    0x05, 0x85, 0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x04, 0x87, 0x05, 0x87, 0x11, 0x82, 0x00, 0xE3,
+    0x00, 0x83, 0x02, 0x83, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x83, 0x02, 0x82, 0x06, 0x82,
+    0x07, 0x82, 0x04, 0x82, 0x11, 0x82, 0x00, 0xE3, 0x00, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82,
+    0x09, 0x82, 0x05, 0x82, 0x04, 0x82, 0x05, 0x82, 0x07, 0x82, 0x17, 0x82, 0x00, 0xE3, 0x00, 0x82,
+    0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82, 0x07, 0x87, 0x12, 0x82,
+    0x00, 0xE3, 0x00, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82, 0x05, 0x88, 0x05, 0x82,
+    0x08, 0x87, 0x11, 0x82, 0x00, 0xE3, 0x00, 0x82, 0x04, 0x82, 0x07, 0x82, 0x09, 0x82, 0x09, 0x82,
+    0x05, 0x82, 0x0B, 0x82, 0x0D, 0x82, 0x11, 0x82, 0x00, 0xE3, 0x00, 0x83, 0x02, 0x83, 0x07, 0x82,
+    0x09, 0x82, 0x09, 0x82, 0x05, 0x83, 0x03, 0x82, 0x05, 0x82, 0x07, 0x82, 0x04, 0x82, 0x00, 0xF6,
+    0x00, 0x87, 0x08, 0x82, 0x09, 0x82, 0x09, 0x82, 0x06, 0x86, 0x06, 0x86, 0x03, 0x87, 0x12, 0x82,
+    0x00, 0xE3, 0x00, 0x82, 0x01, 0x83, 0x09, 0x82, 0x09, 0x82, 0x09, 0x82, 0x07, 0x84, 0x08, 0x85,
+    0x05, 0x84, 0x13, 0x82, 0x00, 0xB4, 0x06
+};
+
+static const uint16_t palette_perdu[] = {0xF800, 0xFFFF, 0x0000};
+
+static const uint8_t donnees_perdu[] = {
+    0x00, 0x94, 0x3E, 0x40, 0x19, 0x01, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0xF3, 0x00, 0x05, 0x9F, 0x41,
+    0x27, 0x41, 0x80, 0xF3, 0x00, 0x05, 0x9F, 0x41, 0x27, 0x41, 0x80, 0xF3, 0x00, 0x05, 0x9F, 0x41,
+    0x27, 0x41, 0x98, 0x04, 0x89, 0x03, 0x80, 0xCB, 0x00, 0x05, 0x9F, 0x41, 0x27, 0x41, 0x98, 0x04,
+    0x89, 0x03, 0x80, 0xCB, 0x00, 0x05, 0x9F, 0x41, 0x27, 0x41, 0x98, 0x05, 0x88, 0x03, 0x80, 0xCB,
+    0x00, 0x05, 0x9F, 0x41, 0x27, 0x41, 0x99, 0x04, 0x87, 0x04, 0x85, 0x07, 0x86, 0x04, 0x85, 0x04,
+    0x86, 0x09, 0x96, 0x09, 0x83, 0x04, 0x89, 0x03, 0x86, 0x07, 0x85, 0x0E, 0x92, 0x04, 0x81, 0x06,
+    0x89, 0x07, 0x86, 0x05, 0x81, 0x07, 0x85, 0x0B, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41,
+    0x99, 0x05, 0x86, 0x04, 0x83, 0x0B, 0x84, 0x04, 0x85, 0x04, 0x84, 0x0C, 0x93, 0x0C, 0x83, 0x04,
+    0x87, 0x04, 0x84, 0x0A, 0x84, 0x0E, 0x92, 0x0D, 0x85, 0x0A, 0x85, 0x0D, 0x83, 0x0D, 0x82, 0x04,
+    0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9A, 0x04, 0x85, 0x04, 0x83, 0x05, 0x83, 0x05, 0x83, 0x04,
+    0x85, 0x04, 0x84, 0x04, 0x85, 0x03, 0x93, 0x04, 0x83, 0x05, 0x83, 0x04, 0x87, 0x04, 0x83, 0x05,
+    0x82, 0x05, 0x8C, 0x05, 0x92, 0x06, 0x82, 0x05, 0x84, 0x05, 0x82, 0x05, 0x84, 0x08, 0x82, 0x03,
+    0x82, 0x05, 0x83, 0x06, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9A, 0x04, 0x85, 0x04,
+    0x83, 0x04, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x83, 0x05, 0xA3, 0x05, 0x83, 0x04, 0x85, 0x04,
+    0x83, 0x05, 0x84, 0x04, 0x8B, 0x05, 0x93, 0x05, 0x84, 0x05, 0x82, 0x05, 0x84, 0x04, 0x84, 0x07,
+    0x83, 0x03, 0x82, 0x04, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9A, 0x05,
+    0x84, 0x04, 0x82, 0x05, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x83, 0x05, 0xA3, 0x05, 0x83, 0x04,
+    0x85, 0x04, 0x83, 0x04, 0x85, 0x05, 0x89, 0x05, 0x94, 0x04, 0x86, 0x04, 0x82, 0x04, 0x85, 0x05,
+    0x83, 0x06, 0x84, 0x03, 0x81, 0x05, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41,
+    0x9B, 0x04, 0x83, 0x04, 0x83, 0x04, 0x87, 0x04, 0x82, 0x04, 0x85, 0x04, 0x83, 0x06, 0xA2, 0x05,
+    0x83, 0x05, 0x84, 0x04, 0x82, 0x05, 0x85, 0x05, 0x88, 0x05, 0x95, 0x04, 0x86, 0x04, 0x81, 0x05,
+    0x85, 0x05, 0x83, 0x05, 0x89, 0x05, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41,
+    0x9B, 0x05, 0x82, 0x04, 0x83, 0x04, 0x87, 0x04, 0x82, 0x04, 0x85, 0x04, 0x84, 0x08, 0x9A, 0x0A,
+    0x84, 0x04, 0x83, 0x04, 0x83, 0x0F, 0x87, 0x05, 0x96, 0x04, 0x86, 0x04, 0x81, 0x0F, 0x83, 0x05,
+    0x89, 0x05, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9B, 0x05, 0x81, 0x04,
+    0x84, 0x04, 0x87, 0x04, 0x82, 0x04, 0x85, 0x04, 0x86, 0x09, 0x95, 0x0C, 0x84, 0x04, 0x83, 0x04,
+    0x83, 0x0F, 0x86, 0x05, 0x97, 0x04, 0x86, 0x04, 0x81, 0x0F, 0x83, 0x05, 0x89, 0x04, 0x86, 0x05,
+    0x82, 0x04, 0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9C, 0x04, 0x81, 0x04, 0x84, 0x04, 0x87, 0x04,
+    0x82, 0x04, 0x85, 0x04, 0x89, 0x07, 0x93, 0x05, 0x83, 0x05, 0x85, 0x04, 0x81, 0x04, 0x84, 0x05,
+    0x8F, 0x05, 0x98, 0x04, 0x86, 0x04, 0x81, 0x05, 0x8D, 0x05, 0x89, 0x04, 0x86, 0x05, 0x82, 0x04,
+    0x85, 0x04, 0x90, 0x41, 0x27, 0x41, 0x9C, 0x09, 0x84, 0x04, 0x87, 0x04, 0x82, 0x04, 0x85, 0x04,
+    0x8B, 0x05, 0x92, 0x05, 0x84, 0x05, 0x85, 0x04, 0x81, 0x04, 0x84, 0x05, 0x8E, 0x05, 0x99, 0x04,
+    0x86, 0x04, 0x81, 0x05, 0x8D, 0x05, 0x89, 0x05, 0x85, 0x05, 0x82, 0x04, 0x85, 0x04, 0x90, 0x41,
+    0x27, 0x41, 0x9D, 0x07, 0x85, 0x05, 0x85, 0x05, 0x82, 0x04, 0x84, 0x05, 0x8C, 0x04, 0x92, 0x04,
+    0x85, 0x05, 0x85, 0x08, 0x86, 0x04, 0x8D, 0x05, 0x9A, 0x04, 0x85, 0x05, 0x82, 0x04, 0x8D, 0x05,
+    0x89, 0x05, 0x85, 0x05, 0x82, 0x04, 0x84, 0x05, 0x90, 0x41, 0x27, 0x41, 0x9D, 0x07, 0x86, 0x04,
+    0x85, 0x05, 0x82, 0x04, 0x83, 0x06, 0x8C, 0x04, 0x92, 0x05, 0x84, 0x05, 0x86, 0x07, 0x86, 0x05,
+    0x8C, 0x04, 0x9B, 0x05, 0x84, 0x04, 0x83, 0x05, 0x8C, 0x05, 0x8A, 0x04, 0x84, 0x06, 0x82, 0x04,
+    0x83, 0x06, 0x90, 0x41, 0x27, 0x41, 0x9D, 0x07, 0x86, 0x05, 0x83, 0x05, 0x83, 0x05, 0x81, 0x07,
+    0x83, 0x04, 0x84, 0x05, 0x92, 0x05, 0x83, 0x06, 0x86, 0x07, 0x87, 0x05, 0x85, 0x03, 0x82, 0x04,
+    0x9C, 0x06, 0x82, 0x05, 0x84, 0x05, 0x85, 0x03, 0x83, 0x05, 0x8A, 0x05, 0x82, 0x07, 0x82, 0x05,
+    0x81, 0x07, 0x90, 0x41, 0x27, 0x41, 0x9E, 0x05, 0x88, 0x0B, 0x85, 0x0C, 0x83, 0x0C, 0x94, 0x0E,
+    0x86, 0x05, 0x89, 0x0C, 0x81, 0x0F, 0x92, 0x0C, 0x86, 0x0C, 0x83, 0x05, 0x8B, 0x0D, 0x83, 0x0C,
+    0x90, 0x41, 0x27, 0x41, 0x9E, 0x05, 0x8A, 0x07, 0x88, 0x06, 0x81, 0x04, 0x84, 0x09, 0x97, 0x07,
+    0x82, 0x04, 0x86, 0x05, 0x8B, 0x09, 0x82, 0x0F, 0x92, 0x0B, 0x89, 0x09, 0x84, 0x05, 0x8C, 0x06,
+    0x81, 0x05, 0x84, 0x06, 0x81, 0x04, 0x90, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBC, 0x04, 0xBF, 0x9A,
+    0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBC, 0x04, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBC, 0x04,
+    0xBF, 0x9A, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBC, 0x04, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0xBF, 0xBF,
+    0xBC, 0x04, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x94, 0x46, 0x86,
+    0x45, 0xAC, 0x42, 0x86, 0x42, 0xBF, 0xBF, 0xBE, 0x41, 0x27, 0x41, 0x94, 0x47, 0x85, 0x45, 0xAC,
+    0x42, 0x86, 0x42, 0xBF, 0x81, 0x41, 0xB6, 0x41, 0xA0, 0x41, 0xA3, 0x41, 0x27, 0x41, 0x94, 0x42,
+    0x83, 0x43, 0x87, 0x42, 0xAC, 0x42, 0x86, 0x42, 0xBF, 0x42, 0xB5, 0x42, 0x9F, 0x42, 0xA3, 0x41,
+    0x27, 0x41, 0x94, 0x42, 0x84, 0x42, 0x87, 0x42, 0xAC, 0x42, 0x86, 0x42, 0x9E, 0x43, 0x81, 0x42,
+    0x9B, 0x42, 0xB5, 0x42, 0x9F, 0x42, 0xA3, 0x41, 0x27, 0x41, 0x94, 0x42, 0x84, 0x42, 0x87, 0x42,
+    0x85, 0x42, 0x84, 0x42, 0x85, 0x44, 0x92, 0x43, 0x81, 0x42, 0x86, 0x42, 0x88, 0x45, 0x84, 0x42,
+    0x82, 0x43, 0x85, 0x47, 0x85, 0x44, 0x85, 0x42, 0x81, 0x44, 0x84, 0x47, 0x8F, 0x42, 0x82, 0x43,
+    0x86, 0x44, 0x87, 0x44, 0x85, 0x47, 0x86, 0x45, 0x84, 0x42, 0x81, 0x44, 0x84, 0x47, 0xA0, 0x41,
+    0x27, 0x41, 0x94, 0x42, 0x84, 0x42, 0x87, 0x42, 0x85, 0x42, 0x84, 0x42, 0x84, 0x47, 0x8F, 0x47,
+    0x8F, 0x47, 0x84, 0x47, 0x83, 0x43, 0x82, 0x43, 0x84, 0x46, 0x84, 0x48, 0x83, 0x47, 0x90, 0x47,
+    0x84, 0x46, 0x85, 0x47, 0x83, 0x47, 0x85, 0x47, 0x83, 0x48, 0x83, 0x47, 0xA0, 0x41, 0x27, 0x41,
+    0x94, 0x42, 0x83, 0x43, 0x87, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x8E, 0x43,
+    0x82, 0x43, 0x8E, 0x42, 0x84, 0x42, 0x84, 0x43, 0x82, 0x41, 0x84, 0x42, 0x84, 0x42, 0x83, 0x43,
+    0x82, 0x42, 0x84, 0x43, 0x83, 0x42, 0x85, 0x42, 0x93, 0x43, 0x82, 0x41, 0x84, 0x43, 0x82, 0x42,
+    0x84, 0x42, 0x84, 0x42, 0x85, 0x42, 0x87, 0x42, 0x84, 0x42, 0x83, 0x43, 0x83, 0x42, 0x85, 0x42,
+    0xA3, 0x41, 0x27, 0x41, 0x94, 0x47, 0x88, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x94, 0x42,
+    0x84, 0x42, 0x94, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42,
+    0x84, 0x42, 0x85, 0x42, 0x93, 0x42, 0x88, 0x42, 0x84, 0x42, 0x83, 0x42, 0x8B, 0x42, 0x8D, 0x42,
+    0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0xA3, 0x41, 0x27, 0x41, 0x94, 0x46, 0x89, 0x42, 0x85, 0x42,
+    0x84, 0x42, 0x83, 0x47, 0x8F, 0x42, 0x84, 0x42, 0x90, 0x46, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42,
+    0x83, 0x48, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0x93, 0x42, 0x88, 0x48, 0x83, 0x47, 0x86, 0x42,
+    0x89, 0x46, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0xA3, 0x41, 0x27, 0x41, 0x94, 0x42, 0x8D, 0x42,
+    0x85, 0x42, 0x84, 0x42, 0x84, 0x47, 0x8E, 0x42, 0x84, 0x42, 0x8F, 0x47, 0x84, 0x42, 0x88, 0x42,
+    0x84, 0x42, 0x83, 0x48, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0x93, 0x42, 0x88, 0x48, 0x84, 0x47,
+    0x85, 0x42, 0x88, 0x47, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0xA3, 0x41, 0x27, 0x41, 0x94, 0x42,
+    0x8D, 0x42, 0x85, 0x42, 0x84, 0x42, 0x89, 0x42, 0x8E, 0x42, 0x84, 0x42, 0x8E, 0x42, 0x84, 0x42,
+    0x84, 0x42, 0x88, 0x43, 0x82, 0x43, 0x83, 0x42, 0x89, 0x42, 0x84, 0x42, 0x85, 0x42, 0x93, 0x42,
+    0x88, 0x42, 0x8F, 0x42, 0x85, 0x42, 0x87, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42,
+    0xA3, 0x41, 0x27, 0x41, 0x94, 0x42, 0x8D, 0x42, 0x85, 0x42, 0x83, 0x43, 0x83, 0x42, 0x84, 0x42,
+    0x8E, 0x43, 0x82, 0x43, 0x8E, 0x42, 0x83, 0x43, 0x84, 0x42, 0x89, 0x47, 0x83, 0x43, 0x83, 0x42,
+    0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0x93, 0x42, 0x88, 0x43, 0x83, 0x42, 0x83, 0x42, 0x84, 0x42,
+    0x85, 0x42, 0x87, 0x42, 0x83, 0x43, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0xA3, 0x41, 0x27, 0x41,
+    0x94, 0x42, 0x8D, 0x42, 0x85, 0x48, 0x83, 0x47, 0x90, 0x47, 0x8E, 0x48, 0x84, 0x42, 0x8A, 0x43,
+    0x81, 0x42, 0x84, 0x46, 0x84, 0x42, 0x84, 0x42, 0x85, 0x46, 0x8F, 0x42, 0x89, 0x46, 0x84, 0x47,
+    0x86, 0x46, 0x83, 0x48, 0x83, 0x42, 0x84, 0x42, 0x85, 0x46, 0x86, 0x42, 0x97, 0x41, 0x27, 0x41,
+    0x94, 0x42, 0x8D, 0x42, 0x86, 0x44, 0x81, 0x42, 0x85, 0x44, 0x92, 0x43, 0x81, 0x42, 0x8F, 0x43,
+    0x83, 0x42, 0x83, 0x42, 0x8E, 0x42, 0x85, 0x44, 0x85, 0x42, 0x84, 0x42, 0x86, 0x45, 0x8F, 0x42,
+    0x8A, 0x44, 0x87, 0x44, 0x88, 0x45, 0x84, 0x43, 0x83, 0x42, 0x82, 0x42, 0x84, 0x42, 0x86, 0x45,
+    0x86, 0x42, 0x97, 0x41, 0x27, 0x41, 0xBF, 0xB8, 0x42, 0x83, 0x43, 0xBF, 0xBF, 0x9A, 0x41, 0x27,
+    0x41, 0xBF, 0xB8, 0x47, 0xBF, 0xBF, 0x9B, 0x41, 0x27, 0x41, 0xBF, 0xB9, 0x45, 0xBF, 0xBF, 0x9C,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x91, 0x46, 0x80, 0xEF, 0x00, 0x42, 0x8F,
+    0x41, 0x27, 0x41, 0x91, 0x47, 0x80, 0xEE, 0x00, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91, 0x42, 0x83,
+    0x43, 0x80, 0xED, 0x00, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91, 0x42, 0x84, 0x42, 0xBA, 0x42, 0x84,
+    0x42, 0xA4, 0x42, 0x81, 0x43, 0xB3, 0x43, 0x81, 0x42, 0x90, 0x43, 0x81, 0x42, 0xB2, 0x42, 0x8F,
+    0x41, 0x27, 0x41, 0x91, 0x42, 0x84, 0x42, 0x85, 0x44, 0x87, 0x44, 0x87, 0x44, 0x87, 0x44, 0x87,
+    0x45, 0x84, 0x42, 0x84, 0x42, 0x85, 0x44, 0x85, 0x49, 0x8D, 0x47, 0x86, 0x44, 0x85, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x82, 0x43, 0x90, 0x47, 0x85, 0x45, 0x85, 0x47, 0x83, 0x42, 0x81, 0x44, 0x86,
+    0x44, 0x85, 0x42, 0x82, 0x43, 0x92, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91, 0x42, 0x83, 0x43, 0x84,
+    0x46, 0x85, 0x46, 0x85, 0x47, 0x84, 0x47, 0x84, 0x47, 0x84, 0x42, 0x83, 0x42, 0x84, 0x46, 0x84,
+    0x49, 0x8D, 0x43, 0x82, 0x43, 0x84, 0x46, 0x84, 0x42, 0x84, 0x42, 0x84, 0x47, 0x8E, 0x43, 0x82,
+    0x43, 0x84, 0x47, 0x83, 0x43, 0x82, 0x43, 0x83, 0x48, 0x84, 0x46, 0x85, 0x47, 0x91, 0x42, 0x8F,
+    0x41, 0x27, 0x41, 0x91, 0x47, 0x84, 0x43, 0x82, 0x42, 0x84, 0x43, 0x82, 0x42, 0x84, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x84, 0x42, 0x82, 0x42, 0x84, 0x43, 0x82,
+    0x42, 0x8A, 0x42, 0x8E, 0x42, 0x84, 0x42, 0x83, 0x43, 0x82, 0x43, 0x83, 0x42, 0x84, 0x42, 0x84,
+    0x43, 0x82, 0x41, 0x8F, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83,
+    0x43, 0x83, 0x42, 0x83, 0x43, 0x82, 0x42, 0x85, 0x43, 0x82, 0x41, 0x92, 0x42, 0x8F, 0x41, 0x27,
+    0x41, 0x91, 0x46, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x89, 0x42, 0x8F,
+    0x42, 0x84, 0x42, 0x82, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x8F, 0x42, 0x84, 0x42, 0x83,
+    0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x84, 0x42, 0x93, 0x42, 0x84, 0x42, 0x89, 0x42, 0x83,
+    0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x84, 0x42, 0x96, 0x42, 0x8F,
+    0x41, 0x27, 0x41, 0x91, 0x42, 0x82, 0x42, 0x85, 0x48, 0x83, 0x48, 0x83, 0x47, 0x84, 0x47, 0x86,
+    0x46, 0x85, 0x42, 0x81, 0x42, 0x84, 0x48, 0x87, 0x42, 0x90, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x84, 0x42, 0x84, 0x42, 0x93, 0x42, 0x84, 0x42, 0x85, 0x46, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x48, 0x84, 0x42, 0x96, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91,
+    0x42, 0x83, 0x42, 0x84, 0x48, 0x83, 0x48, 0x84, 0x47, 0x84, 0x47, 0x84, 0x47, 0x85, 0x42, 0x81,
+    0x42, 0x84, 0x48, 0x86, 0x42, 0x91, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x84, 0x42, 0x93, 0x42, 0x84, 0x42, 0x84, 0x47, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x48, 0x84, 0x42, 0x96, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x89, 0x42, 0x8F, 0x42, 0x89, 0x42, 0x83, 0x42, 0x84, 0x42, 0x85, 0x42, 0x81, 0x42, 0x84,
+    0x42, 0x8B, 0x42, 0x92, 0x43, 0x82, 0x43, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x84,
+    0x42, 0x93, 0x43, 0x82, 0x43, 0x83, 0x42, 0x84, 0x42, 0x83, 0x43, 0x82, 0x43, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x8A, 0x42, 0x96, 0x42, 0x8F, 0x41, 0x27, 0x41, 0x91, 0x42, 0x84, 0x42, 0x83,
+    0x43, 0x83, 0x42, 0x83, 0x43, 0x83, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83,
+    0x42, 0x83, 0x43, 0x86, 0x43, 0x85, 0x43, 0x83, 0x42, 0x84, 0x42, 0x93, 0x47, 0x84, 0x43, 0x82,
+    0x43, 0x83, 0x42, 0x83, 0x43, 0x84, 0x42, 0x94, 0x47, 0x83, 0x42, 0x83, 0x43, 0x84, 0x47, 0x83,
+    0x42, 0x84, 0x42, 0x83, 0x43, 0x83, 0x42, 0x84, 0x42, 0xA7, 0x41, 0x27, 0x41, 0x91, 0x42, 0x84,
+    0x42, 0x84, 0x46, 0x85, 0x46, 0x84, 0x47, 0x84, 0x47, 0x84, 0x48, 0x86, 0x43, 0x86, 0x46, 0x84,
+    0x49, 0x8D, 0x42, 0x81, 0x43, 0x86, 0x46, 0x84, 0x48, 0x84, 0x42, 0x95, 0x43, 0x81, 0x42, 0x83,
+    0x48, 0x85, 0x43, 0x81, 0x42, 0x83, 0x42, 0x84, 0x42, 0x84, 0x46, 0x85, 0x42, 0x96, 0x42, 0x8F,
+    0x41, 0x27, 0x41, 0x91, 0x42, 0x85, 0x42, 0x84, 0x44, 0x87, 0x44, 0x87, 0x44, 0x87, 0x44, 0x86,
+    0x43, 0x83, 0x42, 0x85, 0x43, 0x87, 0x44, 0x85, 0x49, 0x8D, 0x42, 0x8B, 0x44, 0x86, 0x44, 0x81,
+    0x42, 0x84, 0x42, 0x99, 0x42, 0x84, 0x43, 0x83, 0x42, 0x88, 0x42, 0x83, 0x42, 0x84, 0x42, 0x85,
+    0x44, 0x86, 0x42, 0x96, 0x42, 0x8F, 0x41, 0x27, 0x41, 0xBF, 0x96, 0x43, 0xA7, 0x42, 0xB5, 0x42,
+    0x83, 0x43, 0x8E, 0x42, 0x83, 0x43, 0xBF, 0x84, 0x41, 0x27, 0x41, 0xBF, 0x94, 0x45, 0xA7, 0x42,
+    0xB5, 0x47, 0x8F, 0x47, 0xBF, 0x85, 0x41, 0x27, 0x41, 0xBF, 0x94, 0x43, 0xA9, 0x42, 0xB6, 0x45,
+    0x91, 0x45, 0xBF, 0x86, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x40, 0x19,
+    0x01, 0x00, 0xD3, 0x30
+};
+
+static const uint16_t palette_fin[] = {0x07E0, 0x0000, 0x07FF};
+
+static const uint8_t donnees_fin[] = {
+    0x00, 0x94, 0x3E, 0x40, 0x19, 0x01, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0xB9, 0x45, 0xAF, 0x45, 0xA8, 0x45,
+    0xB9, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xB9, 0x45, 0xAF, 0x45, 0xA8, 0x45, 0xB9, 0x45, 0xBA, 0x41,
+    0x27, 0x41, 0xBF, 0xAE, 0x45, 0xBF, 0xA7, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x4D, 0xBB, 0x45,
+    0xBF, 0xA7, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x4D, 0xBB, 0x45, 0xBF, 0xA7, 0x45, 0xBA, 0x41,
+    0x27, 0x41, 0xA5, 0x44, 0xBF, 0x85, 0x45, 0xBF, 0xA7, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x44,
+    0x8A, 0x4A, 0x87, 0x44, 0x81, 0x47, 0x97, 0x4B, 0x82, 0x44, 0x85, 0x44, 0x93, 0x4B, 0x89, 0x47,
+    0x85, 0x44, 0x85, 0x44, 0x97, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x8A, 0x4A, 0x87, 0x4D,
+    0x94, 0x4D, 0x82, 0x44, 0x85, 0x44, 0x93, 0x4B, 0x87, 0x4A, 0x84, 0x44, 0x85, 0x44, 0x97, 0x45,
+    0xBA, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x47, 0x82, 0x44, 0x93, 0x45, 0x83, 0x46,
+    0x82, 0x44, 0x85, 0x44, 0x99, 0x45, 0x86, 0x45, 0x82, 0x45, 0x83, 0x44, 0x85, 0x44, 0x97, 0x44,
+    0xBB, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x46, 0x83, 0x45, 0x92, 0x44, 0x85, 0x45,
+    0x82, 0x44, 0x85, 0x44, 0x99, 0x45, 0x85, 0x45, 0x84, 0x44, 0x83, 0x44, 0x85, 0x44, 0x97, 0x44,
+    0xBB, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x45, 0x84, 0x45, 0x91, 0x45, 0x85, 0x45,
+    0x82, 0x44, 0x85, 0x44, 0x99, 0x45, 0x85, 0x44, 0x85, 0x45, 0x82, 0x44, 0x85, 0x44, 0x98, 0x43,
+    0xBB, 0x41, 0x27, 0x41, 0xA5, 0x4D, 0x87, 0x44, 0x87, 0x44, 0x85, 0x45, 0x91, 0x45, 0x85, 0x45,
+    0x82, 0x44, 0x85, 0x44, 0x99, 0x45, 0x84, 0x45, 0x85, 0x45, 0x82, 0x44, 0x85, 0x44, 0x98, 0x43,
+    0xBB, 0x41, 0x27, 0x41, 0xA5, 0x4D, 0x87, 0x44, 0x87, 0x44, 0x85, 0x45, 0x91, 0x45, 0x85, 0x45,
+    0x82, 0x44, 0x85, 0x44, 0x99, 0x45, 0x84, 0x4F, 0x82, 0x44, 0x85, 0x44, 0x98, 0x43, 0xBB, 0x41,
+    0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x44, 0x85, 0x45, 0x91, 0x44, 0x86, 0x45, 0x82, 0x44,
+    0x85, 0x44, 0x99, 0x45, 0x84, 0x4F, 0x82, 0x44, 0x85, 0x44, 0x98, 0x43, 0xBB, 0x41, 0x27, 0x41,
+    0xA5, 0x44, 0x90, 0x44, 0x87, 0x44, 0x85, 0x45, 0x91, 0x44, 0x86, 0x45, 0x82, 0x44, 0x85, 0x44,
+    0x99, 0x45, 0x84, 0x45, 0x8C, 0x44, 0x85, 0x44, 0x98, 0x43, 0xBB, 0x41, 0x27, 0x41, 0xA5, 0x44,
+    0x90, 0x44, 0x87, 0x44, 0x85, 0x45, 0x91, 0x45, 0x85, 0x45, 0x82, 0x44, 0x85, 0x44, 0x99, 0x45,
+    0x84, 0x45, 0x8C, 0x44, 0x85, 0x44, 0xBF, 0x97, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87,
+    0x44, 0x85, 0x45, 0x91, 0x45, 0x85, 0x45, 0x82, 0x44, 0x84, 0x45, 0x99, 0x45, 0x85, 0x44, 0x8C,
+    0x44, 0x84, 0x45, 0xBF, 0x97, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x44, 0x85, 0x45,
+    0x92, 0x44, 0x84, 0x46, 0x82, 0x44, 0x83, 0x46, 0x99, 0x45, 0x85, 0x45, 0x8B, 0x44, 0x83, 0x46,
+    0xBF, 0x97, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x44, 0x85, 0x45, 0x92, 0x45, 0x82,
+    0x47, 0x82, 0x45, 0x81, 0x47, 0x99, 0x45, 0x86, 0x45, 0x85, 0x43, 0x82, 0x45, 0x81, 0x47, 0x97,
+    0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90, 0x44, 0x87, 0x44, 0x85, 0x45, 0x93, 0x4D, 0x83,
+    0x4C, 0x99, 0x45, 0x87, 0x4C, 0x83, 0x4C, 0x97, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xA5, 0x44, 0x90,
+    0x44, 0x87, 0x44, 0x85, 0x45, 0x94, 0x46, 0x81, 0x45, 0x84, 0x46, 0x81, 0x44, 0x99, 0x45, 0x89,
+    0x49, 0x85, 0x46, 0x81, 0x44, 0x97, 0x45, 0xBA, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x9C, 0x45, 0xBF,
+    0xB9, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x9C, 0x45, 0xBF, 0xB9, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x9C,
+    0x44, 0xBF, 0xBA, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0x95, 0x43, 0x83, 0x45, 0xBF, 0xBA, 0x41, 0x27,
+    0x41, 0xBF, 0xBF, 0x95, 0x4A, 0xBF, 0xBB, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBE, 0x42, 0xBF, 0x9A,
+    0x41, 0x27, 0x41, 0x9E, 0x43, 0x83, 0x43, 0xA7, 0x42, 0x96, 0x42, 0x86, 0x42, 0xAB, 0x42, 0x9F,
+    0x42, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0x9E, 0x43, 0x83, 0x43, 0xA7, 0x42, 0x96, 0x42, 0x86, 0x42,
+    0xAB, 0x42, 0xBF, 0xBB, 0x41, 0x27, 0x41, 0x9E, 0x44, 0x81, 0x44, 0xBF, 0x42, 0x86, 0x42, 0xBF,
+    0xBF, 0xA9, 0x41, 0x27, 0x41, 0x9E, 0x44, 0x81, 0x41, 0x81, 0x42, 0xBF, 0x42, 0x86, 0x42, 0xBF,
+    0x8A, 0x45, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x81, 0x41, 0x81, 0x41, 0x81, 0x42, 0x84,
+    0x44, 0x85, 0x42, 0x82, 0x43, 0x86, 0x44, 0x86, 0x45, 0x92, 0x43, 0x81, 0x42, 0x86, 0x42, 0x88,
+    0x45, 0x84, 0x42, 0x85, 0x42, 0x84, 0x44, 0x86, 0x45, 0x85, 0x42, 0x82, 0x43, 0x90, 0x45, 0x87,
+    0x44, 0x85, 0x42, 0x84, 0x42, 0x85, 0x44, 0xB8, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x81, 0x41, 0x81,
+    0x41, 0x81, 0x42, 0x83, 0x46, 0x85, 0x47, 0x84, 0x46, 0x85, 0x45, 0x91, 0x47, 0x8F, 0x47, 0x84,
+    0x42, 0x83, 0x42, 0x84, 0x46, 0x85, 0x45, 0x86, 0x47, 0x92, 0x42, 0x86, 0x46, 0x84, 0x42, 0x84,
+    0x42, 0x84, 0x46, 0xB7, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x81, 0x43, 0x81, 0x42, 0x82, 0x43, 0x82,
+    0x42, 0x85, 0x43, 0x82, 0x41, 0x84, 0x43, 0x82, 0x43, 0x87, 0x42, 0x90, 0x43, 0x82, 0x43, 0x8E,
+    0x42, 0x84, 0x42, 0x84, 0x42, 0x83, 0x42, 0x83, 0x43, 0x82, 0x43, 0x87, 0x42, 0x86, 0x43, 0x82,
+    0x41, 0x93, 0x42, 0x85, 0x43, 0x82, 0x43, 0x83, 0x42, 0x84, 0x42, 0x83, 0x43, 0x82, 0x42, 0xB7,
+    0x41, 0x27, 0x41, 0x9E, 0x42, 0x82, 0x41, 0x82, 0x42, 0x82, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88,
+    0x42, 0x84, 0x42, 0x87, 0x42, 0x90, 0x42, 0x84, 0x42, 0x94, 0x42, 0x84, 0x42, 0x83, 0x42, 0x83,
+    0x42, 0x84, 0x42, 0x87, 0x42, 0x86, 0x42, 0x97, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0x84, 0x42, 0xB6, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x85, 0x42, 0x82, 0x48, 0x84,
+    0x42, 0x88, 0x42, 0x8D, 0x42, 0x90, 0x42, 0x84, 0x42, 0x90, 0x46, 0x85, 0x42, 0x81, 0x42, 0x84,
+    0x42, 0x84, 0x42, 0x87, 0x42, 0x86, 0x42, 0x97, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x48, 0xB6, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x85, 0x42, 0x82, 0x48, 0x84, 0x42, 0x88,
+    0x42, 0x8D, 0x42, 0x90, 0x42, 0x84, 0x42, 0x8F, 0x47, 0x85, 0x42, 0x81, 0x42, 0x84, 0x42, 0x84,
+    0x42, 0x87, 0x42, 0x86, 0x42, 0x97, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84, 0x42, 0x83,
+    0x48, 0xB6, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x85, 0x42, 0x82, 0x42, 0x8A, 0x42, 0x88, 0x42, 0x84,
+    0x42, 0x87, 0x42, 0x90, 0x42, 0x84, 0x42, 0x8E, 0x42, 0x84, 0x42, 0x85, 0x42, 0x81, 0x42, 0x84,
+    0x42, 0x84, 0x42, 0x87, 0x42, 0x86, 0x42, 0x97, 0x42, 0x85, 0x42, 0x84, 0x42, 0x83, 0x42, 0x84,
+    0x42, 0x83, 0x42, 0xBC, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x85, 0x42, 0x82, 0x43, 0x83, 0x42, 0x84,
+    0x42, 0x88, 0x43, 0x82, 0x43, 0x87, 0x42, 0x90, 0x43, 0x82, 0x43, 0x8E, 0x42, 0x83, 0x43, 0x86,
+    0x43, 0x85, 0x43, 0x82, 0x43, 0x87, 0x42, 0x86, 0x42, 0x97, 0x42, 0x85, 0x43, 0x82, 0x43, 0x83,
+    0x42, 0x83, 0x43, 0x83, 0x43, 0x83, 0x42, 0xB6, 0x41, 0x27, 0x41, 0x9E, 0x42, 0x85, 0x42, 0x83,
+    0x46, 0x85, 0x42, 0x89, 0x46, 0x88, 0x42, 0x91, 0x47, 0x8E, 0x48, 0x86, 0x43, 0x86, 0x46, 0x88,
+    0x42, 0x86, 0x42, 0x97, 0x42, 0x86, 0x46, 0x84, 0x48, 0x84, 0x46, 0x87, 0x42, 0xAE, 0x41, 0x27,
+    0x41, 0x9E, 0x42, 0x85, 0x42, 0x84, 0x44, 0x86, 0x42, 0x8A, 0x44, 0x89, 0x42, 0x92, 0x43, 0x81,
+    0x42, 0x8F, 0x43, 0x83, 0x42, 0x86, 0x42, 0x87, 0x44, 0x89, 0x42, 0x86, 0x42, 0x97, 0x42, 0x87,
+    0x44, 0x86, 0x44, 0x81, 0x42, 0x85, 0x44, 0x88, 0x42, 0xAE, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBA,
+    0x41, 0x83, 0x42, 0xBF, 0x9A, 0x41, 0x27, 0x41, 0xBF, 0xBF, 0xBA, 0x46, 0xBF, 0x9A, 0x41, 0x27,
+    0x41, 0xBF, 0xBF, 0xBB, 0x44, 0xBF, 0x9B, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x40, 0x19, 0x01,
+    0x00, 0xD3, 0x30
+};
+
+static const uint16_t palette_argent_restant[] = {0x07FF, 0x0000, 0xFFFF};
+
+static const uint8_t donnees_argent_restant[] = {
+    0x00, 0x94, 0x3E, 0x40, 0x19, 0x01, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41,
+    0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17,
+    0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41,
+    0xA3, 0x45, 0xBF, 0x8B, 0x44, 0xBF, 0x8D, 0x44, 0xAC, 0x44, 0xA1, 0x41, 0x27, 0x41, 0xA3, 0x45,
+    0xBF, 0x8B, 0x44, 0xBF, 0x8D, 0x44, 0xAC, 0x44, 0xA1, 0x41, 0x27, 0x41, 0xA2, 0x47, 0xBF, 0x8A,
+    0x44, 0xBF, 0x8D, 0x44, 0xAC, 0x44, 0xA1, 0x41, 0x27, 0x41, 0xA2, 0x47, 0x87, 0x45, 0x81, 0x47,
+    0x85, 0x46, 0x81, 0x44, 0x86, 0x47, 0x85, 0x44, 0x81, 0x47, 0x83, 0x4F, 0x93, 0x45, 0x81, 0x47,
+    0x86, 0x47, 0x88, 0x49, 0x83, 0x4F, 0x84, 0x49, 0x85, 0x44, 0x81, 0x47, 0x83, 0x4F, 0x9A, 0x41,
+    0x27, 0x41, 0xA2, 0x47, 0x87, 0x4D, 0x83, 0x4D, 0x84, 0x4A, 0x84, 0x4D, 0x82, 0x4F, 0x93, 0x4D,
+    0x84, 0x4A, 0x85, 0x4C, 0x82, 0x4F, 0x82, 0x4C, 0x84, 0x4D, 0x82, 0x4F, 0x9A, 0x41, 0x27, 0x41,
+    0xA1, 0x44, 0x81, 0x44, 0x86, 0x48, 0x82, 0x43, 0x82, 0x45, 0x82, 0x47, 0x83, 0x45, 0x82, 0x45,
+    0x83, 0x47, 0x82, 0x44, 0x86, 0x44, 0x9A, 0x48, 0x82, 0x43, 0x83, 0x45, 0x82, 0x45, 0x84, 0x44,
+    0x85, 0x43, 0x86, 0x44, 0x89, 0x44, 0x83, 0x45, 0x84, 0x47, 0x82, 0x44, 0x86, 0x44, 0xA1, 0x41,
+    0x27, 0x41, 0xA1, 0x44, 0x81, 0x44, 0x86, 0x47, 0x83, 0x43, 0x82, 0x44, 0x85, 0x45, 0x82, 0x45,
+    0x84, 0x44, 0x83, 0x46, 0x83, 0x45, 0x85, 0x44, 0x9A, 0x47, 0x83, 0x43, 0x82, 0x45, 0x84, 0x44,
+    0x83, 0x45, 0x8E, 0x44, 0x91, 0x45, 0x83, 0x46, 0x83, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41,
+    0xA1, 0x43, 0x82, 0x45, 0x85, 0x46, 0x84, 0x43, 0x81, 0x45, 0x85, 0x45, 0x82, 0x44, 0x85, 0x45,
+    0x82, 0x45, 0x84, 0x45, 0x85, 0x44, 0x9A, 0x46, 0x84, 0x43, 0x82, 0x44, 0x85, 0x45, 0x82, 0x45,
+    0x8E, 0x44, 0x91, 0x45, 0x83, 0x45, 0x84, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41, 0xA0, 0x44,
+    0x83, 0x44, 0x85, 0x45, 0x89, 0x45, 0x85, 0x45, 0x81, 0x45, 0x85, 0x45, 0x82, 0x44, 0x85, 0x45,
+    0x85, 0x44, 0x9A, 0x45, 0x89, 0x45, 0x85, 0x45, 0x82, 0x46, 0x8D, 0x44, 0x91, 0x45, 0x83, 0x44,
+    0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41, 0xA0, 0x44, 0x83, 0x44, 0x85, 0x45, 0x89, 0x44,
+    0x86, 0x45, 0x81, 0x4F, 0x82, 0x44, 0x85, 0x45, 0x85, 0x44, 0x9A, 0x45, 0x89, 0x4F, 0x83, 0x48,
+    0x8A, 0x44, 0x8C, 0x4A, 0x83, 0x44, 0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41, 0x9F, 0x44,
+    0x84, 0x45, 0x84, 0x45, 0x89, 0x44, 0x86, 0x45, 0x81, 0x4F, 0x82, 0x44, 0x85, 0x45, 0x85, 0x44,
+    0x9A, 0x45, 0x89, 0x4F, 0x85, 0x49, 0x87, 0x44, 0x8A, 0x4C, 0x83, 0x44, 0x85, 0x45, 0x85, 0x44,
+    0xA1, 0x41, 0x27, 0x41, 0x9F, 0x4D, 0x84, 0x45, 0x89, 0x44, 0x86, 0x45, 0x81, 0x45, 0x8C, 0x44,
+    0x85, 0x45, 0x85, 0x44, 0x9A, 0x45, 0x89, 0x45, 0x92, 0x47, 0x86, 0x44, 0x89, 0x45, 0x83, 0x45,
+    0x83, 0x44, 0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41, 0x9F, 0x4E, 0x83, 0x45, 0x89, 0x45,
+    0x85, 0x45, 0x81, 0x45, 0x8C, 0x44, 0x85, 0x45, 0x85, 0x44, 0x9A, 0x45, 0x89, 0x45, 0x94, 0x45,
+    0x86, 0x44, 0x88, 0x45, 0x84, 0x45, 0x83, 0x44, 0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41,
+    0x9E, 0x44, 0x86, 0x45, 0x83, 0x45, 0x89, 0x45, 0x85, 0x45, 0x82, 0x44, 0x8C, 0x44, 0x85, 0x45,
+    0x85, 0x44, 0x9A, 0x45, 0x8A, 0x44, 0x95, 0x44, 0x86, 0x44, 0x88, 0x44, 0x85, 0x45, 0x83, 0x44,
+    0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41, 0x9E, 0x44, 0x87, 0x44, 0x83, 0x45, 0x8A, 0x44,
+    0x84, 0x46, 0x82, 0x45, 0x8B, 0x44, 0x85, 0x45, 0x85, 0x44, 0x9A, 0x45, 0x8A, 0x45, 0x94, 0x44,
+    0x86, 0x44, 0x88, 0x45, 0x84, 0x45, 0x83, 0x44, 0x85, 0x45, 0x85, 0x44, 0xA1, 0x41, 0x27, 0x41,
+    0x9D, 0x44, 0x88, 0x44, 0x83, 0x45, 0x8A, 0x45, 0x82, 0x47, 0x83, 0x45, 0x85, 0x43, 0x82, 0x44,
+    0x85, 0x45, 0x85, 0x45, 0x99, 0x45, 0x8B, 0x45, 0x85, 0x43, 0x82, 0x44, 0x84, 0x45, 0x86, 0x45,
+    0x87, 0x45, 0x83, 0x46, 0x83, 0x44, 0x85, 0x45, 0x85, 0x45, 0xA0, 0x41, 0x27, 0x41, 0x9D, 0x44,
+    0x89, 0x43, 0x83, 0x45, 0x8B, 0x4D, 0x84, 0x4C, 0x82, 0x44, 0x85, 0x45, 0x86, 0x4A, 0x93, 0x45,
+    0x8C, 0x4C, 0x82, 0x4C, 0x88, 0x4A, 0x82, 0x4E, 0x82, 0x44, 0x85, 0x45, 0x86, 0x4A, 0x9A, 0x41,
+    0x27, 0x41, 0x9D, 0x44, 0x89, 0x43, 0x83, 0x45, 0x8C, 0x46, 0x81, 0x45, 0x86, 0x49, 0x83, 0x44,
+    0x85, 0x45, 0x87, 0x49, 0x93, 0x45, 0x8E, 0x49, 0x84, 0x49, 0x8B, 0x49, 0x83, 0x47, 0x82, 0x44,
+    0x82, 0x44, 0x85, 0x45, 0x87, 0x49, 0x9A, 0x41, 0x27, 0x41, 0xBF, 0x89, 0x44, 0x80, 0xCB, 0x00,
+    0x41, 0x27, 0x41, 0xBF, 0x89, 0x44, 0x80, 0xCB, 0x00, 0x41, 0x27, 0x41, 0xBF, 0x89, 0x44, 0x80,
+    0xCB, 0x00, 0x41, 0x27, 0x41, 0xBF, 0x43, 0x84, 0x45, 0x80, 0xCC, 0x00, 0x41, 0x27, 0x41, 0xBF,
+    0x4B, 0x80, 0xCD, 0x00, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01,
+    0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80,
+    0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x41, 0x80, 0x17, 0x01, 0x41, 0x27,
+    0x41, 0x80, 0x17, 0x01, 0x41, 0x27, 0x40, 0x19, 0x01, 0x00, 0xA8, 0x0C, 0x45, 0x3F, 0x09, 0x42,
+    0x3F, 0x39, 0x45, 0x35, 0x42, 0x3D, 0x46, 0x3F, 0x08, 0x42, 0x3F, 0x39, 0x45, 0x35, 0x42, 0x08,
+    0x41, 0x34, 0x42, 0x03, 0x42, 0x3F, 0x07, 0x42, 0x3F, 0x3C, 0x42, 0x3E, 0x42, 0x34, 0x42, 0x03,
+    0x42, 0x3F, 0x07, 0x42, 0x3F, 0x01, 0x42, 0x01, 0x43, 0x35, 0x42, 0x3E, 0x42, 0x34, 0x42, 0x03,
+    0x42, 0x06, 0x44, 0x05, 0x42, 0x01, 0x44, 0x04, 0x42, 0x01, 0x44, 0x06, 0x44, 0x12, 0x44, 0x05,
+    0x42, 0x01, 0x44, 0x06, 0x45, 0x04, 0x42, 0x01, 0x44, 0x06, 0x44, 0x07, 0x44, 0x10, 0x47, 0x06,
+    0x44, 0x05, 0x42, 0x04, 0x42, 0x03, 0x42, 0x02, 0x43, 0x13, 0x42, 0x07, 0x45, 0x11, 0x44, 0x05,
+    0x42, 0x04, 0x42, 0x04, 0x45, 0x05, 0x47, 0x06, 0x44, 0x27, 0x42, 0x03, 0x42, 0x05, 0x46, 0x04,
+    0x48, 0x03, 0x48, 0x04, 0x46, 0x10, 0x46, 0x04, 0x48, 0x04, 0x47, 0x03, 0x48, 0x04, 0x46, 0x05,
+    0x46, 0x0F, 0x43, 0x02, 0x43, 0x04, 0x46, 0x04, 0x42, 0x04, 0x42, 0x04, 0x47, 0x12, 0x42, 0x06,
+    0x47, 0x0F, 0x47, 0x03, 0x42, 0x04, 0x42, 0x04, 0x45, 0x05, 0x47, 0x05, 0x46, 0x26, 0x46, 0x05,
+    0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x03, 0x43, 0x03, 0x42, 0x03, 0x43, 0x02, 0x42, 0x0F,
+    0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x43, 0x03, 0x42, 0x03,
+    0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x42, 0x0F, 0x42, 0x04, 0x42, 0x03, 0x43, 0x02, 0x43, 0x03,
+    0x42, 0x04, 0x42, 0x04, 0x43, 0x02, 0x41, 0x13, 0x42, 0x05, 0x42, 0x04, 0x42, 0x0E, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x43, 0x02, 0x42, 0x26, 0x46, 0x05,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x0E,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x09, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x0E, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x04, 0x42, 0x17, 0x42, 0x0B, 0x42, 0x0E, 0x42, 0x09, 0x42, 0x04, 0x42, 0x07, 0x42, 0x07,
+    0x42, 0x07, 0x42, 0x04, 0x42, 0x25, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x48, 0x0E, 0x42, 0x09, 0x42, 0x04, 0x42, 0x05, 0x46, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x09, 0x48, 0x0E, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x17, 0x42, 0x07, 0x46, 0x0E, 0x47, 0x04, 0x42, 0x04, 0x42, 0x07,
+    0x42, 0x07, 0x42, 0x07, 0x48, 0x25, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x48, 0x0E, 0x42, 0x09, 0x42, 0x04, 0x42, 0x04, 0x47, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x09, 0x48, 0x0E, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x17, 0x42, 0x06, 0x47, 0x0F, 0x47, 0x03, 0x42, 0x04, 0x42, 0x07,
+    0x42, 0x07, 0x42, 0x07, 0x48, 0x25, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x14, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x14, 0x43, 0x02,
+    0x43, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x17, 0x42, 0x05, 0x42, 0x04,
+    0x42, 0x14, 0x42, 0x03, 0x42, 0x04, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x2B, 0x42, 0x03,
+    0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x43, 0x03,
+    0x42, 0x0E, 0x43, 0x02, 0x43, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x03, 0x43, 0x03, 0x42, 0x04,
+    0x42, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x0E, 0x47, 0x04, 0x43, 0x02, 0x43, 0x03,
+    0x42, 0x03, 0x43, 0x04, 0x42, 0x17, 0x42, 0x05, 0x42, 0x03, 0x43, 0x0E, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x03, 0x43, 0x07, 0x42, 0x07, 0x42, 0x07, 0x43, 0x03, 0x42, 0x25, 0x47, 0x05, 0x46, 0x04,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x46, 0x10, 0x46, 0x04, 0x42, 0x04, 0x42, 0x03,
+    0x48, 0x03, 0x42, 0x04, 0x42, 0x04, 0x46, 0x05, 0x46, 0x0F, 0x42, 0x01, 0x43, 0x06, 0x46, 0x04,
+    0x48, 0x04, 0x42, 0x17, 0x42, 0x05, 0x48, 0x0E, 0x47, 0x04, 0x48, 0x07, 0x42, 0x07, 0x46, 0x04,
+    0x46, 0x26, 0x46, 0x07, 0x44, 0x05, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x05, 0x44, 0x12,
+    0x44, 0x05, 0x42, 0x04, 0x42, 0x04, 0x43, 0x03, 0x42, 0x02, 0x42, 0x04, 0x42, 0x05, 0x44, 0x07,
+    0x44, 0x10, 0x42, 0x0B, 0x44, 0x06, 0x44, 0x01, 0x42, 0x04, 0x42, 0x17, 0x42, 0x06, 0x43, 0x03,
+    0x42, 0x0F, 0x44, 0x06, 0x44, 0x01, 0x42, 0x07, 0x42, 0x08, 0x45, 0x05, 0x44, 0x3F, 0x3F, 0x38,
+    0x42, 0x00, 0x3E, 0x01, 0x42, 0x00, 0x3E, 0x01, 0x42, 0x00, 0x1A, 0x4E
+};
+
+const ILI9341_rle_image_t images_ecrans[NB_ECRANS] = {
+    {320, 240, palette_debut, donnees_debut, sizeof(donnees_debut)},
+    {320, 240, palette_regles, donnees_regles, sizeof(donnees_regles)},
+    {320, 240, palette_perdu, donnees_perdu, sizeof(donnees_perdu)},
+    {320, 240, palette_fin, donnees_fin, sizeof(donnees_fin)},
+    {320, 240, palette_argent_restant, donnees_argent_restant, sizeof(donnees_argent_restant)},
+};
+
+#endif /* USE_ECRANS_PRECALCULES */
@@ -3,152 +3,326 @@
  * @brief Point d'entrée principal du programme.
  *
  * Ce fichier contient la fonction principale et la machine à états du jeu.
- * Il gère les différents états du jeu : DEBUT, REGLES, JEU et FIN.
+ * Il gère les différents états du jeu : DEBUT, REGLES, puis pour chaque question
+ * QUESTION, PLACEMENT, REVELATION et BILAN, et enfin FIN.
  *
  * @author hugog
  * @date May 21, 2025
  */
 
 #include "question.h"
+#include "banque_sd.h"
 #include "affichage.h"
 #include "argent.h"
+#include "bouton.h"
+#include "scores.h"
+#include "stm32g4_scheduler.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_dlog.h"
+#include "stm32g4_idle.h"
+#include "stm32g4_memwatch.h"
+#include "stm32g4_trace.h"
+#include "stm32g4_rng.h"
+#include "stm32g4_telemetry.h"
+#include "stm32g4_uart.h"
+#include "stm32g4_prof.h"
+#include "tft_ili9341/stm32g4_ili9341_anim.h"
+
+#define PERIODE_JEU_MS 10 /**< Période d'exécution de la machine à états (lecture des évènements des boutons, compte à rebours). */
+#define DUREE_QUESTION_MS 60000 /**< Temps laissé pour placer l'argent : à zéro, les trappes s'ouvrent d'elles-mêmes. */
+
+#define TRACE_MACHINE_ETAT (0 << 8) /**< Évènements TRACE_STATE : changements d'état du jeu. */
 
 /**
  * @brief États du jeu.
  *
  * Cette énumération représente les différents états possibles du jeu.
+ * Une partie enchaîne, pour chaque question : QUESTION, PLACEMENT, REVELATION, BILAN.
  */
 typedef enum {
-    DEBUT = 0, /**< État initial du jeu. */
-    REGLES,    /**< État affichant les règles du jeu. */
-    JEU,       /**< État principal du jeu. */
-    FIN        /**< État de fin du jeu. */
+    DEBUT = 0,  /**< État initial du jeu. */
+    REGLES,     /**< État affichant les règles du jeu. */
+    QUESTION,   /**< Tirer et afficher la question suivante. */
+    PLACEMENT,  /**< Le joueur place son argent sur les trappes, avant la fin du compte à rebours. */
+    REVELATION, /**< Les trappes s'ouvrent. */
+    BILAN,      /**< Affichage de l'argent restant. */
+    FIN,        /**< État de fin du jeu. */
+    NB_ETATS
 } etat_t;
 
+/**
+ * @brief Description d'un état : actions d'entrée, d'exécution et de sortie, et transition temporisée.
+ *
+ * Chaque action rend la main rapidement : la machine à états ne bloque jamais le processeur.
+ * Les actions absentes valent NULL.
+ */
+typedef struct {
+    void (*entree)(void);  /**< Appelée une fois, en entrant dans l'état. */
+    etat_t (*tick)(void);  /**< Appelée toutes les PERIODE_JEU_MS : retourne l'état suivant (le même pour y rester). */
+    void (*sortie)(void);  /**< Appelée une fois, en quittant l'état. */
+    uint32_t duree_ms;     /**< Durée de l'état (0 : pas de limite). */
+    etat_t apres_duree;    /**< État suivant quand la durée est écoulée. */
+} description_etat_t;
+
 etat_t etat = DEBUT; /**< État actuel du jeu. */
 
+static const Question *q; /**< Question en cours (dans question.c), conservée d'une exécution à l'autre. */
+static swtimer_t chrono; /**< Durée de l'état en cours (cf. description_etat_t). */
+static uint32_t debut_etat; /**< Date d'entrée dans l'état en cours [ms]. */
+static task_t tache_jeu; /**< Tâche exécutant la machine à états. */
+
+static void machine_etats(void);
+
+#if USE_TELEMETRY
+/**
+ * @brief Évènements de jeu envoyés sur TELEMETRY_CHANNEL_GAME_EVENT (champ event de telemetry_game_event_t).
+ */
+typedef enum {
+    EVENEMENT_ENTREE_ETAT = 1, /**< Entrée dans un état (champ state) ; value : argent du joueur après l'action d'entrée. */
+} evenement_jeu_t;
+
+/**
+ * @brief Envoyer un évènement de jeu (décodé sur PC par tools/telemetry_decode.c).
+ *
+ * Non bloquant : si le buffer d'émission de l'UART est plein, l'évènement est perdu.
+ */
+static void envoyer_evenement(evenement_jeu_t evenement, int32_t valeur) {
+    telemetry_game_event_t e = {HAL_GetTick(), (uint8_t)evenement, (uint8_t)etat, valeur};
+
+    BSP_TELEMETRY_send(TELEMETRY_CHANNEL_GAME_EVENT, &e, sizeof(e));
+}
+#endif
+
 /**
  * @brief Fonction principale.
  *
- * Initialise le système, configure les boutons et entre dans la boucle principale
- * du jeu, qui appelle la machine à états.
+ * Initialise le système, configure les boutons, puis confie la machine à états
+ * à l'ordonnanceur, qui l'exécute toutes les PERIODE_JEU_MS millisecondes et
+ * endort le processeur le reste du temps.
  */
 void main(void) {
+#if USE_MEMWATCH
+    BSP_MEMWATCH_init(); /**< Peinture de la pile, avant tout le reste. */
+#endif
     HAL_Init(); /**< Initialisation de la bibliothèque HAL. */
+#if USE_IDLE
+    BSP_IDLE_init(); /**< Repos sans tick quand la machine à états attend (étalonnage de LSI : 50 ms). */
+#endif
+#if USE_TRACE
+    BSP_TRACE_start(); /**< Enregistrement en continu des IT, transferts SPI et changements d'état (cf. BSP_TRACE_dump). */
+#endif
 
+#if USE_TELEMETRY
+    BSP_UART_init(UART2_ID, 115200); /**< UART de la sonde de débogage, TELEMETRY_UART par défaut. */
+    BSP_TELEMETRY_init(); /**< Changements d'état envoyés en trames binaires (envoyer_evenement). */
+#endif
+
+#if USE_RNG
+    BSP_RNG_init();
+    srand(BSP_RNG_get()); /**< Graine matérielle : time() vaut toujours la même chose au démarrage, sans RTC. */
+#else
     srand(time(NULL)); /**< Initialisation du générateur de nombres aléatoires. */
+#endif
 
-    // Initialisation des boutons
-    BSP_GPIO_pin_config(GPIOA, GPIO_PIN_0, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF); /**< Bouton haut. */
-    BSP_GPIO_pin_config(GPIOA, GPIO_PIN_1, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF); /**< Bouton droit. */
-    BSP_GPIO_pin_config(GPIOB, GPIO_PIN_5, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF); /**< Bouton centre. */
-    BSP_GPIO_pin_config(GPIOA, GPIO_PIN_9, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF); /**< Bouton gauche. */
-    BSP_GPIO_pin_config(GPIOA, GPIO_PIN_10, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF); /**< Bouton bas. */
+    ILI9341_Init(); /**< Écran initialisé une seule fois : les écrans suivants ne font que le redessiner. */
+    ILI9341_Rotate(ILI9341_Orientation_Landscape_2);
 
-    while (1) {
-        machine_etats(); /**< Appel de la machine à états. */
-    }
+#if USE_SCORES
+    scores_initialiser(); /**< Meilleurs scores relus en flash (première mise en service : effacement des pages du journal). */
+#endif
+
+    initialiser_boutons(); /**< Appuis détectés par interruption, même pendant un rafraîchissement de l'écran. */
+
+#if USE_BANQUE_SD
+    banque_sd_ouvrir(BANQUE_SD_FICHIER); /**< Sans carte ou sans fichier, le jeu garde la banque en flash. */
+#endif
+
+    BSP_SCHEDULER_task_init(&tache_jeu, &machine_etats, PERIODE_JEU_MS);
+    BSP_SCHEDULER_task_start(&tache_jeu, 0, PERIODE_JEU_MS);
+#if USE_MEMWATCH
+    BSP_SCHEDULER_add_idle_hook(&BSP_MEMWATCH_process_main); /**< Signale un débordement de la pile. */
+#endif
+#if USE_BANQUE_SD
+    BSP_SCHEDULER_add_idle_hook(&banque_sd_prechargement); /**< Lecture de la question suivante pendant que le joueur réfléchit. */
+#endif
+#if USE_DLOG
+    BSP_SCHEDULER_add_idle_hook(&BSP_DLOG_process_main); /**< Envoi des journaux quand il n'y a rien d'autre à faire. */
+#endif
+
+    BSP_SCHEDULER_run(); /**< Boucle principale : ne rend jamais la main. */
 }
 
 /**
- * @brief Machine à états du jeu.
- *
- * Gère les différents états du jeu : DEBUT, REGLES, JEU et FIN.
- * Chaque état correspond à une étape spécifique du jeu.
+ * @brief Nouvelle partie : remise à zéro et écran de début.
  */
-void machine_etats() {
-    switch (etat) {
-    case DEBUT:
-        // Réinitialiser les questions posées
-        for (int i = 0; i < 25; i++) {
-            questions_posees[i] = false;
-        }
+static void entree_debut(void) {
+    // Toutes les questions redeviennent disponibles, dans un nouvel ordre
+    melanger_questions();
 
-        // Réinitialiser les variables du jeu
-        argent_total = 150000;
-        argent_place = 0;
-        compteur_questions = 0; /**< Réinitialiser le compteur de questions. */
-        numero_question = 1;    /**< Réinitialiser le numéro de la question. */
-        for (int i = 0; i < 3; i++) {
-            argent_trappes[i] = 0;
-        }
+    // Réinitialiser les variables du jeu
+    argent_total = 150000;
+    argent_place = 0;
+    compteur_questions = 0; /**< Réinitialiser le compteur de questions. */
+    numero_question = 1;    /**< Réinitialiser le numéro de la question. */
+    for (int i = 0; i < 3; i++) {
+        argent_trappes[i] = 0;
+    }
 
-        afficher_ecran_debut(); /**< Afficher l'écran de début. */
+    afficher_ecran_debut(); /**< Afficher l'écran de début. */
+    BSP_BUTTON_flush(); /**< Les appuis de la partie précédente ne concernent pas cet écran. */
+}
 
-        // Attendre qu'un bouton soit pressé pour continuer
-        while (HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_0) && HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_1) &&
-               HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_5) && HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_9) &&
-               HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_10)) {}
+/**
+ * @brief Attendre qu'un bouton soit pressé pour continuer.
+ */
+static etat_t tick_debut(void) {
+    return appui_bouton() ? REGLES : DEBUT;
+}
 
-        etat = REGLES; /**< Passer à l'état REGLES. */
-        break;
+/**
+ * @brief Tirer la question suivante, ou finir la partie.
+ */
+static etat_t tick_question(void) {
+    if (compteur_questions >= QUESTIONS_PAR_PARTIE) { /**< Toutes les questions de la partie ont été posées. */
+        return FIN;
+    }
+    q = obtenir_question_suivante();
+    if (q == NULL) { /**< Si aucune question n'est disponible. */
+        return FIN;
+    }
 
-    case REGLES:
-        afficher_ecran_regles(); /**< Afficher l'écran des règles. */
-        HAL_Delay(6000); /**< Attendre 6 secondes. */
-        etat = JEU; /**< Passer à l'état JEU. */
-        break;
+    afficher_question(q); /**< Afficher la question et le numéro. */
+    mettre_a_jour_couleurs_trappes();
+    afficher_reponses(q);
+    return PLACEMENT;
+}
 
-    case JEU:
-        while (1) {
-            Question q = obtenir_question_suivante();
-            if (q.bonne_reponse == -1) { /**< Si aucune question n'est disponible. */
-                etat = FIN;
-                return;
-            }
+static void entree_placement(void) {
+    BSP_BUTTON_flush(); /**< Les appuis faits pendant le bilan ne comptent pas pour cette question. */
+    afficher_compte_a_rebours(DUREE_QUESTION_MS, DUREE_QUESTION_MS);
+}
 
-            afficher_question(q); /**< Afficher la question et le numéro. */
-            mettre_a_jour_couleurs_trappes();
-            afficher_reponses(q);
+/**
+ * @brief Placer ou retirer de l'argent ; valider si tout l'argent est placé et le bouton centre appuyé.
+ *
+ * À la fin du compte à rebours, les trappes s'ouvrent même si tout n'est pas placé :
+ * l'argent resté hors des trappes est perdu.
+ */
+static etat_t tick_placement(void) {
+    uint32_t ecoule = HAL_GetTick() - debut_etat;
 
-            while (1) {
-                gerer_boutons(q); /**< Gérer les boutons pour placer ou retirer de l'argent. */
+    afficher_compte_a_rebours((ecoule < DUREE_QUESTION_MS) ? DUREE_QUESTION_MS - ecoule : 0, DUREE_QUESTION_MS);
+    return gerer_boutons(q) ? REVELATION : PLACEMENT;
+}
 
-                // Si tout l'argent est placé et le bouton de validation est pressé
-                if (tout_argent_place() && HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_5) == 0) {
-                    valider_reponses(q);
-                    HAL_Delay(2000);
+static void entree_revelation(void) {
+    valider_reponses(q);
+}
 
-                    argent_total = calculer_argent_restant(q);
+/**
+ * @brief L'écran du bilan remplace celui des trappes : les animations encore en cours s'arrêtent.
+ */
+static void sortie_revelation(void) {
+#if USE_ILI9341_ANIM
+    ILI9341_ANIM_stop_all();
+#endif
+}
 
-                    if (argent_total == 0) {
-                        etat = FIN;
-                        return;
-                    }
+/**
+ * @brief Seul l'argent de la bonne trappe reste au joueur.
+ */
+static void entree_bilan(void) {
+    argent_total = calculer_argent_restant(q);
+    if (argent_total > 0) {
+        afficher_argent_restant(argent_total);
+    }
+}
 
-                    afficher_argent_restant(argent_total);
-                    HAL_Delay(3000);
+static etat_t tick_bilan(void) {
+    return (argent_total == 0) ? FIN : BILAN;
+}
 
-                    for (int i = 0; i < 3; i++) {
-                        argent_trappes[i] = 0;
-                    }
-                    argent_place = 0;
+/**
+ * @brief Préparer la question suivante.
+ */
+static void sortie_bilan(void) {
+    for (int i = 0; i < 3; i++) {
+        argent_trappes[i] = 0;
+    }
+    argent_place = 0;
 
-                    compteur_questions++; /**< Incrémenter le compteur de questions. */
-                    numero_question++;    /**< Incrémenter le numéro de la question. */
+    compteur_questions++; /**< Incrémenter le compteur de questions. */
+    numero_question++;    /**< Incrémenter le numéro de la question. */
+}
 
-                    if (compteur_questions >= 10) { /**< Vérifier si 10 questions ont été posées. */
-                        etat = FIN;
-                        return;
-                    }
+static void entree_fin(void) {
+#if USE_SCORES
+    scores_enregistrer_partie(argent_total); /**< Un enregistrement ajouté au journal en flash, sans effacement. */
+#endif
+    if (argent_total == 0) {
+        afficher_ecran_perdu(); /**< Afficher l'écran "PERDU". */
+    } else {
+        afficher_ecran_fin(argent_total); /**< Afficher l'écran de fin classique. */
+    }
+}
 
-                    break;
-                }
-            }
+/**
+ * @brief Table des états : actions et transitions temporisées.
+ */
+static const description_etat_t etats[NB_ETATS] = {
+    [DEBUT]      = {entree_debut, tick_debut, NULL, 0, DEBUT},
+    [REGLES]     = {afficher_ecran_regles, NULL, NULL, 6000, QUESTION},
+    [QUESTION]   = {NULL, tick_question, NULL, 0, QUESTION},
+    [PLACEMENT]  = {entree_placement, tick_placement, NULL, DUREE_QUESTION_MS, REVELATION},
+    [REVELATION] = {entree_revelation, NULL, sortie_revelation, 2000, BILAN},
+    [BILAN]      = {entree_bilan, tick_bilan, sortie_bilan, 3000, QUESTION},
+    [FIN]        = {entree_fin, NULL, NULL, 5000, DEBUT},
+};
+
+/**
+ * @brief Machine à états du jeu.
+ *
+ * Exécutée toutes les PERIODE_JEU_MS par l'ordonnanceur : entre dans l'état courant
+ * s'il vient de changer, exécute son action, puis change d'état si l'action le demande
+ * ou si la durée de l'état est écoulée (la sortie de l'ancien état est faite aussitôt,
+ * l'entrée dans le nouveau à l'exécution suivante).
+ *
+ * La durée d'une exécution se mesure avec la zone MACHINE_ETATS de stm32g4_prof.h
+ * (les entrées redessinent l'écran entier, les ticks seulement ce qui change) ;
+ * tache_jeu.missed_deadlines compte les exécutions terminées après leur échéance.
+ */
+static void machine_etats(void) {
+    static etat_t etat_precedent = NB_ETATS; /**< Différent de DEBUT : l'entrée dans DEBUT est faite au premier appel. */
+    const description_etat_t *d = &etats[etat];
+    etat_t suivant = etat;
+
+    PROF_ZONE_BEGIN(MACHINE_ETATS);
+    if (etat != etat_precedent) {
+        etat_precedent = etat;
+        TRACE_RECORD(TRACE_STATE, TRACE_MACHINE_ETAT | etat);
+        debut_etat = HAL_GetTick();
+        if (d->duree_ms) {
+            BSP_SWTIMER_start(&chrono, d->duree_ms, 0);
         }
-        etat = FIN;
-        break;
-
-    case FIN:
-        if (argent_total == 0) {
-            afficher_ecran_perdu(); /**< Afficher l'écran "PERDU". */
-            HAL_Delay(5000); /**< Attendre 5 secondes avant de retourner à l'écran DEBUT. */
-            etat = DEBUT; /**< Retourner à l'état DEBUT. */
-        } else {
-            afficher_ecran_fin(argent_total); /**< Afficher l'écran de fin classique. */
-            HAL_Delay(5000); /**< Attendre 5 secondes avant de retourner à l'écran DEBUT. */
-            etat = DEBUT; /**< Retourner à l'état DEBUT. */
+        if (d->entree) {
+            d->entree();
+        }
+#if USE_TELEMETRY
+        envoyer_evenement(EVENEMENT_ENTREE_ETAT, argent_total);
+#endif
+    }
+    if (d->tick) {
+        suivant = d->tick();
+    }
+    if (suivant == etat && d->duree_ms && !BSP_SWTIMER_is_running(&chrono)) {
+        suivant = d->apres_duree; /**< Durée écoulée. */
+    }
+    if (suivant != etat) {
+        BSP_SWTIMER_stop(&chrono);
+        if (d->sortie) {
+            d->sortie();
         }
-        break;
+        etat = suivant;
     }
+    PROF_ZONE_END(MACHINE_ETATS);
 }
@@ -10,91 +10,263 @@
  */
 
 #include "question.h"
+#include "banque_sd.h"
+#include <stddef.h>
 
 /**
- * @brief Liste des questions disponibles dans le jeu.
+ * @brief Banque des questions du jeu.
  *
- * Chaque question est composée d'un texte, de trois réponses possibles,
- * et de l'index de la bonne réponse (0, 1 ou 2).
- */
-Question questions[25] = {
-    {"Quel est le plus grand desert ?", {"Sahara", "Gobi", "Atacama"}, 0},
-    {"Quelle est la capitale de l'Allemagne ?", {"Munich", "Berlin", "Hambourg"}, 1},
-    {"Combien fait 7x8 ?", {"49", "64", "56"}, 2},
-    {"Qui a peint la Joconde ?", {"Leonard", "Michel", "Raphael"}, 0},
-    {"Quelle est la couleur du sang dans les veines ?", {"Bleu", "Rouge", "Violet"}, 1},
-    {"Quel sport se joue avec une batte ?", {"Golf", "Cricket", "Baseball"}, 2},
-    {"Qui a peint 'La Nuit etoilee' ?", {"Van Gogh", "Monet", "Picasso"}, 0},
-    {"Combien d’ailes a un papillon ?", {"6", "2", "4"}, 2},
-    {"Quelle planete est surnommee 'l'etoile du berger' ?", {"Mars", "Mercure", "Venus"}, 2},
-    {"Quelle matiere est liquide a temperature ambiante ?", {"Fer", "Cuivre", "Eau"}, 2},
-    {"Quelle est la valeur de pi ?", {"3,15", "3,14", "3,16"}, 1},
-    {"Quel est le nom de l’alphabet grec ?", {"Gamma", "Alpha", "Omega"}, 1},
-    {"Qui dirige un orchestre ?", {"Chef", "Soliste", "Pianiste"}, 0},
-    {"Combien d'annees dans un siecle ?", {"1000", "10", "100"}, 2},
-    {"Quel est le symbole de la paix ?", {"Etoile", "Colombe", "Rose"}, 1},
-    {"Quelle est la monnaie utilisee aux Etats-Unis ?", {"Euro", "Livre", "Dollar"}, 2},
-    {"Quel pays est connu pour les pyramides ?", {"Inde", "Mexique", "Egypte"}, 2},
-    {"Qui a decouvert l'Amerique ?", {"Magellan", "Colomb", "Cook"}, 1},
-    {"Quelle est la capitale de la Russie ?", {"Kiev", "Moscou", "Pekin"}, 1},
-    {"Quelle est la vitesse de la lumiere (km/s)?", {"290 000", "299 792", "300 000"}, 1},
-    {"Quel metal est le plus leger ?", {"Argent", "Cuivre", "Aluminium"}, 2},
-    {"Quelle galaxie contient notre systeme solaire ?", {"Centaur", "Voie Lactee", "Andromede"}, 1},
-    {"Qui a ecrit 'L'Odyssee' ?", {"Homere", "Sophocle", "Virgile"}, 0},
-    {"Combien de cordes a un violon ?", {"6", "4", "5"}, 1},
-    {"Quel est le point de congelation de l'eau en degres C ?", {"0", "-1", "-5"}, 0},
-};
-
-/**
- * @brief Tableau pour suivre les questions déjà posées.
+ * Une ligne par question : numéro (unique, sert à nommer ses textes), catégorie,
+ * difficulté, texte, trois réponses possibles et index de la bonne réponse (0, 1 ou 2).
+ */
+#define BANQUE_QUESTIONS(Q) \
+    Q( 0, GEOGRAPHIE, FACILE,    "Quel est le plus grand desert ?", "Sahara", "Gobi", "Atacama", 0) \
+    Q( 1, GEOGRAPHIE, FACILE,    "Quelle est la capitale de l'Allemagne ?", "Munich", "Berlin", "Hambourg", 1) \
+    Q( 2, SCIENCES,   FACILE,    "Combien fait 7x8 ?", "49", "64", "56", 2) \
+    Q( 3, ARTS,       FACILE,    "Qui a peint la Joconde ?", "Leonard", "Michel", "Raphael", 0) \
+    Q( 4, SCIENCES,   MOYEN,     "Quelle est la couleur du sang dans les veines ?", "Bleu", "Rouge", "Violet", 1) \
+    Q( 5, SPORT,      MOYEN,     "Quel sport se joue avec une batte ?", "Golf", "Cricket", "Baseball", 2) \
+    Q( 6, ARTS,       MOYEN,     "Qui a peint 'La Nuit etoilee' ?", "Van Gogh", "Monet", "Picasso", 0) \
+    Q( 7, SCIENCES,   FACILE,    "Combien d’ailes a un papillon ?", "6", "2", "4", 2) \
+    Q( 8, SCIENCES,   MOYEN,     "Quelle planete est surnommee 'l'etoile du berger' ?", "Mars", "Mercure", "Venus", 2) \
+    Q( 9, SCIENCES,   FACILE,    "Quelle matiere est liquide a temperature ambiante ?", "Fer", "Cuivre", "Eau", 2) \
+    Q(10, SCIENCES,   FACILE,    "Quelle est la valeur de pi ?", "3,15", "3,14", "3,16", 1) \
+    Q(11, CULTURE,    MOYEN,     "Quel est le nom de l’alphabet grec ?", "Gamma", "Alpha", "Omega", 1) \
+    Q(12, ARTS,       FACILE,    "Qui dirige un orchestre ?", "Chef", "Soliste", "Pianiste", 0) \
+    Q(13, CULTURE,    FACILE,    "Combien d'annees dans un siecle ?", "1000", "10", "100", 2) \
+    Q(14, CULTURE,    FACILE,    "Quel est le symbole de la paix ?", "Etoile", "Colombe", "Rose", 1) \
+    Q(15, GEOGRAPHIE, FACILE,    "Quelle est la monnaie utilisee aux Etats-Unis ?", "Euro", "Livre", "Dollar", 2) \
+    Q(16, GEOGRAPHIE, FACILE,    "Quel pays est connu pour les pyramides ?", "Inde", "Mexique", "Egypte", 2) \
+    Q(17, HISTOIRE,   MOYEN,     "Qui a decouvert l'Amerique ?", "Magellan", "Colomb", "Cook", 1) \
+    Q(18, GEOGRAPHIE, FACILE,    "Quelle est la capitale de la Russie ?", "Kiev", "Moscou", "Pekin", 1) \
+    Q(19, SCIENCES,   DIFFICILE, "Quelle est la vitesse de la lumiere (km/s)?", "290 000", "299 792", "300 000", 1) \
+    Q(20, SCIENCES,   DIFFICILE, "Quel metal est le plus leger ?", "Argent", "Cuivre", "Aluminium", 2) \
+    Q(21, SCIENCES,   MOYEN,     "Quelle galaxie contient notre systeme solaire ?", "Centaur", "Voie Lactee", "Andromede", 1) \
+    Q(22, ARTS,       DIFFICILE, "Qui a ecrit 'L'Odyssee' ?", "Homere", "Sophocle", "Virgile", 0) \
+    Q(23, ARTS,       DIFFICILE, "Combien de cordes a un violon ?", "6", "4", "5", 1) \
+    Q(24, SCIENCES,   MOYEN,     "Quel est le point de congelation de l'eau en degres C ?", "0", "-1", "-5", 0)
+
+/**
+ * @brief Réserve de chaînes : tous les textes de la banque, bout à bout.
+ *
+ * Chaque texte est un tableau de la taille exacte de sa chaîne : pas de
+ * remplissage entre deux textes, et offsetof() donne sa position.
+ */
+#define CHAMPS_TEXTES(n, cat, diff, q, r0, r1, r2, bonne) \
+    char question_##n[sizeof(q)];                        \
+    char reponse_a_##n[sizeof(r0)];                      \
+    char reponse_b_##n[sizeof(r1)];                      \
+    char reponse_c_##n[sizeof(r2)];
+
+#define VALEURS_TEXTES(n, cat, diff, q, r0, r1, r2, bonne) q, r0, r1, r2,
+
+#define FICHE(n, cat, diff, q, r0, r1, r2, bonne)                                           \
+    {offsetof(reserve_textes_t, question_##n),                                              \
+     {offsetof(reserve_textes_t, reponse_a_##n), offsetof(reserve_textes_t, reponse_b_##n), \
+      offsetof(reserve_textes_t, reponse_c_##n)},                                            \
+     (bonne), CATEGORIE_##cat, DIFFICULTE_##diff},
+
+typedef struct {
+    BANQUE_QUESTIONS(CHAMPS_TEXTES)
+} reserve_textes_t;
+
+_Static_assert(sizeof(reserve_textes_t) <= UINT16_MAX, "Positions des textes sur 16 bits : banque de questions trop grande");
+
+static const reserve_textes_t reserve_textes = {BANQUE_QUESTIONS(VALEURS_TEXTES)};
+
+static const fiche_question_t fiches[] = {BANQUE_QUESTIONS(FICHE)};
+
+#define NB_QUESTIONS ARRAY_SIZE(fiches)
+
+_Static_assert(NB_QUESTIONS <= UINT16_MAX, "Index des questions sur 16 bits : banque de questions trop grande");
+
+/**
+ * @brief Paquet mélangé : les index de toutes les questions, rangés en une pile
+ * par difficulté et par catégorie, chaque pile dans un ordre aléatoire.
  *
- * Chaque élément du tableau est un booléen indiquant si la question
- * correspondante a déjà été posée (`true`) ou non (`false`).
+ * Tirer une question revient à prendre le sommet d'une pile : pas de recherche,
+ * pas de tirage à refaire quand il ne reste plus que quelques questions.
  */
-bool questions_posees[20] = {false};
+static uint16_t paquet[NB_QUESTIONS];
+static uint16_t sommet_pile[NB_PILES]; /**< Prochaine question de chaque pile dans le paquet. */
+static uint16_t fin_pile[NB_PILES];    /**< Fin de chaque pile dans le paquet. */
+static uint8_t derniere_categorie;     /**< Catégorie du dernier tirage : on alterne les thèmes. */
 
 /**
  * @brief Compteur pour suivre le nombre de questions posées.
  */
 int compteur_questions = 0;
 
+/**
+ * @brief Dernière question tirée (renvoyée par pointeur par obtenir_question_suivante).
+ */
+static Question question_courante;
+
 /**
  * @brief Numéro de la question actuelle.
  */
 int numero_question = 1;
 
 /**
- * @brief Obtenir la prochaine question non posée.
- *
- * Cette fonction sélectionne une question aléatoire parmi celles qui n'ont pas encore été posées.
- * Si toutes les questions ont été posées, elle retourne une question vide.
+ * @brief Nombre aléatoire de [0, n[ (n > 0), sans biais.
+ */
+uint32_t hasard(uint32_t n) {
+    uint32_t limite = RAND_MAX - (RAND_MAX % n); /**< Les tirages au-delà favoriseraient les petites valeurs. */
+    uint32_t r;
+    do {
+        r = (uint32_t)rand();
+    } while (r >= limite);
+    return r % n;
+}
+
+/**
+ * @brief Mélanger le paquet de questions, en début de partie.
  *
- * @return La prochaine question ou une question vide si toutes les questions ont été posées.
+ * Range les questions par difficulté et par catégorie (tri par comptage),
+ * puis mélange chaque pile (Fisher-Yates) : O(nombre de questions).
+ * Le générateur rand() doit avoir été initialisé par srand().
  */
-Question obtenir_question_suivante(void) {
-    int questions_restantes = 0;
+void melanger_questions(void) {
+    uint16_t position = 0;
+
+    // Taille de chaque pile, puis position de son début dans le paquet
+    for (int p = 0; p < NB_PILES; p++) {
+        fin_pile[p] = 0;
+    }
+    for (uint16_t i = 0; i < NB_QUESTIONS; i++) {
+        fin_pile[PILE(fiches[i].difficulte, fiches[i].categorie)]++;
+    }
+    for (int p = 0; p < NB_PILES; p++) {
+        sommet_pile[p] = position;
+        position += fin_pile[p];
+        fin_pile[p] = sommet_pile[p];
+    }
+    for (uint16_t i = 0; i < NB_QUESTIONS; i++) {
+        paquet[fin_pile[PILE(fiches[i].difficulte, fiches[i].categorie)]++] = i;
+    }
 
-    // Vérifier combien de questions restent à poser
-    for (int i = 0; i < 25; i++) {
-        if (!questions_posees[i]) {
-            questions_restantes++;
+    // Fisher-Yates dans chaque pile
+    for (int p = 0; p < NB_PILES; p++) {
+        for (int i = fin_pile[p] - 1; i > sommet_pile[p]; i--) {
+            uint16_t j = sommet_pile[p] + hasard(i - sommet_pile[p] + 1);
+            uint16_t echange = paquet[i];
+            paquet[i] = paquet[j];
+            paquet[j] = echange;
         }
     }
+    derniere_categorie = hasard(CATEGORIE_NB);
+
+#if USE_BANQUE_SD
+    banque_sd_melanger();
+#endif
+}
+
+/**
+ * @brief Questions encore disponibles dans une pile du paquet en flash.
+ */
+static uint32_t restantes_flash(int pile) {
+    return fin_pile[pile] - sommet_pile[pile];
+}
 
-    // Si toutes les questions ont été posées, retourner une question vide
-    if (questions_restantes == 0) {
-        return (Question){"", {"", "", ""}, -1}; // Retourner une question vide
+/**
+ * @brief Choisir la pile du prochain tirage.
+ *
+ * Questions faciles en début de partie, plus difficiles ensuite : si la difficulté
+ * souhaitée est épuisée, la plus proche est utilisée (la plus facile d'abord).
+ * Dans une difficulté, le thème change à chaque tirage.
+ *
+ * @param rang Rang de la question dans la partie (0 pour la première).
+ * @param restantes Nombre de questions encore disponibles dans une pile.
+ * @return La pile (PILE(difficulte, categorie)), ou -1 si toutes les piles sont vides.
+ */
+int choisir_pile(int rang, uint32_t (*restantes)(int pile)) {
+    int souhaitee = (rang * DIFFICULTE_NB) / QUESTIONS_PAR_PARTIE;
+
+    if (souhaitee >= DIFFICULTE_NB) {
+        souhaitee = DIFFICULTE_NB - 1;
     }
 
-    // Choisir une question au hasard parmi celles qui n'ont pas été posées
+    for (int ecart = 0; ecart < DIFFICULTE_NB; ecart++) {
+        for (int sens = -1; sens <= 1; sens += 2) {
+            int difficulte = souhaitee + sens * ecart;
+            if (difficulte < 0 || difficulte >= DIFFICULTE_NB || (ecart == 0 && sens > 0)) {
+                continue;
+            }
+            for (int i = 1; i <= CATEGORIE_NB; i++) {
+                uint8_t categorie = (derniere_categorie + i) % CATEGORIE_NB;
+                if (restantes(PILE(difficulte, categorie)) > 0) {
+                    derniere_categorie = categorie;
+                    return PILE(difficulte, categorie);
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Obtenir la prochaine question non posée.
+ *
+ * Cette fonction tire la question suivante du paquet mélangé par melanger_questions() :
+ * questions faciles en début de partie, plus difficiles ensuite, en alternant les thèmes.
+ * Avec USE_BANQUE_SD, la question vient de la carte SD quand la banque y est ouverte,
+ * et du paquet en flash sinon (ou si la carte devient illisible).
+ * La question est conservée jusqu'au tirage suivant : les fonctions
+ * du jeu la reçoivent par pointeur, sans recopie.
+ *
+ * @return La prochaine question, ou NULL si toutes les questions ont été posées.
+ */
+const Question *obtenir_question_suivante(void) {
+    int pile;
     int index;
-    do {
-        index = rand() % 25; // Générer un index aléatoire entre 0 et 24
-    } while (questions_posees[index]);
 
-    // Marquer la question comme posée
-    questions_posees[index] = true;
+#if USE_BANQUE_SD
+    if (banque_sd_ouverte()) {
+        const Question *question_sd = banque_sd_question_suivante();
+        if (question_sd != NULL || banque_sd_ouverte()) {
+            return question_sd;
+        }
+    }
+#endif
+
+    // Si toutes les questions ont été posées, il n'y a plus de question
+    pile = choisir_pile(compteur_questions, &restantes_flash);
+    if (pile < 0) {
+        return NULL;
+    }
+    index = paquet[sommet_pile[pile]++];
 
     // Retourner la question choisie
-    return questions[index];
+    question_courante = (Question){texte_question(index),
+                                   {texte_reponse(index, 0), texte_reponse(index, 1), texte_reponse(index, 2)},
+                                   fiches[index].bonne_reponse};
+    return &question_courante;
+}
+
+/**
+ * @brief Nombre de questions de la banque.
+ */
+uint16_t nombre_questions(void) {
+    return NB_QUESTIONS;
+}
+
+/**
+ * @brief Fiche d'une question de la banque.
+ */
+const fiche_question_t *fiche_question(uint16_t index) {
+    return &fiches[index];
+}
+
+/**
+ * @brief Texte d'une question de la banque.
+ */
+const char *texte_question(uint16_t index) {
+    return (const char *)&reserve_textes + fiches[index].question;
+}
+
+/**
+ * @brief Texte d'une des trois réponses d'une question de la banque.
+ */
+const char *texte_reponse(uint16_t index, uint8_t reponse) {
+    return (const char *)&reserve_textes + fiches[index].reponses[reponse];
 }
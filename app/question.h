@@ -26,12 +26,9 @@
 #include <time.h>
 
 /**
- * @brief Tableau pour suivre les questions posées.
- *
- * Chaque élément du tableau est un booléen indiquant si la question
- * correspondante a déjà été posée (`true`) ou non (`false`).
+ * @brief Nombre de questions posées au cours d'une partie.
  */
-extern bool questions_posees[20];
+#define QUESTIONS_PAR_PARTIE 10
 
 /**
  * @brief Compteur pour suivre le nombre de questions posées.
@@ -44,32 +41,127 @@ extern int compteur_questions;
 extern int numero_question;
 
 /**
- * @brief Structure représentant une question.
+ * @brief Thème d'une question.
+ */
+typedef enum {
+    CATEGORIE_CULTURE = 0, /**< Culture générale. */
+    CATEGORIE_GEOGRAPHIE,  /**< Pays, capitales, reliefs. */
+    CATEGORIE_SCIENCES,    /**< Mathématiques, physique, nature. */
+    CATEGORIE_ARTS,        /**< Peinture, littérature, musique. */
+    CATEGORIE_HISTOIRE,    /**< Histoire. */
+    CATEGORIE_SPORT,       /**< Sport. */
+    CATEGORIE_NB
+} categorie_t;
+
+/**
+ * @brief Difficulté d'une question.
+ */
+typedef enum {
+    DIFFICULTE_FACILE = 0,
+    DIFFICULTE_MOYEN,
+    DIFFICULTE_DIFFICILE,
+    DIFFICULTE_NB
+} difficulte_t;
+
+/**
+ * @brief Fiche d'une question dans la banque (en flash).
+ *
+ * Les textes ne sont pas stockés dans la fiche : ce sont des positions dans
+ * une réserve de chaînes commune, où chaque texte n'occupe que sa longueur.
+ */
+typedef struct {
+    uint16_t question;     /**< Position du texte de la question dans la réserve de chaînes. */
+    uint16_t reponses[3];  /**< Positions des textes des trois réponses. */
+    uint8_t bonne_reponse; /**< Index de la bonne réponse (0, 1 ou 2). */
+    uint8_t categorie;     /**< @ref categorie_t */
+    uint8_t difficulte;    /**< @ref difficulte_t */
+} fiche_question_t;
+
+/**
+ * @brief Question en cours, vue sur les textes de la banque.
  *
- * Cette structure contient le texte de la question, un tableau de réponses possibles,
- * et l'index de la bonne réponse.
+ * Les textes pointent directement dans la flash : rien n'est recopié en RAM.
+ * Les fonctions du jeu la reçoivent par pointeur (const Question *), jamais par valeur.
  */
 typedef struct {
-    char question[256];      /**< Texte de la question. */
-    char reponses[3][256];   /**< Tableau des réponses possibles. */
+    const char *question;    /**< Texte de la question. */
+    const char *reponses[3]; /**< Textes des réponses possibles. */
     int bonne_reponse;       /**< Index de la bonne réponse (0, 1 ou 2). */
 } Question;
 
 /**
- * @brief Liste des questions disponibles.
+ * @brief Nombre de questions de la banque.
+ */
+uint16_t nombre_questions(void);
+
+/**
+ * @brief Fiche d'une question de la banque.
+ *
+ * @param index Index de la question (inférieur à nombre_questions()).
+ * @return La fiche, en flash.
+ */
+const fiche_question_t *fiche_question(uint16_t index);
+
+/**
+ * @brief Texte d'une question de la banque.
+ *
+ * @param index Index de la question (inférieur à nombre_questions()).
+ * @return Le texte, en flash.
+ */
+const char *texte_question(uint16_t index);
+
+/**
+ * @brief Texte d'une des trois réponses d'une question de la banque.
+ *
+ * @param index Index de la question (inférieur à nombre_questions()).
+ * @param reponse Numéro de la réponse (0, 1 ou 2).
+ * @return Le texte, en flash.
+ */
+const char *texte_reponse(uint16_t index, uint8_t reponse);
+
+/**
+ * @brief Nombre de piles de questions : une par difficulté et par catégorie.
+ */
+#define NB_PILES (DIFFICULTE_NB * CATEGORIE_NB)
+
+/**
+ * @brief Pile des questions d'une difficulté et d'une catégorie.
+ */
+#define PILE(difficulte, categorie) ((difficulte) * CATEGORIE_NB + (categorie))
+
+/**
+ * @brief Nombre aléatoire de [0, n[ (n > 0), sans biais (générateur rand()).
+ */
+uint32_t hasard(uint32_t n);
+
+/**
+ * @brief Choisir la pile du prochain tirage (difficulté selon la progression, thèmes en alternance).
+ *
+ * @param rang Rang de la question dans la partie (0 pour la première).
+ * @param restantes Nombre de questions encore disponibles dans une pile.
+ * @return La pile (PILE(difficulte, categorie)), ou -1 si toutes les piles sont vides.
+ */
+int choisir_pile(int rang, uint32_t (*restantes)(int pile));
+
+/**
+ * @brief Mélanger le paquet de questions, en début de partie.
  *
- * Ce tableau contient toutes les questions disponibles dans le jeu.
+ * Toutes les questions redeviennent disponibles, dans un ordre aléatoire
+ * (générateur rand(), initialisé par srand()).
  */
-extern Question questions[25];
+void melanger_questions(void);
 
 /**
  * @brief Obtenir la prochaine question non posée.
  *
- * Cette fonction sélectionne une question aléatoire parmi celles qui n'ont pas encore été posées.
- * Si toutes les questions ont été posées, elle retourne une question vide.
+ * Cette fonction tire la question suivante du paquet mélangé par melanger_questions() :
+ * questions faciles en début de partie, plus difficiles ensuite, en alternant les thèmes.
+ * Avec USE_BANQUE_SD, la question vient de la banque sur carte SD quand elle est ouverte.
+ * La question est conservée jusqu'au tirage suivant : les fonctions
+ * du jeu la reçoivent par pointeur, sans recopie.
  *
- * @return La prochaine question ou une question vide si toutes les questions ont été posées.
+ * @return La prochaine question, ou NULL si toutes les questions ont été posées.
  */
-Question obtenir_question_suivante(void);
+const Question *obtenir_question_suivante(void);
 
 #endif /* QUESTION_H_ */
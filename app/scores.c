@@ -0,0 +1,127 @@
+/**
+ * @file scores.c
+ * @brief Meilleurs scores et statistiques des parties, conservés en flash.
+ *
+ * Un enregistrement du journal (48 bits) : son type sur 8 bits, puis 40 bits de données.
+ * - ENREGISTREMENT_PARTIE : une partie terminée, avec son montant final ;
+ * - ENREGISTREMENT_STATISTIQUES et ENREGISTREMENT_SCORE : l'instantané écrit en tête
+ *   d'une nouvelle page du journal, qui redonne les scores sans les parties qu'il résume.
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#include "scores.h"
+
+#if USE_SCORES
+#include "stm32g4_flashlog.h"
+#include "stm32g4_dlog.h"
+#include <stdio.h>
+
+#if !USE_FLASHLOG
+#error "USE_SCORES nécessite USE_FLASHLOG"
+#endif
+
+#define ENREGISTREMENT_PARTIE 1       /**< Donnée : montant final. */
+#define ENREGISTREMENT_STATISTIQUES 2 /**< Donnée : parties (20 bits), puis parties perdues (20 bits). */
+#define ENREGISTREMENT_SCORE 3        /**< Donnée : un des meilleurs montants. */
+
+#define BITS_DONNEE 40
+#define DONNEE_MAX ((1ULL << BITS_DONNEE) - 1)
+#define COMPTEUR_MAX 0xFFFFFu /**< Compteurs de l'instantané, sur 20 bits. */
+
+static scores_t scores; /**< Reconstruit au démarrage, puis tenu à jour. */
+
+static uint64_t enregistrement(uint8_t type, uint64_t donnee) {
+    return ((uint64_t)type << BITS_DONNEE) | (donnee & DONNEE_MAX);
+}
+
+/**
+ * @brief Insère un montant dans le tableau des meilleurs scores, s'il y a sa place.
+ */
+static void inserer_meilleur(uint32_t argent) {
+    int i = scores.nb_meilleurs;
+
+    if (i == SCORES_NB) {
+        if (argent <= scores.meilleurs[SCORES_NB - 1]) {
+            return;
+        }
+        i--;
+    } else {
+        scores.nb_meilleurs++;
+    }
+    for (; i > 0 && scores.meilleurs[i - 1] < argent; i--) {
+        scores.meilleurs[i] = scores.meilleurs[i - 1];
+    }
+    scores.meilleurs[i] = argent;
+}
+
+static void compter_partie(uint32_t argent) {
+    scores.parties++;
+    if (argent == 0) {
+        scores.parties_perdues++;
+    }
+    inserer_meilleur(argent);
+}
+
+/**
+ * @brief Rejoue un enregistrement du journal (au démarrage).
+ */
+static void rejouer(uint64_t e) {
+    uint64_t donnee = e & DONNEE_MAX;
+
+    switch ((uint8_t)(e >> BITS_DONNEE)) {
+    case ENREGISTREMENT_PARTIE:
+        compter_partie((uint32_t)donnee);
+        break;
+    case ENREGISTREMENT_STATISTIQUES:
+        scores.parties = (uint32_t)(donnee >> 20);
+        scores.parties_perdues = (uint32_t)(donnee & COMPTEUR_MAX);
+        break;
+    case ENREGISTREMENT_SCORE:
+        inserer_meilleur((uint32_t)donnee);
+        break;
+    default: /**< Type inconnu (version ultérieure) : ignoré. */
+        break;
+    }
+}
+
+/**
+ * @brief Instantané des scores, écrit en tête de la page suivante du journal quand la page courante est pleine.
+ */
+static uint16_t instantane(uint64_t *e, uint16_t max) {
+    uint16_t n = 0;
+    uint32_t parties = scores.parties > COMPTEUR_MAX ? COMPTEUR_MAX : scores.parties;
+    uint32_t perdues = scores.parties_perdues > COMPTEUR_MAX ? COMPTEUR_MAX : scores.parties_perdues;
+
+    e[n++] = enregistrement(ENREGISTREMENT_STATISTIQUES, (uint64_t)parties << 20 | perdues);
+    for (int i = 0; i < scores.nb_meilleurs && n < max; i++) {
+        e[n++] = enregistrement(ENREGISTREMENT_SCORE, scores.meilleurs[i]);
+    }
+    return n;
+}
+
+void scores_initialiser(void) {
+    flashlog_stats_t s;
+
+    BSP_FLASHLOG_init(&rejouer, &instantane);
+    BSP_FLASHLOG_get_stats(&s);
+    DLOG("scores : %lu parties, page %lu (%u/%u), %lu ignores\n", (unsigned long)scores.parties,
+         (unsigned long)s.sequence, s.used, s.capacity, (unsigned long)s.corrupted);
+}
+
+void scores_enregistrer_partie(int argent_final) {
+    uint32_t argent = argent_final > 0 ? (uint32_t)argent_final : 0;
+
+    /* D'abord le journal : un changement de page y écrit l'instantané des parties précédentes, sans celle-ci. */
+    if (!BSP_FLASHLOG_append(enregistrement(ENREGISTREMENT_PARTIE, argent))) {
+        DLOG("scores : echec de l'ecriture en flash\n");
+    }
+    compter_partie(argent);
+}
+
+const scores_t *scores_obtenir(void) {
+    return &scores;
+}
+
+#endif /* USE_SCORES */
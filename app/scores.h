@@ -0,0 +1,55 @@
+/**
+ * @file scores.h
+ * @brief Meilleurs scores et statistiques des parties, conservés en flash.
+ *
+ * Chaque fin de partie est un enregistrement ajouté au journal en flash
+ * (drivers/bsp/stm32g4_flashlog.h) : rien n'est effacé à chaque partie.
+ * Au démarrage, le tableau des meilleurs scores est reconstruit en RAM en
+ * relisant le journal une seule fois.
+ *
+ * @author hugog
+ * @date Oct 18, 2026
+ */
+
+#ifndef SCORES_H_
+#define SCORES_H_
+
+#include "config.h"
+#include <stdint.h>
+
+#ifndef SCORES_NB
+#define SCORES_NB 5 /**< Meilleurs scores conservés. */
+#endif
+
+/**
+ * @brief Statistiques de toutes les parties jouées depuis la première mise en service.
+ */
+typedef struct {
+    uint32_t parties;            /**< Parties terminées. */
+    uint32_t parties_perdues;    /**< Parties terminées sans argent. */
+    uint32_t meilleurs[SCORES_NB]; /**< Meilleurs montants finaux, du plus grand au plus petit. */
+    uint8_t nb_meilleurs;        /**< Cases utilisées dans meilleurs. */
+} scores_t;
+
+#if USE_SCORES
+
+/**
+ * @brief Relire le journal en flash et reconstruire les scores. À appeler une fois au démarrage.
+ */
+void scores_initialiser(void);
+
+/**
+ * @brief Enregistrer une partie terminée (en flash et en RAM).
+ *
+ * @param argent_final Argent restant à la fin de la partie (0 : partie perdue).
+ */
+void scores_enregistrer_partie(int argent_final);
+
+/**
+ * @brief Scores et statistiques actuels.
+ */
+const scores_t *scores_obtenir(void);
+
+#endif /* USE_SCORES */
+
+#endif /* SCORES_H_ */
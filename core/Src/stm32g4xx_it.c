@@ -19,6 +19,7 @@
 #include "config.h"
 #include "stm32g4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
+#include "stm32g4_flash.h"
 
 /* Private typedef -----------------------------------------------------------*/
 
@@ -50,6 +51,8 @@
   */
 void NMI_Handler(void)
 {
+  if(BSP_FLASH_NMI_ecc())   //Double erreur ECC pendant BSP_FLASH_read_ecc (double mot à moitié programmé) : signalée à l'appelant
+    return;
 
   while (1)
   {
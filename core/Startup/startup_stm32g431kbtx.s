@@ -44,6 +44,13 @@ defined in linker script */
 .word	_sbss
 /* end address for the .bss section. defined in linker script */
 .word	_ebss
+/* start address for the initialization values of the .ccmram section (CCM SRAM). defined in linker script */
+.word	_siccmram
+/* start and end addresses for the .ccmram and .ccmram_bss sections. defined in linker script */
+.word	_sccmram
+.word	_eccmram
+.word	_sccmbss
+.word	_eccmbss
 
 .equ  BootRAM,        0xF1E0F85F
 /**
@@ -96,6 +103,37 @@ FillZerobss:
 LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
+
+/* Copy the CCM SRAM code and data from flash (.ccmram section) */
+  ldr r0, =_sccmram
+  ldr r1, =_eccmram
+  ldr r2, =_siccmram
+  movs r3, #0
+  b LoopCopyCcmramInit
+
+CopyCcmramInit:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyCcmramInit:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyCcmramInit
+
+/* Zero fill the CCM SRAM bss (.ccmram_bss section) */
+  ldr r2, =_sccmbss
+  ldr r4, =_eccmbss
+  movs r3, #0
+  b LoopFillZeroCcmbss
+
+FillZeroCcmbss:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopFillZeroCcmbss:
+  cmp r2, r4
+  bcc FillZeroCcmbss
 /* Call static constructors */
     bl __libc_init_array
 
@@ -11,11 +11,16 @@
 #if USE_DHT11
 
 #include "stm32g4_dht11.h"
-#include "stm32g4_systick.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_timebase.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_extit.h"
 #include <stdio.h>
 
+#if !USE_TIMEBASE
+	#error "Le module DHT11 mesure la dure des impulsions avec stm32g4_timebase.c : activez USE_TIMEBASE"
+#endif
+
 #define NB_BITS	41	//le bit de poids fort n'appartiennent pas aux donnes utiles. (il s'agit de la rponse du capteur avant la trame utile).
 
 
@@ -29,7 +34,7 @@ static uint32_t rising_time_us = 0;
 static volatile bool flag_end_of_reception = false;
 static volatile uint64_t trame;
 static volatile uint8_t index = 0;
-static volatile uint32_t t = 0;
+static swtimer_t timer;	//Chrono de la machine  tats (timer logiciel, cf. stm32g4_swtimer.c)
 
 /**
  * @brief Fonction pour initialiser les GPIO.
@@ -40,6 +45,7 @@ void BSP_DHT11_init(GPIO_TypeDef * GPIOx, uint16_t GPIO_PIN_x)
 {
 	DHT11_gpio = GPIOx;
 	DHT11_pin = GPIO_PIN_x;
+	BSP_TIMEBASE_init();
 	HAL_GPIO_WritePin(DHT11_gpio, DHT11_pin, 1);
 	BSP_GPIO_pin_config(DHT11_gpio, DHT11_pin, GPIO_MODE_OUTPUT_OD, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF);
 //	BSP_GPIO_pin_config(GPIOB, GPIO_PIN_3, GPIO_MODE_OUTPUT_PP, GPIO_NOPULL, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF);	//utile  des fins de dbogage
@@ -81,12 +87,6 @@ void BSP_DHT11_demo(void)
 }
 
 
-static void DHT11_process_ms(void)
-{
-	if(t)
-		t--;
-}
-
 /**
  * @brief Cette fonction va tre appele automatiquement lorsqu'une donne sera reue sur le pin data du capteur.
  * @param pin: voir le fichier stm32g4_extit.c
@@ -96,7 +96,7 @@ static void DHT11_callback_exti(uint16_t pin)
 	if(1<<pin == DHT11_pin)
 	{
 		uint32_t current_time;
-		current_time = BSP_systick_get_time_us();
+		current_time = BSP_TIMEBASE_get_us();
 
 		bool pin_state = HAL_GPIO_ReadPin(DHT11_gpio, DHT11_pin);
 		if(index < NB_BITS)
@@ -110,11 +110,7 @@ static void DHT11_callback_exti(uint16_t pin)
 				uint32_t falling_time_us;
 				falling_time_us = current_time; //on conserve la diffrence entre le front montant et le front descendant
 
-				if(falling_time_us < rising_time_us)
-				{
-					falling_time_us+=1000;
-				}
-				if(falling_time_us - rising_time_us > 50)
+				if(falling_time_us - rising_time_us > 50)	//diffrence non signe : correcte mme si le compteur a fait un tour
 				{
 					trame |= (uint64_t)(1) << (NB_BITS - 1 - index);
 
@@ -171,7 +167,6 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 			if(initialized)
 			{
 				state = SEND_START_SIGNAL;
-				BSP_systick_add_callback_function(&DHT11_process_ms);
 				BSP_EXTIT_set_callback(&DHT11_callback_exti, BSP_EXTIT_gpiopin_to_pin_number(DHT11_pin), false);
 			}
 			else
@@ -184,7 +179,7 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 		case SEND_START_SIGNAL:
 			if(entrance)
 			{
-				t = 20;
+				BSP_SWTIMER_start(&timer, 20, 0);
 				index = 0;
 				trame = 0;
 				rising_time_us = 0;
@@ -192,7 +187,7 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 				BSP_GPIO_pin_config(DHT11_gpio, DHT11_pin, GPIO_MODE_OUTPUT_OD, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF);
 				HAL_GPIO_WritePin(DHT11_gpio, DHT11_pin, 0);
 			}
-			if(!t)
+			if(!BSP_SWTIMER_is_running(&timer))
 			{
 				BSP_GPIO_pin_config(DHT11_gpio, DHT11_pin, GPIO_MODE_IT_RISING_FALLING, GPIO_PULLUP, GPIO_SPEED_FREQ_HIGH, GPIO_NO_AF);
 				HAL_GPIO_WritePin(DHT11_gpio, DHT11_pin, 1);
@@ -205,11 +200,11 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 		case WAIT_DHT_ANSWER:
 			if(entrance)
 			{
-				t = 100;
+				BSP_SWTIMER_start(&timer, 100, 0);
 			}
 			if(flag_end_of_reception)
 				state = END_OF_RECEPTION;
-			if(!t)
+			if(!BSP_SWTIMER_is_running(&timer))
 			{
 			//	UART_putc(UART1_ID, index);
 				BSP_EXTIT_disable(BSP_EXTIT_gpiopin_to_pin_number(DHT11_pin));
@@ -218,7 +213,7 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 			break;
 		case TIMEOUT:
 			ret = END_TIMEOUT;
-			t = 100;
+			BSP_SWTIMER_start(&timer, 100, 0);
 			state = WAIT_BEFORE_NEXT_ASK;
 			break;
 		case END_OF_RECEPTION:
@@ -227,11 +222,11 @@ running_t BSP_DHT11_state_machine_get_datas(uint8_t * humidity_int, uint8_t * hu
 				ret = END_OK;
 			else
 				ret = END_ERROR;
-			t = 1000;
+			BSP_SWTIMER_start(&timer, 1000, 0);
 			state = WAIT_BEFORE_NEXT_ASK;
 			break;
 		case WAIT_BEFORE_NEXT_ASK:
-			if(!t)
+			if(!BSP_SWTIMER_is_running(&timer))
 				state = SEND_START_SIGNAL;
 			break;
 		default:
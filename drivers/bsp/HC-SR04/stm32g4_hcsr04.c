@@ -12,16 +12,17 @@
 #include "stm32g4_hcsr04.h"
 #include "stm32g4_utils.h"
 #include "stm32g4xx_hal.h"
-#include "stm32g4_timer.h"
+#include "stm32g4_timebase.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_extit.h"
 
+#if !USE_TIMEBASE
+	#error "Le module HCSR04 mesure la dure de l'cho avec stm32g4_timebase.c : activez USE_TIMEBASE"
+#endif
+
 #ifndef HCSR04_NB_SENSORS
 	#define HCSR04_NB_SENSORS	5
 #endif
-#ifndef HCSR04_TIMER
-	#define HCSR04_TIMER		TIMER1_ID
-#endif
 
 //En cas d'absence de mesure, certains HCSR04 prsentent un cho de l'ordre de 130ms.
 //Si La priode de mesure est infrieure, elle ne sera respecte que si le capteur  prsent un cho moins long.
@@ -31,8 +32,6 @@ static hcsr04_t sensors[HCSR04_NB_SENSORS];
 static void HCSR04_callback(uint16_t pin);
 static HAL_StatusTypeDef HCSR04_compute_distance(uint8_t id);
 static void HCSR04_trig(uint8_t id);
-static void HCSR04_RunTimerUs(void);
-static uint32_t HCSR04_ReadTimerUs(void);
 
 
 
@@ -143,14 +142,11 @@ HAL_StatusTypeDef BSP_HCSR04_add(uint8_t * id, GPIO_TypeDef * TRIG_GPIO, uint16_
 	return ret;
 }
 
-static bool timer_is_running = false;
-
 void BSP_HCSR04_run_measure(uint8_t id)
 {
 	if(sensors[id].state != HCSR04_STATE_INEXISTANT)
 	{
-		if(!timer_is_running)
-			HCSR04_RunTimerUs();
+		BSP_TIMEBASE_init();
 		HCSR04_trig(id);
 	}
 }
@@ -170,7 +166,7 @@ static void HCSR04_callback(uint16_t pin)
 			{
 				if(HAL_GPIO_ReadPin(sensors[i].echo_gpio, sensors[i].echo_pin) == 1)
 				{
-					sensors[i].trising = HCSR04_ReadTimerUs();
+					sensors[i].trising = BSP_TIMEBASE_get_us();
 					sensors[i].state = HCSR04_STATE_WAIT_ECHO_FALLING;
 				}
 			}
@@ -178,7 +174,7 @@ static void HCSR04_callback(uint16_t pin)
 			{
 				if(HAL_GPIO_ReadPin(sensors[i].echo_gpio, sensors[i].echo_pin) == 0)
 				{
-					sensors[i].tfalling = HCSR04_ReadTimerUs();
+					sensors[i].tfalling = BSP_TIMEBASE_get_us();
 					sensors[i].state = HCSR04_STATE_ECHO_RECEIVED;
 				}
 			}
@@ -193,33 +189,15 @@ static void HCSR04_trig(uint8_t id)
 {
 	if(sensors[id].state != HCSR04_STATE_INEXISTANT)
 	{
-		uint32_t tlocal;
 		sensors[id].state = HCSR04_STATE_TRIG;
 		HAL_GPIO_WritePin(sensors[id].trig_gpio, sensors[id].trig_pin, 1);	//trig on
-		tlocal = HCSR04_ReadTimerUs();
-		while(HCSR04_ReadTimerUs() - tlocal < 10);	//dlai d'au moins 10us
+		BSP_TIMEBASE_delay_us(10);	//dlai d'au moins 10us
 		HAL_GPIO_WritePin(sensors[id].trig_gpio, sensors[id].trig_pin, 0);	//trig off
 		sensors[id].state = HCSR04_STATE_WAIT_ECHO_RISING;
 		sensors[id].ttrig = HAL_GetTick();
 	}
 }
 
-#define HCSR04_PERIOD_TIMER		(40000)				//on compte jusqu' 40000 * 2.5us = 100ms (soit 34m)
-#define HCSR04_PRESCALER_TIMER	(64*10/4)			//on compte des [2.5us] Cette rsolution correspond  0.85mm
-
-static uint32_t HCSR04_ReadTimerUs(void)
-{
-	return BSP_TIMER_read(HCSR04_TIMER);
-}
-
-static void HCSR04_RunTimerUs(void)
-{
-	BSP_TIMER_run_us(HCSR04_TIMER, 10000, false);
-	BSP_TIMER_set_prescaler(HCSR04_TIMER, HCSR04_PRESCALER_TIMER);
-	BSP_TIMER_set_period(HCSR04_TIMER, HCSR04_PERIOD_TIMER);
-	timer_is_running = true;
-}
-
 void BSP_HCSR04_process_main(void)
 {
 	uint8_t i;
@@ -275,35 +253,8 @@ static HAL_StatusTypeDef HCSR04_compute_distance(uint8_t id)
 	if(sensors[id].state != HCSR04_STATE_ECHO_RECEIVED)
 		return HAL_ERROR;
 
-	if(sensors[id].tfalling < sensors[id].trising)
-		sensors[id].tfalling += HCSR04_PERIOD_TIMER;
-
-	if(sensors[id].tfalling < sensors[id].trising)
-		return HAL_ERROR;
-
-	distance = sensors[id].tfalling - sensors[id].trising;
-	distance *=  HCSR04_PRESCALER_TIMER;	//distance est exprim ici en pulses de timer purs
-
-	uint32_t freq;
-	if(HCSR04_TIMER == TIMER1_ID)
-	{
-		//Frquence du TIMER1 est PCLK2 lorsque APB2 Prescaler vaut 1, sinon : PCLK2*2
-		freq = HAL_RCC_GetPCLK2Freq();
-		if((RCC->CFGR & RCC_CFGR_PPRE2) >> 11 != RCC_HCLK_DIV1)
-			freq *= 2;
-	}
-	else
-	{
-		//Frquence des TIMERS 2,3,4 est PCLK1 lorsque APB1 Prescaler vaut 1, sinon : PCLK1*2
-		freq = HAL_RCC_GetPCLK1Freq();
-		if((RCC->CFGR & RCC_CFGR_PPRE1) >> 8 != RCC_HCLK_DIV1)
-			freq *= 2;
-	}
-	freq /= 1000000;	//frquence exprime en MHz
-	if(!freq)
-		return HAL_ERROR;
+	distance = sensors[id].tfalling - sensors[id].trising;	//[us] diffrence non signe : correcte mme si le compteur a fait un tour
 
-	distance /= freq;				//[us]
 	distance *= US_SPEED_IN_AIR;	//[um]
 	distance /= 1000;				//distance aller-retour [mm]
 	distance /= 2;					//distance aller simple [mm]
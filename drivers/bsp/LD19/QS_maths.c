@@ -520,8 +520,9 @@ int16_t array_4096(int16_t teta);
 
 //Renvoi le cosinus et le sinus de l'angle teta.
 //Procédure trés rapide.
+//Exécutée depuis la CCM SRAM ; la table (12,5 Ko) ne tient pas dans les 10 Ko de CCM SRAM et reste en flash.
 //@pre ATTENTION, aucune vérification n'est faite sur l'angle demandé.
-void COS_SIN_4096_get(int16_t teta,int16_t * cosinus, int16_t * sinus)
+__RAM_FUNC_CCM void COS_SIN_4096_get(int16_t teta,int16_t * cosinus, int16_t * sinus)
 {
 #if FAST_COS_SIN
 	if(teta < 0)
@@ -562,7 +563,7 @@ void COS_SIN_4096_get(int16_t teta,int16_t * cosinus, int16_t * sinus)
 
 const int16_t tab_4096[];
 
-int16_t array_4096(int16_t teta)
+__RAM_FUNC_CCM int16_t array_4096(int16_t teta)
 {
 	if (teta < 0 || teta > HALF_PI4096)
 		return 0;
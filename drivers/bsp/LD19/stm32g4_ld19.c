@@ -14,6 +14,10 @@
 #include "stm32g4_ld19.h"
 #include "stm32g4_ld19_display.h"
 #include "stm32g4_uart.h"
+#include "stm32g4_dlog.h"
+#include "stm32g4_telemetry.h"
+#include "stm32g4_prof.h"
+#include "stm32g4_ring.h"
 #include "stdio.h"
 
 #ifndef LD19_UART
@@ -25,6 +29,7 @@
 #define PI4096				12868
 #define PI					3.141592654f
 #define DISPLAY_ON_TFT		1
+#define LD19_FRAME_QUEUE_SIZE	4	//Trames reues en attente de traitement (puissance de 2)
 
 
 
@@ -48,18 +53,26 @@
 __attribute__((unused)) static uint8_t CalCRC8(uint8_t *p, uint8_t len);
 static running_t LD19_parse(char c, ld19_frame_handler_t * f);
 __attribute__((unused)) static void display_handler_infos(ld19_frame_handler_t * f);
+__attribute__((unused)) static void send_handler_telemetry(ld19_frame_handler_t * f);
 static void LD19_rx_callback(void);
 
-static ld19_frame_handler_t last_frame_handler;
-static volatile bool flag_new_handler_available = false;
+//Les trames sont analyses directement dans la file (pas de recopie), que l'IT de rception remplit et que process_main vide
+RING_DEFINE(ld19_frame_queue, ld19_frame_handler_t)
+static ld19_frame_handler_t frame_queue_storage[LD19_FRAME_QUEUE_SIZE];
+static ld19_frame_queue_t frame_queue;
+static ld19_frame_handler_t frame_overflow;		//Trame reue alors que la file est pleine : elle sera perdue (et compte)
+static volatile uint32_t lost_frames = 0;
 static volatile bool flag_error_receiving_handler = false;
-static volatile bool flag_we_scratched_the_last_handler = false;
 
 
 void LD19_init(void)
 {
+	ld19_frame_queue_init(&frame_queue, frame_queue_storage, LD19_FRAME_QUEUE_SIZE);
 	BSP_UART_init(LD19_UART, 230400);
 	BSP_UART_set_callback(LD19_UART, &LD19_rx_callback);
+	#if USE_TELEMETRY
+		BSP_TELEMETRY_init();
+	#endif
 }
 
 /*
@@ -68,19 +81,27 @@ void LD19_init(void)
  */
 void LD19_rx_callback(void)
 {
-	static ld19_frame_handler_t frame_handler;
+	static ld19_frame_handler_t * f = NULL;
 	char c;
 	while(BSP_UART_data_ready(LD19_UART))
 	{
 		c = BSP_UART_get_next_byte(LD19_UART);
-		switch(LD19_parse(c, &frame_handler))
+		if(f == NULL || (f == &frame_overflow && f->state == WAIT_HEADER))
+		{
+			//Between two frames: the next one is parsed in a free slot of the queue, if any
+			f = ld19_frame_queue_write_slot(&frame_queue);
+			if(f == NULL)
+				f = &frame_overflow;
+			f->state = WAIT_HEADER;
+		}
+		switch(LD19_parse(c, f))
 		{
 			case END_OK:
-				if(flag_new_handler_available == false){
-					//flag_we_scratched_the_last_handler = true;	//the process_main seems to be too slow to handle the last handler
-					last_frame_handler = frame_handler;	//we copy the received frame
-					flag_new_handler_available = true;
-				}
+				if(f == &frame_overflow)
+					lost_frames++;	//the process_main is too slow to handle the frames
+				else
+					ld19_frame_queue_publish(&frame_queue);
+				f = NULL;
 				break;
 			case END_ERROR:
 				flag_error_receiving_handler = true;
@@ -94,27 +115,36 @@ void LD19_rx_callback(void)
 
 void LD19_DEMO_process_main(void)
 {
-	if(flag_new_handler_available){
+	static uint32_t reported_lost_frames = 0;
+	ld19_frame_handler_t * f;
+
+	f = ld19_frame_queue_read_slot(&frame_queue);
+	if(f){
 		if(DISPLAY_ON_TFT)
-			BSP_LD19_display_on_tft(&last_frame_handler);
+			BSP_LD19_display_on_tft(f);
 		else
-			display_handler_infos(&last_frame_handler);
-		flag_new_handler_available = false;
+			display_handler_infos(f);
+		#if USE_TELEMETRY
+			send_handler_telemetry(f);
+		#endif
+		ld19_frame_queue_release(&frame_queue);
 	}
 
+	BSP_DLOG_process_main();
+
 	if(flag_error_receiving_handler){
 		flag_error_receiving_handler = false;
-		debug_printf("LD19 frame failure\n");
+		DLOG("LD19 frame failure\n");
 	}
 
-	if (flag_we_scratched_the_last_handler){
-		flag_we_scratched_the_last_handler = false;
-		debug_printf("");
+	if(lost_frames != reported_lost_frames){
+		reported_lost_frames = lost_frames;
+		DLOG("LD19 %lu frames lost\n", (unsigned long)reported_lost_frames);
 	}
 }
 
 
-static const uint8_t CrcTable[256] ={
+static const uint8_t CrcTable[256] __CCMRAM_CONST ={
 0x00, 0x4d, 0x9a, 0xd7, 0x79, 0x34, 0xe3,
 0xae, 0xf2, 0xbf, 0x68, 0x25, 0x8b, 0xc6, 0x11, 0x5c, 0xa9, 0xe4, 0x33,
 0x7e, 0xd0, 0x9d, 0x4a, 0x07, 0x5b, 0x16, 0xc1, 0x8c, 0x22, 0x6f, 0xb8,
@@ -148,7 +178,8 @@ static const uint8_t CrcTable[256] ={
  * 				type=1
  * 				nb bytes = 12
 */
-static running_t LD19_parse(char c, ld19_frame_handler_t * f){
+__RAM_FUNC_CCM static running_t LD19_parse(char c, ld19_frame_handler_t * f){
+	PROF_ZONE_BEGIN(LD19_PARSE);
 	running_t ret = IN_PROGRESS;
 
 	if(f->state != CRC_CHECK){
@@ -252,6 +283,7 @@ static running_t LD19_parse(char c, ld19_frame_handler_t * f){
 			f->state = WAIT_HEADER;
 			break;
 	}
+	PROF_ZONE_END(LD19_PARSE);
 	return ret;
 }
 
@@ -268,22 +300,43 @@ __attribute__((unused)) static void display_handler_infos(ld19_frame_handler_t *
 	if(!filter_this_frame)	//on peut remplacer ceci par if(1) si on veut voir toutes les trames
 	{
 
-		debug_printf("dt=%d [%.1f->%.1f] - ", delta_t, f->start_angle_rad, f->end_angle_rad);
+		//DLOG : seuls les entiers bruts sont recopis, le texte est reconstruit sur PC (cf. stm32g4_dlog.c)
+		DLOG("dt=%u [%u->%u] - ", delta_t, f->start_angle_rad, f->end_angle_rad);
 
 		for(uint8_t i = 0; i<POINT_PER_PACK; i++)
 		{
 			#if DISPLAY_WITH_DETAILS
-				debug_printf("%.1f:%d(%d) ", f->computed_angle_rad[i], f->point[i].distance, f->point[i].intensity);
+				DLOG("%u:%u(%u) ", f->computed_angle_rad[i], f->point[i].distance, f->point[i].intensity);
 			#else
 				//if(handler->computed_angle_rad[i] < 0.5 )
-				debug_printf("%d ", f->point[i].distance);
+				DLOG("%u ", f->point[i].distance);
 				//debug_printf("%d\n", handler->start_angle);
 			#endif
 		}
-		debug_printf("\n");
+		DLOG("\n");
 	}
 }
 
+//Envoie la trame sous forme binaire sur le canal de tlmtrie (dcode sur PC par tools/telemetry_decode.c)
+__attribute__((unused)) static void send_handler_telemetry(ld19_frame_handler_t * f)
+{
+	#if USE_TELEMETRY
+		telemetry_ld19_frame_t t;
+		t.timestamp = f->timestamp;
+		t.speed = f->speed;
+		t.start_angle = f->start_angle;
+		t.end_angle = f->end_angle;
+		for(uint8_t i = 0; i<POINT_PER_PACK; i++)
+		{
+			t.point[i].distance = f->point[i].distance;
+			t.point[i].intensity = f->point[i].intensity;
+		}
+		BSP_TELEMETRY_send(TELEMETRY_CHANNEL_LD19_FRAME, &t, sizeof(t));
+	#else
+		UNUSED(f);
+	#endif
+}
+
 //fonction indicative donne par le fournisseur. Ce calcul est repris au fil de la lecture des octets.
 __attribute__((unused)) static uint8_t CalCRC8(uint8_t *p, uint8_t len){
 	uint8_t crc = 0;
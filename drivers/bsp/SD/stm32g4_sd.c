@@ -116,6 +116,8 @@
 #include <stdio.h>
 #include "FatFs/src/drivers/sd_diskio.h"
 #include "stm32g4_spi.h"
+#include "stm32g4_prof.h"
+#include "stm32g4_trace.h"
 
 char SD_path[4];
 
@@ -153,8 +155,8 @@ typedef struct {
 /**
   * @brief  SD Control Lines management
   */
-#define SD_CS_LOW()			HAL_GPIO_WritePin(SD_CS_GPIO_PORT, SD_CS_PIN, GPIO_PIN_RESET)
-#define SD_CS_HIGH()		HAL_GPIO_WritePin(SD_CS_GPIO_PORT, SD_CS_PIN, GPIO_PIN_SET)
+#define SD_CS_LOW()			do { TRACE_RECORD(TRACE_SPI_BEGIN, TRACE_SPI_SD); HAL_GPIO_WritePin(SD_CS_GPIO_PORT, SD_CS_PIN, GPIO_PIN_RESET); } while(0)
+#define SD_CS_HIGH()		do { HAL_GPIO_WritePin(SD_CS_GPIO_PORT, SD_CS_PIN, GPIO_PIN_SET); TRACE_RECORD(TRACE_SPI_END, TRACE_SPI_SD); } while(0)
 
 /**
   * @brief  SD ansewer format
@@ -274,6 +276,7 @@ static uint8_t SD_GoIdleState(void);
 static SD_CmdAnswer_typedef SD_SendCmd(uint8_t Cmd, uint32_t Arg, uint8_t Crc, uint8_t Answer);
 static uint8_t SD_WaitData(uint8_t data);
 static uint8_t SD_ReadData(void);
+static uint8_t SD_ReadBlocks(uint32_t* pData, uint32_t ReadAddr, uint16_t BlockSize, uint32_t NumberOfBlocks);
 
 
 /* Private functions ---------------------------------------------------------*/
@@ -529,6 +532,18 @@ uint8_t BSP_SD_GetCardInfo(SD_CardInfo *pCardInfo)
   * @retval SD status
   */
 uint8_t BSP_SD_ReadBlocks(uint32_t* pData, uint32_t ReadAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
+{
+	uint8_t ret;
+	PROF_ZONE_BEGIN(SD_READ_BLOCKS);
+	ret = SD_ReadBlocks(pData, ReadAddr, BlockSize, NumberOfBlocks);
+	PROF_ZONE_END(SD_READ_BLOCKS);
+	return ret;
+}
+
+/**
+  * @brief  Lecture des blocs, cf. BSP_SD_ReadBlocks (plusieurs points de sortie : la mesure est faite par l'appelant)
+  */
+static uint8_t SD_ReadBlocks(uint32_t* pData, uint32_t ReadAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
 {
 	uint32_t offset = 0;
 	uint8_t retr = BSP_SD_ERROR;
@@ -554,6 +569,33 @@ uint8_t BSP_SD_ReadBlocks(uint32_t* pData, uint32_t ReadAddr, uint16_t BlockSize
 	}
 	memset(ptr, SD_DUMMY_BYTE, sizeof(uint8_t)*BlockSize);
 
+	/* Plusieurs blocs : une seule commande CMD18 (SD_CMD_READ_MULT_BLOCK), la carte envoie les blocs  la suite
+	   jusqu' la commande CMD12 (SD_CMD_STOP_TRANSMISSION), au lieu d'une commande CMD17 et de son temps d'accs par bloc */
+	if (NumberOfBlocks > 1)
+	{
+		response = SD_SendCmd(SD_CMD_READ_MULT_BLOCK, ReadAddr/(flag_SDHC == 1 ?BlockSize: 1), 0xFF, SD_ANSWER_R1_EXPECTED);
+		if ( response.r1 != SD_R1_NO_ERROR)
+		{
+			return ret_error(retr, ptr);
+		}
+		while (NumberOfBlocks--)
+		{
+			if (SD_WaitData(SD_TOKEN_START_DATA_MULTIPLE_BLOCK_READ) != BSP_SD_OK)
+			{
+				SD_SendCmd(SD_CMD_STOP_TRANSMISSION, 0, 0xFF, SD_ANSWER_R1B_EXPECTED);
+				return ret_error(retr, ptr);
+			}
+			SD_IO_WriteReadData(ptr, (uint8_t*)pData + offset, BlockSize);
+			offset += BlockSize;
+			/* get CRC bytes (not really needed by us, but required by SD) */
+			SD_IO_WriteByte(SD_DUMMY_BYTE);
+			SD_IO_WriteByte(SD_DUMMY_BYTE);
+		}
+		/* Fin de la lecture : la rponse R1 est suivie d'une attente tant que la carte est occupe */
+		SD_SendCmd(SD_CMD_STOP_TRANSMISSION, 0, 0xFF, SD_ANSWER_R1B_EXPECTED);
+		NumberOfBlocks = 0;		/* Tous les blocs sont lus : rien  faire pour la boucle bloc par bloc */
+	}
+
 	/* Data transfer */
 	while (NumberOfBlocks--)
 	{
@@ -24,6 +24,7 @@
 #include "stm32g4_utils.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_sys.h"
+#include "stm32g4_irqstat.h"
 
 #if !(defined WS2812_PORT_DATA) || !defined(WS2812_PIN_DATA)
 	#define WS2812_PORT_DATA	GPIOB
@@ -91,31 +92,34 @@ void BSP_WS2812_demo(void)
 void BSP_WS2812_display(uint32_t * pixels, uint8_t size)
 {
 	uint8_t i;
-	__disable_irq();
+	uint32_t primask;
+	IRQSTAT_IRQ_DISABLE(primask);
 	BSP_WS2812_reset();
 	for(i=0;i<size;i++)
 		WS2812_send_pixel(pixels[i]);
-	__enable_irq();
+	IRQSTAT_IRQ_RESTORE(primask);
 }
 
 void BSP_WS2812_display_only_one_pixel(uint32_t pixel, uint8_t rank, uint8_t size)
 {
 	uint8_t i;
-	__disable_irq();
+	uint32_t primask;
+	IRQSTAT_IRQ_DISABLE(primask);
 	BSP_WS2812_reset();
 	for(i=0;i<size;i++)
 		WS2812_send_pixel((i==rank)?pixel:WS2812_COLOR_BLACK);
-	__enable_irq();
+	IRQSTAT_IRQ_RESTORE(primask);
 }
 
 void BSP_WS2812_display_full(uint32_t pixel, uint8_t size)
 {
 	uint8_t i;
-	__disable_irq();
+	uint32_t primask;
+	IRQSTAT_IRQ_DISABLE(primask);
 	BSP_WS2812_reset();
 	for(i=0;i<size;i++)
 		WS2812_send_pixel(pixel);
-	__enable_irq();
+	IRQSTAT_IRQ_RESTORE(primask);
 }
 
 void BSP_WS2812_reset(void){
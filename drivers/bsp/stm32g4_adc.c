@@ -13,17 +13,27 @@
 #include "stm32g4_utils.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_timer.h"
-#include "stm32g4_systick.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_telemetry.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4_ring.h"
 #include <stdio.h>
 
 #define ADC_NB_OF_CHANNEL_USED	(USE_IN1 + USE_IN2 + USE_IN3 + USE_IN4 + USE_IN10 + USE_IN13 + USE_IN17)
+#define ADC_SAMPLE_QUEUE_SIZE	8	//Mesures en attente de lecture (puissance de 2) : 8ms à 1 mesure par ms
 
 
 static uint16_t adc_converted_value[ADC_NB_OF_CHANNEL_USED];//Ce tableau contient les valeurs mesurées par l'ADC pour chaque canal.
 static int8_t adc_id[ADC_CHANNEL_NB];						//Ce tableau contient les rang de chaque canal dans le tableau adc_converted_value. Usage privé à ce fichier.
 static ADC_HandleTypeDef	hadc;							//Handler pour l'ADC.
 static DMA_HandleTypeDef	hdma;							//Handler pour le DMA.
-static volatile uint16_t t = 0;								//Chrono utilisé dans la machine a état. décrémenté toutes les millisecondes.
+static swtimer_t demo_timer;								//Chrono utilisé dans la machine a état (timer logiciel, cf. stm32g4_swtimer.c)
+
+//Chaque fin de séquence de conversion ajoute une copie des mesures à cette file (IT DMA -> boucle principale)
+RING_DEFINE(adc_sample_queue, adc_sample_t)
+static adc_sample_t sample_queue_storage[ADC_SAMPLE_QUEUE_SIZE];
+static adc_sample_queue_t sample_queue;
+static volatile uint32_t lost_samples = 0;
 
 
 static const uint32_t ranks[16] = {
@@ -48,11 +58,6 @@ static const uint32_t ranks[16] = {
 
 
 
-void DEMO_adc_process_1ms(void)
-{
-	if(t)
-		t--;
-}
 void DEMO_adc_statemachine (void)
 {
 	typedef enum
@@ -66,27 +71,41 @@ void DEMO_adc_statemachine (void)
 	{
 		case INIT:
 			BSP_ADC_init();
-			BSP_systick_add_callback_function(DEMO_adc_process_1ms);
+			#if USE_TELEMETRY
+				BSP_TELEMETRY_init();
+			#endif
 			printf("Analog to Digital Converter\n");
 			state = DISPLAY;
 			break;
 		case DISPLAY:{
-			int16_t value;
-			int16_t millivolt;
+			static adc_sample_t sample;
 			uint8_t channel;
-			if(!t)
+			while(BSP_ADC_get_sample(&sample));		//On vide la file, en ne gardant que la mesure la plus récente
+			if(!BSP_SWTIMER_is_running(&demo_timer))
 			{
-				t = 400;
+				BSP_SWTIMER_start(&demo_timer, 400, 0);
+				#if USE_TELEMETRY
+					//Envoi binaire des valeurs brutes de tous les canaux utilisés (cf. tools/telemetry_decode.c)
+					uint16_t block[ADC_CHANNEL_NB];
+					uint16_t nb = 0;
+					for(channel = 0; channel < ADC_CHANNEL_NB; channel++)
+						if(adc_id[channel] != -1)
+							block[nb++] = sample.value[channel];
+					BSP_TELEMETRY_send(TELEMETRY_CHANNEL_ADC_BLOCK, block, (uint16_t)(nb * sizeof(uint16_t)));
+				#else
+				int16_t value;
+				int16_t millivolt;
 				for(channel = 0; channel < ADC_CHANNEL_NB; channel++)
 				{
 					if(adc_id[channel] != -1)
 					{
-						value = BSP_ADC_getValue(channel);
+						value = (int16_t)sample.value[channel];
 						millivolt = (int16_t)((((int32_t)value)*3300)/4096);		//On la convertie en volts
 						printf("Ch%d: %4d = %1d.%03dV | ",channel, value, millivolt/1000, millivolt%1000);
 					}
 				}
 				printf("\n");
+				#endif
 			}
 			break;}
 
@@ -252,13 +271,16 @@ void BSP_ADC_init(void)
 	//HAL_ADC_Start_IT(&hadc);
 
 	//Lancement de l'ADC, avec usage du DMA.
+	adc_sample_queue_init(&sample_queue, sample_queue_storage, ADC_SAMPLE_QUEUE_SIZE);
 	HAL_ADC_Start_DMA(&hadc,(uint32_t*)adc_converted_value,ADC_NB_OF_CHANNEL_USED);
 
 }
 
 void ADC1_2_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(ADC1_2);
 	HAL_ADC_IRQHandler(&hadc);
+	IRQSTAT_ISR_EXIT(ADC1_2);
 }
 /**
 * @brief  	Cette fonction permet de récupérer les valeurs mesurées par l'ADC.
@@ -283,22 +305,48 @@ static callback_fun_t callback_function;
 * @param  None
 * @retval None
 */
-static volatile bool flag_new_sample_available = false;
 
+/**
+ * @brief Indique si des mesures sont en attente de lecture par BSP_ADC_get_sample()
+ */
 bool BSP_ADC_is_new_sample_available(void)
 {
-	bool ret = flag_new_sample_available;
-	if(ret)
-		flag_new_sample_available = false;
-	return ret;
+	return !adc_sample_queue_is_empty(&sample_queue);
 }
 
+/**
+ * @brief Retire la plus ancienne mesure en attente (les mesures ne sont jamais écrasées : si la file est pleine,
+ * 		  les nouvelles sont perdues et comptées, cf. BSP_ADC_get_lost_samples())
+ * @return false si aucune mesure n'est en attente
+ */
+bool BSP_ADC_get_sample(adc_sample_t * sample)
+{
+	return adc_sample_queue_pop(&sample_queue, sample);
+}
 
+/**
+ * @brief Nombre de mesures perdues parce que la file était pleine
+ */
+uint32_t BSP_ADC_get_lost_samples(void)
+{
+	return lost_samples;
+}
 
 void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
 {
+	adc_sample_t * sample;
+	uint8_t channel;
+
 	UNUSED(hadc);
-	flag_new_sample_available = true;
+	sample = adc_sample_queue_write_slot(&sample_queue);
+	if(sample)
+	{
+		for(channel = 0; channel < ADC_CHANNEL_NB; channel++)
+			sample->value[channel] = (adc_id[channel] != -1) ? adc_converted_value[adc_id[channel]] : 0;
+		adc_sample_queue_publish(&sample_queue);
+	}
+	else
+		lost_samples++;
 	if(callback_function)
 		callback_function();
 }
@@ -323,8 +371,9 @@ void BSP_ADC_set_callback_function(callback_fun_t callback)
 
 
 void DMA1_Channel1_IRQHandler(void) {
-
+	IRQSTAT_ISR_ENTER(DMA1_CH1);
 	HAL_DMA_IRQHandler(&hdma);
+	IRQSTAT_ISR_EXIT(DMA1_CH1);
 
 	//See errata sheet
  //   hdma.DmaBaseAddress->IFCR = ((uint32_t)DMA_IFCR_CHTIF1 << (hdma.ChannelIndex & 0x1FU));
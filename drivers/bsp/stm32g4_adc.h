@@ -29,14 +29,23 @@
 		ADC_CHANNEL_NB
 	}adc_id_e;
 
+	/**
+	 * @brief Une mesure de tous les canaux, indexée par adc_id_e (0 pour les canaux non utilisés)
+	 */
+	typedef struct
+	{
+		uint16_t value[ADC_CHANNEL_NB];
+	}adc_sample_t;
+
 
 
 	void DEMO_adc_statemachine (void);
 	void BSP_ADC_init();
 	uint16_t BSP_ADC_getValue(adc_id_e channel);
 	bool BSP_ADC_is_new_sample_available(void);
+	bool BSP_ADC_get_sample(adc_sample_t * sample);
+	uint32_t BSP_ADC_get_lost_samples(void);
 	void BSP_ADC_set_callback_function(callback_fun_t callback);
-	void DEMO_adc_process_1ms(void);
 
 #endif //USE_ADC
 
@@ -0,0 +1,222 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_button.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Boutons poussoirs : fronts détectés par interruption externe, anti-rebond cadencé
+ * 			à la milliseconde, évènements datés (appui, relâchement, appui long, répétition) mis en file.
+ *******************************************************************************
+ */
+
+/*
+ * Lire l'état des broches à chaque passage dans la boucle principale rate les appuis brefs faits pendant
+ * un long rafraîchissement de l'écran, et les rebonds du contact produisent des appuis en trop.
+ * Ici rien n'est perdu ni compté deux fois :
+ *
+ * 		static const button_repeat_t acceleration = {400, 200, 40, 15};
+ * 		BSP_BUTTON_add(0, GPIOA, GPIO_PIN_0, &acceleration);	//Bouton entre PA0 et la masse (tirage interne)
+ * 		BSP_BUTTON_add(1, GPIOA, GPIO_PIN_1, NULL);			//Sans répétition
+ * 		...
+ * 		while(BSP_BUTTON_get_event(&event))						//Dans la boucle principale
+ * 			...
+ *
+ * 	- Chaque front (interruption externe, stm32g4_extit.c) relance le décompte d'anti-rebond du bouton.
+ * 	- Un timer logiciel d'une milliseconde (stm32g4_swtimer.c, appelé dans l'IT SysTick) décompte, lit la broche
+ * 	  une fois BUTTON_DEBOUNCE_MS écoulées sans front, produit les évènements et cadence les répétitions.
+ * 	  Il n'est armé que lorsqu'un bouton rebondit ou est maintenu : le reste du temps, le repos sans tick
+ * 	  (stm32g4_idle.c) n'est pas empêché, et c'est le front suivant qui réveille le processeur.
+ * 	- Les évènements passent de l'IT SysTick à la boucle principale par une file SPSC (stm32g4_ring.h).
+ *
+ * 	Les boutons relient la broche à la masse : entrée avec tirage vers le haut, actifs à l'état bas.
+ * 	Une ligne d'interruption externe par numéro de broche : PA0 et PB0, par exemple, ne peuvent pas être tous deux des boutons.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_button.h"
+
+#if USE_BUTTON
+#if !USE_BSP_EXTIT
+	#error "USE_BUTTON nécessite USE_BSP_EXTIT"
+#endif
+
+#include "stm32g4_extit.h"
+#include "stm32g4_gpio.h"
+#include "stm32g4_ring.h"
+#include "stm32g4_swtimer.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	GPIO_TypeDef * port;
+	uint16_t pin;
+	uint8_t pin_number;				//Ligne d'interruption externe
+	bool used;
+	bool pressed;					//État après anti-rebond
+	bool long_press_sent;
+	uint8_t debounce;				//[ms] restant avant lecture de la broche, 0 si aucun front récent
+	uint16_t repeat_count;
+	uint32_t press_date;			//[ms]
+	uint32_t next_repeat;			//[ms]
+	uint16_t period;				//[ms] intervalle avant la répétition suivante
+	button_repeat_t repeat;
+}button_t;
+
+RING_DEFINE(button_event_ring, button_event_t)
+
+/* Private variables ---------------------------------------------------------*/
+static button_t buttons[BUTTON_NB];
+static volatile uint16_t edges = 0;				//Lignes ayant vu un front depuis la dernière milliseconde (bit par ligne)
+static swtimer_t tick;
+static button_event_t event_slots[BUTTON_EVENT_QUEUE_SIZE];
+static button_event_ring_t events = RING_INITIALIZER(event_slots, BUTTON_EVENT_QUEUE_SIZE);
+static uint32_t lost_events = 0;
+
+/* Private functions definitions ---------------------------------------------*/
+
+static void BUTTON_post(uint8_t id, button_event_type_t type, uint32_t date_ms, uint16_t repeat)
+{
+	if(!button_event_ring_push(&events, &(button_event_t){date_ms, id, type, repeat}))
+		lost_events++;
+}
+
+/**
+ * @brief Anti-rebond, appuis longs et répétitions. Appelée toutes les millisecondes dans l'IT SysTick, tant qu'un bouton rebondit ou est maintenu.
+ */
+static void BUTTON_tick(void)
+{
+	uint32_t now = HAL_GetTick();
+	uint16_t new_edges = __atomic_exchange_n(&edges, 0, __ATOMIC_RELAXED);
+	bool active = false;
+	bool pressed;
+	button_t * b;
+	uint8_t id;
+
+	for(id = 0; id < BUTTON_NB; id++)
+	{
+		b = &buttons[id];
+		if(!b->used)
+			continue;
+		if(new_edges & (1U << b->pin_number))
+			b->debounce = BUTTON_DEBOUNCE_MS;
+		if(b->debounce && --b->debounce == 0)
+		{
+			pressed = (HAL_GPIO_ReadPin(b->port, b->pin) == GPIO_PIN_RESET);
+			if(pressed != b->pressed)
+			{
+				b->pressed = pressed;
+				BUTTON_post(id, pressed ? BUTTON_EVENT_PRESS : BUTTON_EVENT_RELEASE, now - BUTTON_DEBOUNCE_MS, 0);
+				if(pressed)
+				{
+					b->press_date = now - BUTTON_DEBOUNCE_MS;
+					b->long_press_sent = false;
+					b->repeat_count = 0;
+					b->period = b->repeat.period_ms;
+					b->next_repeat = b->press_date + b->repeat.delay_ms;
+				}
+			}
+		}
+		if(b->debounce)
+			active = true;
+		if(!b->pressed)
+			continue;
+
+		active = true;
+		if(!b->long_press_sent && now - b->press_date >= BUTTON_LONG_PRESS_MS)
+		{
+			b->long_press_sent = true;
+			BUTTON_post(id, BUTTON_EVENT_LONG_PRESS, now, 0);
+		}
+		if(b->repeat.delay_ms && (int32_t)(now - b->next_repeat) >= 0)
+		{
+			BUTTON_post(id, BUTTON_EVENT_REPEAT, now, ++b->repeat_count);
+			b->next_repeat += b->period;
+			b->period -= (uint32_t)b->period * b->repeat.accel_percent / 100;
+			if(b->period < b->repeat.min_period_ms)
+				b->period = b->repeat.min_period_ms;
+			if(b->period == 0)
+				b->period = 1;
+		}
+	}
+	if(!active)
+		BSP_SWTIMER_stop(&tick);		//Le prochain front relancera le timer
+}
+
+/**
+ * @brief Front sur une broche de bouton (IT EXTI) : relance l'anti-rebond
+ */
+static void BUTTON_edge(uint8_t pin_number)
+{
+	__atomic_fetch_or(&edges, (uint16_t)(1U << pin_number), __ATOMIC_RELAXED);
+	if(!BSP_SWTIMER_is_running(&tick))
+		BSP_SWTIMER_start(&tick, 1, 1);
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Configure la broche d'un bouton (entrée avec tirage vers le haut, IT sur les deux fronts) et l'ajoute au service
+ * @param id : identifiant du bouton dans les évènements (inférieur à BUTTON_NB)
+ * @param repeat : répétition pendant l'appui (NULL : aucune)
+ * @return false si l'identifiant ou la ligne d'interruption externe est déjà utilisé
+ */
+bool BSP_BUTTON_add(uint8_t id, GPIO_TypeDef * port, uint16_t pin, const button_repeat_t * repeat)
+{
+	uint8_t pin_number = BSP_EXTIT_gpiopin_to_pin_number(pin);
+	button_t * b;
+
+	if(id >= BUTTON_NB || buttons[id].used || pin_number >= 16)
+		return false;
+	for(uint8_t i = 0; i < BUTTON_NB; i++)
+		if(buttons[i].used && buttons[i].pin_number == pin_number)
+			return false;
+	if(tick.callback == NULL)
+		BSP_SWTIMER_init(&tick, &BUTTON_tick, SWTIMER_DISPATCH_IT);
+
+	b = &buttons[id];
+	*b = (button_t){.port = port, .pin = pin, .pin_number = pin_number};
+	if(repeat)
+		b->repeat = *repeat;
+	BSP_GPIO_pin_config(port, pin, GPIO_MODE_IT_RISING_FALLING, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW, GPIO_NO_AF);
+	b->used = true;
+	BSP_EXTIT_set_callback(&BUTTON_edge, pin_number, true);
+	if(HAL_GPIO_ReadPin(port, pin) == GPIO_PIN_RESET)
+		BUTTON_edge(pin_number);			//Déjà enfoncé : appui signalé après l'anti-rebond
+	return true;
+}
+
+/**
+ * @brief Évènement le plus ancien. À appeler depuis la boucle principale.
+ * @return false si aucun évènement n'est en attente
+ */
+bool BSP_BUTTON_get_event(button_event_t * event)
+{
+	return button_event_ring_pop(&events, event);
+}
+
+/**
+ * @brief Oublie les évènements en attente (changement d'écran : les appuis précédents ne le concernent pas)
+ */
+void BSP_BUTTON_flush(void)
+{
+	button_event_t event;
+
+	while(button_event_ring_pop(&events, &event));
+}
+
+/**
+ * @brief État du bouton après anti-rebond
+ */
+bool BSP_BUTTON_is_pressed(uint8_t id)
+{
+	return id < BUTTON_NB && buttons[id].pressed;
+}
+
+/**
+ * @brief Nombre d'évènements perdus parce que la file était pleine
+ */
+uint32_t BSP_BUTTON_get_lost_events(void)
+{
+	return lost_events;
+}
+
+#endif /* USE_BUTTON */
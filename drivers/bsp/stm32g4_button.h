@@ -0,0 +1,72 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_button.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Boutons poussoirs : fronts détectés par interruption externe, anti-rebond cadencé
+ * 			à la milliseconde, évènements datés (appui, relâchement, appui long, répétition) mis en file.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_BUTTON_H_
+#define BSP_STM32G4_BUTTON_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef BUTTON_NB
+	#define BUTTON_NB				8		//Boutons gérés au plus
+#endif
+#ifndef BUTTON_EVENT_QUEUE_SIZE
+	#define BUTTON_EVENT_QUEUE_SIZE	32		//Évènements en attente de lecture par BSP_BUTTON_get_event() (puissance de 2)
+#endif
+#define BUTTON_DEBOUNCE_MS			20		//Durée sans front au bout de laquelle l'état du bouton est pris en compte
+#define BUTTON_LONG_PRESS_MS		800		//Durée d'appui signalée par BUTTON_EVENT_LONG_PRESS
+
+/* Public types --------------------------------------------------------------*/
+typedef enum
+{
+	BUTTON_EVENT_PRESS = 0,			//Appui (daté du dernier front avant stabilisation)
+	BUTTON_EVENT_RELEASE,			//Relâchement
+	BUTTON_EVENT_LONG_PRESS,		//Bouton maintenu depuis BUTTON_LONG_PRESS_MS
+	BUTTON_EVENT_REPEAT				//Répétition pendant l'appui (cf. button_repeat_t)
+}button_event_type_t;
+
+typedef struct
+{
+	uint32_t date_ms;				//Référence HAL_GetTick()
+	uint8_t button;					//Identifiant donné à BSP_BUTTON_add()
+	uint8_t type;					//button_event_type_t
+	uint16_t repeat;				//BUTTON_EVENT_REPEAT : numéro de la répétition (1, 2...), 0 sinon
+}button_event_t;
+
+/**
+ * @brief Répétition pendant l'appui, avec accélération : la première répétition a lieu delay_ms après l'appui,
+ * 		  la suivante period_ms plus tard, puis chaque intervalle est raccourci de accel_percent %, jusqu'à min_period_ms.
+ */
+typedef struct
+{
+	uint16_t delay_ms;				//0 : pas de répétition
+	uint16_t period_ms;
+	uint16_t min_period_ms;
+	uint8_t accel_percent;			//0 : cadence constante
+}button_repeat_t;
+
+#if USE_BUTTON
+
+/* Public functions declarations ---------------------------------------------*/
+bool BSP_BUTTON_add(uint8_t id, GPIO_TypeDef * port, uint16_t pin, const button_repeat_t * repeat);
+
+bool BSP_BUTTON_get_event(button_event_t * event);
+
+void BSP_BUTTON_flush(void);
+
+bool BSP_BUTTON_is_pressed(uint8_t id);
+
+uint32_t BSP_BUTTON_get_lost_events(void);
+
+#endif /* USE_BUTTON */
+#endif /* BSP_STM32G4_BUTTON_H_ */
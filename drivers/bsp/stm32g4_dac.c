@@ -53,6 +53,7 @@
 #include "stm32g4_dac.h"
 #include "stm32g4_utils.h"
 #include "stm32g4_sys.h"
+#include "stm32g4_irqstat.h"
 #include <math.h>
 #include <stm32g4xx_hal_dac.h>
 
@@ -284,7 +285,9 @@ void BSP_DAC_demo_with_dma() {
 }
 
 void DMA1_Channel1_IRQHandler(void) {
+    IRQSTAT_ISR_ENTER(DMA1_CH1);
     HAL_DMA_IRQHandler(&hdma_dac1_ch1);
+    IRQSTAT_ISR_EXIT(DMA1_CH1);
 }
 
 void DMA1_Channel2_IRQHandler(void) {
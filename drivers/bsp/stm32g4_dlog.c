@@ -0,0 +1,134 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_dlog.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Journalisation binaire différée (DLOG) : les chaînes de format ne
+ * 			sont jamais formatées sur la cible.
+ *******************************************************************************
+ */
+
+/*
+ * Un printf coûte plusieurs milliers de cycles sur le Cortex-M4 (conversion décimale, gestion des formats...).
+ * Dans les chemins critiques, on remplace :
+ * 		debug_printf("dt=%d\n", delta_t);
+ * par :
+ * 		DLOG("dt=%d\n", delta_t);
+ *
+ * 	Seuls l'identifiant de la chaîne de format et les arguments bruts sont recopiés dans un buffer circulaire
+ * 	(quelques dizaines de cycles). BSP_DLOG_process_main(), appelée en tâche de fond, envoie ce buffer sur l'UART DLOG_UART.
+ * 	Sur PC, l'outil tools/dlog_decode.c relit les chaînes de format dans le fichier .elf et reconstitue le texte :
+ * 		dlog_decode firmware.elf capture.bin
+ *
+ * 	Format d'un enregistrement (mots de 32 bits, little-endian) :
+ * 		[en-tête : 0xA | nb_args | id][arg 0]...[arg nb_args-1]
+ *
+ * 	Si le buffer est plein, l'enregistrement est perdu et comptabilisé. Un enregistrement spécial (DLOG_ID_LOST) signale
+ * 	ensuite au décodeur le nombre de messages perdus.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_dlog.h"
+
+#if USE_DLOG
+#include "stm32g4_uart.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4xx_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#ifndef DLOG_UART
+	#define DLOG_UART			UART2_ID
+#endif
+
+//Taille du buffer en mots de 32 bits (puissance de 2)
+#ifndef DLOG_BUFFER_WORDS
+	#define DLOG_BUFFER_WORDS	256
+#endif
+#if (DLOG_BUFFER_WORDS & (DLOG_BUFFER_WORDS - 1)) != 0
+	#error "DLOG_BUFFER_WORDS doit être une puissance de 2"
+#endif
+#define DLOG_BUFFER_MASK		(DLOG_BUFFER_WORDS - 1)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t buffer[DLOG_BUFFER_WORDS];
+static volatile uint32_t write_index = 0;
+static volatile uint32_t read_index = 0;
+static volatile uint32_t lost = 0;
+static uint32_t lost_total = 0;
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Ajoute un enregistrement dans le buffer DLOG. Appelée par la macro DLOG(), utilisable en interruption.
+ *
+ * @param id	 identifiant de la chaîne de format (adresse dans la section .dlog_fmt)
+ * @param nargs	 nombre d'arguments (au plus DLOG_MAX_ARGS)
+ * @param args	 arguments déjà convertis en 32 bits
+ */
+void BSP_DLOG_push(uint32_t id, uint32_t nargs, const uint32_t * args)
+{
+	uint32_t primask;
+	uint32_t w;
+	uint32_t i;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	w = write_index;
+	if(DLOG_BUFFER_WORDS - (w - read_index) < nargs + 1)
+	{
+		lost++;		//Pas de place : on perd ce message, le décodeur en sera informé
+		IRQSTAT_IRQ_RESTORE(primask);
+		return;
+	}
+	buffer[w & DLOG_BUFFER_MASK] = DLOG_HEADER(id, nargs);
+	for(i = 0; i < nargs; i++)
+		buffer[(w + 1 + i) & DLOG_BUFFER_MASK] = args[i];
+	write_index = w + 1 + nargs;
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief Envoie sur DLOG_UART le contenu du buffer DLOG. À appeler en tâche de fond.
+ *
+ * @pre	L'UART DLOG_UART a été initialisé (BSP_UART_init)
+ */
+void BSP_DLOG_process_main(void)
+{
+	uint32_t r;
+	uint32_t w;
+	uint32_t n;
+	uint32_t lost_record[2];
+
+	r = read_index;
+	w = write_index;
+	while(r != w)
+	{
+		//On envoie la plus grande portion contiguë du buffer (jusqu'à la fin du tableau)
+		n = MIN(w - r, DLOG_BUFFER_WORDS - (r & DLOG_BUFFER_MASK));
+		BSP_UART_puts(DLOG_UART, (const uint8_t *)&buffer[r & DLOG_BUFFER_MASK], (uint16_t)(n * sizeof(uint32_t)));
+		r += n;
+		read_index = r;
+	}
+
+	//Les messages perdus l'ont été après ceux qui viennent d'être envoyés
+	if(lost)
+	{
+		uint32_t primask;
+		IRQSTAT_IRQ_DISABLE(primask);
+		lost_record[1] = lost;
+		lost = 0;
+		IRQSTAT_IRQ_RESTORE(primask);
+		lost_total += lost_record[1];
+		lost_record[0] = DLOG_HEADER(DLOG_ID_LOST, 1);
+		BSP_UART_puts(DLOG_UART, (const uint8_t *)lost_record, sizeof(lost_record));
+	}
+}
+
+/**
+ * @brief Renvoie le nombre total d'enregistrements perdus faute de place dans le buffer
+ */
+uint32_t BSP_DLOG_get_lost_count(void)
+{
+	return lost_total + lost;
+}
+
+#endif /* USE_DLOG */
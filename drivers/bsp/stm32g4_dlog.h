@@ -0,0 +1,81 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_dlog.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Journalisation binaire différée (DLOG) : les chaînes de format ne
+ * 			sont jamais formatées sur la cible.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_DLOG_H_
+#define BSP_STM32G4_DLOG_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define DLOG_MAX_ARGS		6
+
+/* Un enregistrement commence par un mot d'en-tête : 0xA | nb_args (4 bits) | id (24 bits) */
+#define DLOG_HEADER_MAGIC	0xA0000000u
+#define DLOG_HEADER(id, nargs)	(DLOG_HEADER_MAGIC | ((uint32_t)(nargs) << 24) | ((uint32_t)(id) & 0x00FFFFFFu))
+#define DLOG_ID_LOST		0x00FFFFFFu	//Enregistrement spécial : un argument = nombre d'enregistrements perdus
+
+#if USE_DLOG
+
+/* Comptage des arguments (0 à DLOG_MAX_ARGS) ---------------------------------*/
+#define DLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, N, ...)	N
+#define DLOG_NARGS(...)		DLOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+
+#define DLOG_ARGS_0()
+#define DLOG_ARGS_1(a)					(uint32_t)(a)
+#define DLOG_ARGS_2(a, b)				(uint32_t)(a), (uint32_t)(b)
+#define DLOG_ARGS_3(a, b, c)			(uint32_t)(a), (uint32_t)(b), (uint32_t)(c)
+#define DLOG_ARGS_4(a, b, c, d)			(uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d)
+#define DLOG_ARGS_5(a, b, c, d, e)		(uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d), (uint32_t)(e)
+#define DLOG_ARGS_6(a, b, c, d, e, f)	(uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d), (uint32_t)(e), (uint32_t)(f)
+#define DLOG_CAT_(a, b)		a##b
+#define DLOG_CAT(a, b)		DLOG_CAT_(a, b)
+
+/**
+ * @brief Journalise un message sans le formater.
+ *
+ * La chaîne de format est rangée dans la section .dlog_fmt, qui n'est jamais chargée en mémoire :
+ * son adresse dans cette section sert d'identifiant. Seuls l'identifiant et les arguments (convertis en 32 bits)
+ * sont recopiés dans le buffer. Le texte est reconstruit sur PC par tools/dlog_decode.c à partir du fichier .elf.
+ * @note Arguments entiers uniquement (%d, %u, %x, %c...). Les flottants doivent passer par DLOG_FLOAT(), les chaînes ne sont pas supportées.
+ */
+#define DLOG(fmt, ...)																						\
+	do {																									\
+		static const char DLOG_CAT(dlog_fmt_, __LINE__)[] __attribute__((section(".dlog_fmt"), used)) = fmt;	\
+		BSP_DLOG_push((uint32_t)(uintptr_t)DLOG_CAT(dlog_fmt_, __LINE__), DLOG_NARGS(__VA_ARGS__),						\
+				(const uint32_t[DLOG_NARGS(__VA_ARGS__) + 1]){DLOG_CAT(DLOG_ARGS_, DLOG_NARGS(__VA_ARGS__))(__VA_ARGS__)});	\
+	} while(0)
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_DLOG_push(uint32_t id, uint32_t nargs, const uint32_t * args);
+
+void BSP_DLOG_process_main(void);
+
+uint32_t BSP_DLOG_get_lost_count(void);
+
+/**
+ * @brief Transmet un float à DLOG sous forme de son motif binaire (à associer à %f côté format)
+ */
+static inline uint32_t DLOG_FLOAT(float f)
+{
+	union { float f; uint32_t u; } v = { .f = f };
+	return v.u;
+}
+
+#else	/* USE_DLOG */
+
+/* Sans le module DLOG, les messages sont formatés sur la cible comme auparavant */
+#define DLOG(fmt, ...)			debug_printf(fmt, ##__VA_ARGS__)
+#define DLOG_FLOAT(f)			((double)(f))
+#define BSP_DLOG_process_main()	(void)(0)
+
+#endif	/* USE_DLOG */
+#endif /* BSP_STM32G4_DLOG_H_ */
@@ -11,17 +11,29 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32g4_extit.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4_mpsc.h"
 
 #if USE_BSP_EXTIT
 /* Private defines -----------------------------------------------------------*/
 
 
 /* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t pin_number;
+	uint32_t date_ms;
+}extit_event_t;
 
+//Les fronts des broches à callback différée sont postés en IT (les lignes EXTI peuvent avoir des priorités différentes : file MPSC)
+MPSC_DEFINE(extit_event_queue, extit_event_t)
 
 /* Private variables ---------------------------------------------------------*/
 static callback_extit_t callbacks[16] = {0};
+static callback_extit_main_t main_callbacks[16] = {0};
 static uint16_t enables = 0;
+static extit_event_queue_slot_t event_slots[EXTIT_EVENT_QUEUE_SIZE];
+static extit_event_queue_t events = MPSC_INITIALIZER(event_slots, EXTIT_EVENT_QUEUE_SIZE);
 
 /* Private constants ---------------------------------------------------------*/
 
@@ -47,6 +59,8 @@ static void call_extit_user_callback(uint8_t pin_number)
 		{
 			if(callbacks[pin_number])
 				(*callbacks[pin_number])(pin_number);
+			if(main_callbacks[pin_number])
+				extit_event_queue_post(&events, &(extit_event_t){pin_number, HAL_GetTick()});	//Perte comptée si la file est pleine
 		}
 	}
 }
@@ -66,6 +80,46 @@ void BSP_EXTIT_set_callback(callback_extit_t fun, uint8_t pin_number, bool enabl
 		BSP_EXTIT_enable(pin_number);
 }
 
+/**
+ * @brief Déclare une fonction de callback DIFFÉRÉE associée à un numéro de broche
+ *
+ * Chaque interruption est datée et mise en file par la routine d'interruption ; la fonction est ensuite appelée
+ * depuis la boucle principale par BSP_EXTIT_process_main(), dans l'ordre des interruptions, sans contrainte de durée.
+ * @param fun		: fonction de callback (NULL pour supprimer)
+ * @param pin_number: numéro de broche associée au callback
+ * @param enable	: activer ou non les interruptions externes pour cette broche
+ */
+void BSP_EXTIT_set_main_callback(callback_extit_main_t fun, uint8_t pin_number, bool enable)
+{
+	main_callbacks[pin_number] = fun;
+	if(enable)
+		BSP_EXTIT_enable(pin_number);
+}
+
+/**
+ * @brief Appelle les callbacks différées des interruptions survenues depuis le dernier appel. À appeler dans la boucle principale.
+ */
+void BSP_EXTIT_process_main(void)
+{
+	extit_event_t event;
+	callback_extit_main_t fun;
+
+	while(extit_event_queue_pop(&events, &event))
+	{
+		fun = main_callbacks[event.pin_number];
+		if(fun)
+			fun(event.pin_number, event.date_ms);
+	}
+}
+
+/**
+ * @brief Nombre d'interruptions perdues (callbacks différées) parce que la file était pleine
+ */
+uint32_t BSP_EXTIT_get_lost_events(void)
+{
+	return extit_event_queue_get_lost(&events);
+}
+
 /**
  * @brief Cette fonction autorise les interruptions externes correspondant au numéro de broche demandé
  *
@@ -179,47 +233,61 @@ void BSP_EXTIT_ack_it(uint8_t pin_number)
  */
 void EXTI0_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI0);
 	call_extit_user_callback(0);
+	IRQSTAT_ISR_EXIT(EXTI0);
 }
 
 void EXTI1_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI1);
 	call_extit_user_callback(1);
+	IRQSTAT_ISR_EXIT(EXTI1);
 }
 
 void EXTI2_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI2);
 	call_extit_user_callback(2);
+	IRQSTAT_ISR_EXIT(EXTI2);
 }
 
 void EXTI3_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI3);
 	call_extit_user_callback(3);
+	IRQSTAT_ISR_EXIT(EXTI3);
 }
 
 void EXTI4_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI4);
 	call_extit_user_callback(4);
+	IRQSTAT_ISR_EXIT(EXTI4);
 }
 
 
 void EXTI9_5_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI9_5);
 	call_extit_user_callback(5);
 	call_extit_user_callback(6);
 	call_extit_user_callback(7);
 	call_extit_user_callback(8);
 	call_extit_user_callback(9);
+	IRQSTAT_ISR_EXIT(EXTI9_5);
 }
 
 void EXTI15_10_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(EXTI15_10);
 	call_extit_user_callback(10);
 	call_extit_user_callback(11);
 	call_extit_user_callback(12);
 	call_extit_user_callback(13);
 	call_extit_user_callback(14);
 	call_extit_user_callback(15);
+	IRQSTAT_ISR_EXIT(EXTI15_10);
 }
 
 #endif /* USE_BSP_EXTIT */
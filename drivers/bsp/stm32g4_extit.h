@@ -17,7 +17,9 @@
 #if USE_BSP_EXTIT
 
 /* Defines -------------------------------------------------------------------*/
-
+#ifndef EXTIT_EVENT_QUEUE_SIZE
+	#define EXTIT_EVENT_QUEUE_SIZE	16		//Fronts en attente de traitement par BSP_EXTIT_process_main() (puissance de 2)
+#endif
 
 /* Public types --------------------------------------------------------------*/
 /**
@@ -27,12 +29,26 @@
  */
 typedef void(*callback_extit_t)(uint8_t pin_number);
 
+/**
+ * @brief Type pointeur sur fonction de callback différée (appelée depuis la boucle principale)
+ *
+ * @param pin_number : numéro de la broche qui a généré l'interruption (entier compris entre 0 et 15)
+ * @param date_ms : date de l'interruption [ms]
+ */
+typedef void(*callback_extit_main_t)(uint8_t pin_number, uint32_t date_ms);
+
 /* Public constants ----------------------------------------------------------*/
 
 
 /* Public functions declarations ---------------------------------------------*/
 void BSP_EXTIT_set_callback(callback_extit_t fun, uint8_t pin_number, bool enable);
 
+void BSP_EXTIT_set_main_callback(callback_extit_main_t fun, uint8_t pin_number, bool enable);
+
+void BSP_EXTIT_process_main(void);
+
+uint32_t BSP_EXTIT_get_lost_events(void);
+
 void BSP_EXTIT_enable(uint8_t pin_number);
 
 void BSP_EXTIT_disable(uint8_t pin_number);
@@ -8,6 +8,7 @@
  *******************************************************************************
  */
 #include "stm32g4_flash.h"
+#include "stm32g4_kvstore.h"
 #include "stm32g4xx_hal.h"
 #include "stm32g4xx_hal_flash_ex.h"
 #include <stdio.h>
@@ -19,10 +20,15 @@
 #define SIZE_SECTOR_IN_DOUBLEWORDS		(SIZE_SECTOR_IN_BYTES/8)
 
 
+static volatile bool ecc_read_pending = false;		//Lecture de BSP_FLASH_read_ecc en cours
+static volatile bool ecc_error = false;				//Double erreur ECC acquitte par BSP_FLASH_NMI_ecc
+
+#if !USE_KVSTORE
 static void FLASH_write_doubleword(uint32_t index, uint64_t data);
 static void FLASH_keeping_everything_else(uint32_t index);
 static void FLASH_erase(void);
 extern void FLASH_PageErase(uint32_t PageAddress, uint32_t Banks);
+#endif
 
 
 /**
@@ -52,19 +58,27 @@ void FLASH_demo(void)
 /**
  * @brief	Enregistre une donne dans la case souhaite, sans toucher aux autres cases
  * @param  	index: Numro de la case (de 0  255).
- * @post  	ATTENTION : si la case est dj occupe par une donne diffrente de 0xFFFFFFFF (valeur par dfaut aprs effacement), une sauvegarde complte du secteur est faite, puis un effacement, puis une restitution !
+ * @post	Avec USE_KVSTORE : la donne est crite  la suite dans le stockage cl-valeur (cl KVSTORE_KEY_FLASH(index)),
+ * 			sans effacement ni sauvegarde de la page. La page 63 n'est plus crite : elle reste lue pour les cases jamais rcrites.
+ * @post  	Sans USE_KVSTORE : si la case est dj occupe par une donne diffrente de 0xFFFFFFFF (valeur par dfaut aprs effacement), une sauvegarde complte du secteur est faite, puis un effacement, puis une restitution !
  * @post  	le temps d'excution de cette fonction peut nettement varier !
  * @pre		//ATTENTION : ne pas appeler cette fonction trop frquemment. Risque d'endommager la flash en cas d'critures trop nombreuses. (>10000 sur le cycle de vie complet du produit)
  */
 void BSP_FLASH_set_doubleword(uint32_t index, uint64_t data)
 {
-	uint64_t current_doubleword;
 	assert(index < SIZE_SECTOR_IN_DOUBLEWORDS);
+#if USE_KVSTORE
+	BSP_KVSTORE_set_u64(KVSTORE_KEY_FLASH(index), data);
+#else
+	uint64_t current_doubleword;
 	current_doubleword = BSP_FLASH_read_doubleword(index);
+	HAL_FLASH_Unlock();		//Une seule fois pour l'effacement, la restitution et l'criture
 	if((current_doubleword & data) != data)	//il n'est pas possible d'crire le mot sans tre pollu par des zros qui seraient dj crit ici
 		FLASH_keeping_everything_else(index);
 
 	FLASH_write_doubleword(index, data);
+	HAL_FLASH_Lock();
+#endif
 }
 
 
@@ -76,6 +90,11 @@ uint64_t BSP_FLASH_read_doubleword(uint32_t index)
 {
 	assert(index < SIZE_SECTOR_IN_DOUBLEWORDS);
 
+#if USE_KVSTORE
+	uint64_t data;
+	if(BSP_KVSTORE_get_u64(KVSTORE_KEY_FLASH(index), &data))
+		return data;
+#endif
 	uint64_t * p;
 	p = (uint64_t *)(BASE_ADDRESS + 8*index);
 
@@ -83,6 +102,39 @@ uint64_t BSP_FLASH_read_doubleword(uint32_t index)
 }
 
 
+/**
+ * @brief	Lit un double mot en flash sans bloquer sur une double erreur ECC.
+ * @details	Un double mot dont la programmation a t interrompue (coupure d'alimentation) a un ECC faux :
+ * 			sa lecture lve une double erreur ECC, donc une NMI. BSP_FLASH_NMI_ecc, appele par NMI_Handler,
+ * 			l'acquitte et la signale ici au lieu de bloquer.
+ * @param	address: adresse du double mot (aligne sur 8 octets)
+ * @return	false si la lecture a lev une double erreur ECC : value n'a alors pas de sens
+ */
+bool BSP_FLASH_read_ecc(uint32_t address, uint64_t * value)
+{
+	ecc_error = false;
+	ecc_read_pending = true;
+	*value = *(const volatile uint64_t *)address;
+	__DSB();		//La lecture est termine, et la NMI qu'elle a pu lever est prise avant la suite
+	__ISB();
+	ecc_read_pending = false;
+	return !ecc_error;
+}
+
+/**
+ * @brief	 appeler par NMI_Handler : acquitte une double erreur ECC leve pendant BSP_FLASH_read_ecc
+ * @return	true si la NMI venait de l (NMI_Handler peut alors revenir), false sinon
+ */
+bool BSP_FLASH_NMI_ecc(void)
+{
+	if(!ecc_read_pending || !__HAL_FLASH_GET_FLAG(FLASH_FLAG_ECCD))
+		return false;
+	__HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+	ecc_error = true;
+	return true;
+}
+
+
 /**
  * @brief Cette fonction affiche les SIZE_SECTOR donnes (32 bits) disponibles dans le dernier secteur de la FLASH
  */
@@ -100,6 +152,7 @@ void BSP_FLASH_dump(void){
 }
 
 
+#if !USE_KVSTORE
 static void FLASH_keeping_everything_else(uint32_t index)
 {
 	uint64_t saved_values[SIZE_SECTOR_IN_DOUBLEWORDS];
@@ -115,23 +168,26 @@ static void FLASH_keeping_everything_else(uint32_t index)
 	}
 }
 
+/**
+ * @pre	La flash est dverrouille (HAL_FLASH_Unlock)
+ */
 static void FLASH_erase(void)
 {
-	HAL_FLASH_Unlock();
 	FLASH_PageErase(PAGE_USED_FOR_THIS_MODULE, FLASH_BANK_1);
 	 /* Wait for last operation to be completed */
 	FLASH_WaitForLastOperation((uint32_t)FLASH_TIMEOUT_VALUE);
 
 	/* If the erase operation is completed, disable the PER Bit */
 	CLEAR_BIT(FLASH->CR, FLASH_CR_PER);
-	HAL_FLASH_Lock();
 }
 
 
+/**
+ * @pre	La flash est dverrouille (HAL_FLASH_Unlock)
+ */
 static void FLASH_write_doubleword(uint32_t index, uint64_t data)
 {
 	assert(index < SIZE_SECTOR_IN_DOUBLEWORDS);
-	HAL_FLASH_Unlock();
 	HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, BASE_ADDRESS+8*index, (uint64_t)(data));
-	HAL_FLASH_Lock();
 }
+#endif /* !USE_KVSTORE */
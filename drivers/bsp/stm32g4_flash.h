@@ -12,6 +12,8 @@
 #include "stm32g4_sys.h"
 
 uint64_t BSP_FLASH_read_doubleword(uint32_t index);
+bool BSP_FLASH_read_ecc(uint32_t address, uint64_t * value);
+bool BSP_FLASH_NMI_ecc(void);
 void BSP_FLASH_set_doubleword(uint32_t index, uint64_t data);
 void BSP_FLASH_dump(void);
 void FLASH_demo(void);
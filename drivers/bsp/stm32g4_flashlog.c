@@ -0,0 +1,274 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_flashlog.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Journal d'enregistrements de 64 bits en flash, protégés par CRC, écrits à la suite
+ * 			sur plusieurs pages utilisées à tour de rôle.
+ *******************************************************************************
+ */
+
+/*
+ * BSP_FLASH_set_doubleword (stm32g4_flash.c) efface et réécrit toute sa page dès qu'un bit doit repasser à 1 :
+ * une sauvegarde de 2 ko sur la pile, plus de 20 ms de blocage, et un effacement par modification.
+ * Ici, on n'écrit jamais deux fois au même endroit : chaque modification est un nouvel enregistrement
+ * écrit à la suite des précédents, et la page n'est effacée que lorsqu'elle est pleine.
+ *
+ * 		static void rejouer(uint64_t e)								{ ...mise à jour de l'état en RAM... }
+ * 		static uint16_t instantane(uint64_t * e, uint16_t max)		{ ...l'état en RAM, en enregistrements... }
+ * 		BSP_FLASHLOG_init(&rejouer, &instantane);					//Au démarrage : l'état est reconstruit
+ * 		BSP_FLASHLOG_append(e);										//Chaque modification
+ *
+ * 	- Un emplacement de 64 bits : 48 bits de données, puis le CRC16 (CCITT-FALSE) de ces données.
+ * 	  Un emplacement effacé (tous les bits à 1) ou dont le CRC est faux (écriture interrompue) est ignoré.
+ * 	  Sur la cible, lire un double mot dont la programmation a été interrompue lève en général une double erreur ECC (NMI) :
+ * 	  les lectures passent par BSP_FLASH_read_ecc, qui la signale au lieu de bloquer, et l'emplacement est ignoré de même.
+ * 	- Chaque page commence par un en-tête (signature et numéro de séquence) ; la page courante est celle dont
+ * 	  le numéro est le plus grand. Au démarrage, seule cette page est parcourue, une fois.
+ * 	- Quand la page courante est pleine, la suivante est effacée, l'instantané de l'état (fourni par l'appelant)
+ * 	  y est écrit, puis son en-tête en dernier : tant que l'en-tête n'est pas écrit, l'ancienne page reste la page courante
+ * 	  et contient tout l'état. Une coupure d'alimentation à n'importe quel moment ne perd donc au plus que l'enregistrement
+ * 	  en cours d'écriture. Les pages sont utilisées à tour de rôle : leur usure est répartie.
+ * 	- Les pages sont réservées dans le script de l'éditeur de liens (région FLASHLOG).
+ * 	- Pendant une programmation (environ 0,1 ms) ou un effacement (environ 22 ms), l'exécution depuis la flash est suspendue.
+ * 	- Banc d'essai sur PC, avec une flash simulée et des coupures d'alimentation : tools/flashlog_bench.c.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_flashlog.h"
+
+#if USE_FLASHLOG
+#if FLASHLOG_PAGES_NB < 2
+	#error "FLASHLOG_PAGES_NB doit valoir au moins 2"
+#endif
+
+#include "stm32g4xx_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#ifndef FLASHLOG_READ
+	#include "stm32g4_flash.h"
+	#define FLASHLOG_READ(address, value)	BSP_FLASH_read_ecc(address, value)	//Redéfinie par les outils PC (flash simulée)
+#endif
+#define SLOTS_NB			(FLASH_PAGE_SIZE / 8)
+#define ERASED				UINT64_MAX
+#define HEADER_MAGIC		0x464CULL		//"FL"
+
+/* Private variables ---------------------------------------------------------*/
+static flashlog_snapshot_t snapshot_fun = NULL;
+static uint8_t current = 0;				//Page courante, de 0 à FLASHLOG_PAGES_NB - 1
+static flashlog_stats_t stats = {.capacity = SLOTS_NB};
+
+/* Private functions definitions ---------------------------------------------*/
+
+static uint32_t FLASHLOG_address(uint8_t page, uint16_t slot)
+{
+	return FLASH_BASE + (FLASHLOG_FIRST_PAGE + page) * FLASH_PAGE_SIZE + 8U * slot;
+}
+
+/**
+ * @brief CRC16 CCITT-FALSE (polynôme 0x1021, valeur initiale 0xFFFF) des 48 bits de données, poids fort en premier
+ */
+static uint16_t FLASHLOG_crc16(uint64_t payload)
+{
+	uint16_t crc = 0xFFFF;
+
+	for(int8_t byte = 5; byte >= 0; byte--)
+	{
+		crc ^= (uint16_t)(((payload >> (8 * byte)) & 0xFF) << 8);
+		for(uint8_t bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+	}
+	return crc;
+}
+
+static uint64_t FLASHLOG_encode(uint64_t payload)
+{
+	return (payload << 16) | FLASHLOG_crc16(payload);
+}
+
+/**
+ * @return false si l'emplacement est effacé ou si son CRC est faux
+ */
+static bool FLASHLOG_decode(uint64_t slot, uint64_t * payload)
+{
+	if(slot == ERASED)
+		return false;
+	*payload = slot >> 16;
+	return FLASHLOG_crc16(*payload) == (uint16_t)slot;
+}
+
+/**
+ * @return true si la page porte un en-tête valide, dont le numéro de séquence est écrit dans sequence
+ */
+static bool FLASHLOG_read_header(uint8_t page, uint32_t * sequence)
+{
+	uint64_t slot, payload;
+
+	if(!FLASHLOG_READ(FLASHLOG_address(page, 0), &slot) || !FLASHLOG_decode(slot, &payload) || (payload >> 32) != HEADER_MAGIC)
+		return false;
+	*sequence = (uint32_t)payload;
+	return true;
+}
+
+/**
+ * @pre La flash est déverrouillée
+ */
+static bool FLASHLOG_program(uint8_t page, uint16_t slot, uint64_t value)
+{
+	uint32_t address = FLASHLOG_address(page, slot);
+	uint64_t written;
+
+	if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, address, value) != HAL_OK
+			|| !FLASHLOG_READ(address, &written) || written != value)
+	{
+		stats.errors++;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @pre La flash est déverrouillée
+ */
+static bool FLASHLOG_erase(uint8_t page)
+{
+	FLASH_EraseInitTypeDef erase = {.TypeErase = FLASH_TYPEERASE_PAGES, .Banks = FLASH_BANK_1,
+			.Page = FLASHLOG_FIRST_PAGE + page, .NbPages = 1};
+	uint32_t page_error;
+	uint64_t value;
+
+	if(HAL_FLASHEx_Erase(&erase, &page_error) == HAL_OK)
+	{
+		for(uint16_t slot = 0; slot < SLOTS_NB; slot++)
+			if(!FLASHLOG_READ(FLASHLOG_address(page, slot), &value) || value != ERASED)
+				break;
+			else if(slot == SLOTS_NB - 1)
+				return true;
+	}
+	stats.errors++;
+	return false;
+}
+
+/**
+ * @brief Ouvre la page suivante : effacement, instantané de l'état, puis en-tête
+ * @return false si la page n'a pas pu être écrite : la page courante ne change pas
+ */
+static bool FLASHLOG_next_page(void)
+{
+	uint64_t records[FLASHLOG_SNAPSHOT_MAX];
+	uint8_t next = (uint8_t)((current + 1) % FLASHLOG_PAGES_NB);
+	uint16_t nb = snapshot_fun ? snapshot_fun(records, FLASHLOG_SNAPSHOT_MAX) : 0;
+	bool ok;
+
+	if(nb > FLASHLOG_SNAPSHOT_MAX)
+		nb = FLASHLOG_SNAPSHOT_MAX;
+	HAL_FLASH_Unlock();
+	ok = FLASHLOG_erase(next);
+	for(uint16_t i = 0; ok && i < nb; i++)
+		ok = FLASHLOG_program(next, (uint16_t)(1 + i), FLASHLOG_encode(records[i] & FLASHLOG_PAYLOAD_MAX));
+	if(ok)
+		ok = FLASHLOG_program(next, 0, FLASHLOG_encode(HEADER_MAGIC << 32 | (uint32_t)(stats.sequence + 1)));	//En dernier
+	HAL_FLASH_Lock();
+	if(!ok)
+		return false;
+
+	current = next;
+	stats.sequence++;
+	stats.used = (uint16_t)(1 + nb);
+	stats.compactions++;
+	return true;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Retrouve la page courante et rejoue ses enregistrements, dans l'ordre d'écriture. À appeler une fois au démarrage.
+ * 		  Si aucune page n'est valide (première mise en service), les pages sont effacées.
+ * @param replay : appelée pour chaque enregistrement valide (instantané puis ajouts), peut être NULL
+ * @param snapshot : appelée à chaque changement de page, peut être NULL si l'état n'a pas à survivre au changement de page
+ */
+void BSP_FLASHLOG_init(flashlog_replay_t replay, flashlog_snapshot_t snapshot)
+{
+	uint32_t sequence = 0;
+	bool found = false, readable;
+	uint64_t payload, slot;
+	uint16_t i;
+
+	snapshot_fun = snapshot;
+	for(uint8_t page = 0; page < FLASHLOG_PAGES_NB; page++)
+	{
+		if(FLASHLOG_read_header(page, &sequence) && (!found || (int32_t)(sequence - stats.sequence) > 0))
+		{
+			found = true;
+			current = page;
+			stats.sequence = sequence;
+		}
+	}
+	if(!found)
+	{
+		BSP_FLASHLOG_format();
+		return;
+	}
+
+	stats.used = 1;
+	for(i = 1; i < SLOTS_NB; i++)
+	{
+		readable = FLASHLOG_READ(FLASHLOG_address(current, i), &slot);
+		if(readable && slot == ERASED)
+			continue;
+		stats.used = (uint16_t)(i + 1);		//Le prochain enregistrement ira après le dernier emplacement écrit
+		if(!readable || !FLASHLOG_decode(slot, &payload))		//Double erreur ECC ou CRC faux : écriture interrompue
+			stats.corrupted++;
+		else if(replay)
+			replay(payload);
+	}
+}
+
+/**
+ * @brief Ajoute un enregistrement à la suite du journal. Change de page si la page courante est pleine.
+ * @param payload : FLASHLOG_PAYLOAD_BITS bits au plus
+ * @return false si l'enregistrement n'a pas pu être écrit
+ */
+bool BSP_FLASHLOG_append(uint64_t payload)
+{
+	bool ok = false;
+
+	if(payload > FLASHLOG_PAYLOAD_MAX)
+		return false;
+	for(uint8_t attempt = 0; attempt < 2 && !ok; attempt++)		//Un emplacement mal programmé est abandonné
+	{
+		if(stats.used >= SLOTS_NB && !FLASHLOG_next_page())
+			return false;
+		HAL_FLASH_Unlock();
+		ok = FLASHLOG_program(current, stats.used++, FLASHLOG_encode(payload));
+		HAL_FLASH_Lock();
+	}
+	if(ok)
+		stats.appends++;
+	return ok;
+}
+
+/**
+ * @brief Efface toutes les pages du journal, et repart d'une page vide
+ */
+void BSP_FLASHLOG_format(void)
+{
+	bool ok = true;
+
+	HAL_FLASH_Unlock();
+	for(uint8_t page = 0; page < FLASHLOG_PAGES_NB; page++)
+		ok = FLASHLOG_erase(page) && ok;
+	if(ok)
+		FLASHLOG_program(0, 0, FLASHLOG_encode(HEADER_MAGIC << 32));
+	HAL_FLASH_Lock();
+	current = 0;
+	stats.sequence = 0;
+	stats.used = 1;
+}
+
+void BSP_FLASHLOG_get_stats(flashlog_stats_t * s)
+{
+	*s = stats;
+}
+
+#endif /* USE_FLASHLOG */
@@ -0,0 +1,67 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_flashlog.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Journal d'enregistrements de 64 bits en flash, protégés par CRC, écrits à la suite
+ * 			sur plusieurs pages utilisées à tour de rôle.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_FLASHLOG_H_
+#define BSP_STM32G4_FLASHLOG_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef FLASHLOG_FIRST_PAGE
+	#define FLASHLOG_FIRST_PAGE		61		//Pages réservées par le script de l'éditeur de liens (région FLASHLOG)
+#endif
+#ifndef FLASHLOG_PAGES_NB
+	#define FLASHLOG_PAGES_NB		2		//Au moins 2 : l'ancienne page n'est effacée qu'une fois la nouvelle complète
+#endif
+#ifndef FLASHLOG_SNAPSHOT_MAX
+	#define FLASHLOG_SNAPSHOT_MAX	32		//Enregistrements au plus dans un instantané (cf. flashlog_snapshot_t)
+#endif
+#define FLASHLOG_PAYLOAD_BITS		48		//Données utiles d'un enregistrement, le reste est le CRC16
+#define FLASHLOG_PAYLOAD_MAX		((1ULL << FLASHLOG_PAYLOAD_BITS) - 1)
+
+/* Public types --------------------------------------------------------------*/
+/**
+ * @brief Appelée pour chaque enregistrement valide, dans l'ordre d'écriture, au démarrage
+ */
+typedef void (*flashlog_replay_t)(uint64_t payload);
+
+/**
+ * @brief Produit l'état courant sous forme d'enregistrements (instantané), écrits en tête de la page suivante
+ * 		  quand la page courante est pleine. Rejoués dans l'ordre, ils doivent redonner le même état.
+ * @return nombre d'enregistrements écrits dans records (FLASHLOG_SNAPSHOT_MAX au plus)
+ */
+typedef uint16_t (*flashlog_snapshot_t)(uint64_t * records, uint16_t max);
+
+typedef struct
+{
+	uint32_t sequence;				//Numéro de la page courante (nombre de changements de page depuis la première mise en service)
+	uint16_t used;					//Emplacements occupés dans la page courante (en-tête compris)
+	uint16_t capacity;				//Emplacements d'une page
+	uint32_t appends;				//Enregistrements écrits depuis le démarrage
+	uint32_t compactions;			//Changements de page depuis le démarrage
+	uint32_t corrupted;				//Enregistrements ignorés au démarrage (CRC faux : écriture interrompue)
+	uint32_t errors;				//Échecs de programmation ou d'effacement
+}flashlog_stats_t;
+
+#if USE_FLASHLOG
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_FLASHLOG_init(flashlog_replay_t replay, flashlog_snapshot_t snapshot);
+
+bool BSP_FLASHLOG_append(uint64_t payload);
+
+void BSP_FLASHLOG_get_stats(flashlog_stats_t * stats);
+
+void BSP_FLASHLOG_format(void);
+
+#endif /* USE_FLASHLOG */
+#endif /* BSP_STM32G4_FLASHLOG_H_ */
@@ -0,0 +1,289 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_idle.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Repos sans tick : quand l'ordonnanceur n'a rien à faire, SysTick est suspendu et le processeur
+ * 			dort (Sleep ou Stop 1) jusqu'à la prochaine échéance, réveillé par LPTIM1 ou par n'importe quelle IT.
+ *******************************************************************************
+ */
+
+/*
+ * Sans ce module, la boucle de l'ordonnanceur fait un WFI qui est réveillé à chaque milliseconde par SysTick.
+ * BSP_SCHEDULER_run_once() appelle ici BSP_IDLE_sleep() avec le délai avant la prochaine échéance
+ * (tâches et timers logiciels) :
+ * 		- SysTick est arrêté, LPTIM1 (horloge LSI, qui fonctionne aussi en mode Stop) est programmé pour réveiller
+ * 		  le processeur juste avant l'échéance,
+ * 		- au réveil (LPTIM1, ou toute autre IT : EXTI d'un bouton, réception UART...), le temps passé est lu dans
+ * 		  le compteur de LPTIM1 : HAL_GetTick() est avancé d'autant, et SysTick est relancé en conservant
+ * 		  la phase de la milliseconde en cours (HAL_GetTick() ne dérive pas d'un repos à l'autre).
+ *
+ * 	Le compteur de LPTIM1 tourne librement sur 16 bits (un tour en ~2 s) : il sert aussi à mesurer le temps de repos,
+ * 	y compris pour les WFI courts, d'où le pourcentage de repos de BSP_IDLE_get_idle_percent().
+ *
+ * 	LSI n'est précise qu'à quelques % près : sa fréquence est mesurée contre SysTick par BSP_IDLE_init().
+ *
+ * 	Le repos sans tick est évité (simple WFI, SysTick continue de battre) :
+ * 		- si l'échéance est à moins de IDLE_MIN_TICKLESS_MS,
+ * 		- si des fonctions sont appelées à chaque milliseconde par SysTick (BSP_systick_add_callback_function).
+ *
+ * 	IDLE_STOP_MODE : le mode Stop 1 arrête toutes les horloges rapides. La consommation est bien plus faible, mais
+ * 	pendant le repos les UART ne reçoivent plus, les DMA et TIM2 (stm32g4_timebase.c) sont figés ;
+ * 	les horloges sont reconfigurées au réveil (SystemClock_Config(), ~100 us). À réserver aux applications
+ * 	qui n'attendent que des IT externes.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_idle.h"
+
+#if USE_IDLE
+#include "stm32g4_swtimer.h"
+#include "stm32g4_systick.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4_sys.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define IDLE_LPTIM_MAX				0xFFFF	//Le compteur de LPTIM1 tourne librement sur 16 bits
+#define IDLE_CALIBRATION_MS			50		//Mesure de LSI : ~1600 périodes, soit 0,06 %
+#define IDLE_SYSTICK_MIN_CYCLES		64		//Durée minimale de la première période de SysTick au réveil
+
+/* Private variables ---------------------------------------------------------*/
+static bool initialized = false;
+static uint32_t lsi_hz = 32000;
+static bool compare_pending = false;		//Écriture de LPTIM1->CMP pas encore prise en compte par LPTIM1
+static uint16_t window_last;				//Valeur du compteur de LPTIM1 lors de la dernière mise à jour de la fenêtre
+static uint32_t window_total = 0;			//[périodes de LSI] durée de la fenêtre en cours
+static uint32_t window_idle = 0;			//[périodes de LSI] temps de repos dans la fenêtre en cours
+static idle_stats_t stats;
+
+/* Private functions definitions ---------------------------------------------*/
+
+/**
+ * @brief Lit le compteur de LPTIM1
+ * @note LPTIM1 est cadencé par LSI, asynchrone du bus : la lecture n'est fiable que si deux lectures successives concordent
+ */
+static uint16_t IDLE_lptim_read(void)
+{
+	uint32_t previous;
+	uint32_t current = LPTIM1->CNT;
+
+	do
+	{
+		previous = current;
+		current = LPTIM1->CNT;
+	}while(current != previous);
+	return (uint16_t)current;
+}
+
+/**
+ * @brief Programme la date de réveil (comparaison du compteur de LPTIM1)
+ */
+static void IDLE_lptim_set_compare(uint16_t compare)
+{
+	if(compare_pending)
+		while(!(LPTIM1->ISR & LPTIM_ISR_CMPOK));	//L'écriture précédente doit être terminée (quelques périodes de LSI)
+	LPTIM1->ICR = LPTIM_ICR_CMPOKCF;
+	LPTIM1->CMP = compare;
+	compare_pending = true;
+}
+
+/**
+ * @brief Met à jour la fenêtre de calcul du pourcentage de repos
+ * @param now	: compteur de LPTIM1
+ * @param idle	: [périodes de LSI] repos terminé à la date now
+ * @pre IT masquées, ou appel depuis l'IT de LPTIM1 ; au moins une mise à jour par tour du compteur
+ */
+static void IDLE_account(uint16_t now, uint16_t idle)
+{
+	window_total += (uint16_t)(now - window_last);
+	window_last = now;
+	window_idle += idle;
+	if(window_total >= lsi_hz / 1000 * IDLE_WINDOW_MS)
+	{
+		stats.idle_percent = (uint8_t)((uint64_t)window_idle * 100 / window_total);
+		window_total = 0;
+		window_idle = 0;
+	}
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Lance LPTIM1 sur LSI et mesure la fréquence de LSI. Bloque IDLE_CALIBRATION_MS.
+ * @pre SysTick bat (HAL_Init() a été appelée) et les IT sont autorisées
+ * @note Tant que cette fonction n'a pas été appelée, BSP_IDLE_sleep() se contente d'un WFI.
+ */
+void BSP_IDLE_init(void)
+{
+	RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+	uint32_t t;
+	uint16_t start;
+
+	if(initialized)
+		return;
+
+	__HAL_RCC_LSI_ENABLE();
+	while(!__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY));
+	PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_LPTIM1;
+	PeriphClkInit.Lptim1ClockSelection = RCC_LPTIM1CLKSOURCE_LSI;
+	if(HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
+		Error_Handler();
+	__HAL_RCC_LPTIM1_CLK_ENABLE();
+
+	LPTIM1->CR = 0;
+	LPTIM1->CFGR = 0;									//Horloge interne (LSI) sans prédiviseur, démarrage logiciel
+	LPTIM1->IER = LPTIM_IER_CMPMIE | LPTIM_IER_ARRMIE;	//IER ne s'écrit que LPTIM1 désactivé
+	LPTIM1->CR = LPTIM_CR_ENABLE;
+	LPTIM1->ARR = IDLE_LPTIM_MAX;						//ARR et CMP ne s'écrivent que LPTIM1 activé
+	while(!(LPTIM1->ISR & LPTIM_ISR_ARROK));
+	LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+	LPTIM1->CR = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;	//Comptage continu
+	HAL_NVIC_SetPriority(LPTIM1_IRQn, 15, 0);
+	HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+#ifdef DEBUG
+	DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP | DBGMCU_CR_DBG_STOP;	//Le débogueur reste connecté pendant le repos
+#endif
+
+	//Mesure de LSI entre deux fronts de SysTick
+	t = HAL_GetTick();
+	while(HAL_GetTick() == t);
+	start = IDLE_lptim_read();
+	t = HAL_GetTick();
+	while(HAL_GetTick() - t < IDLE_CALIBRATION_MS);
+	window_last = IDLE_lptim_read();
+	lsi_hz = (uint32_t)(uint16_t)(window_last - start) * 1000 / IDLE_CALIBRATION_MS;
+	stats.lsi_hz = lsi_hz;
+	initialized = true;
+}
+
+/**
+ * @brief Endort le processeur jusqu'à la prochaine IT, au plus max_ms millisecondes
+ *
+ * @param max_ms : [ms] délai avant la prochaine échéance (0 : ne s'endort pas)
+ * @pre IT masquées (PRIMASK) : l'IT qui réveille le processeur n'est servie qu'après le retour,
+ * 		une fois HAL_GetTick() et les timers logiciels remis à l'heure.
+ */
+void BSP_IDLE_sleep(uint32_t max_ms)
+{
+	uint32_t systick_ctrl;
+	uint32_t core_hz;
+	uint32_t period;
+	uint32_t cycles;
+	uint32_t ticks;
+	uint32_t ms;
+	uint32_t remaining;
+	uint16_t start;
+	uint16_t slept;
+
+	if(max_ms == 0)
+		return;
+	if(!initialized)
+	{
+		__WFI();
+		return;
+	}
+	if(max_ms > IDLE_MAX_SLEEP_MS)
+		max_ms = IDLE_MAX_SLEEP_MS;
+
+	start = IDLE_lptim_read();
+	if(max_ms < IDLE_MIN_TICKLESS_MS || BSP_systick_has_callback_functions())
+	{
+		__WFI();
+		stats.sleeps++;
+		slept = (uint16_t)(IDLE_lptim_read() - start);
+		IDLE_account(start + slept, slept);
+		return;
+	}
+
+	systick_ctrl = SysTick->CTRL;
+	SysTick->CTRL = systick_ctrl & ~SysTick_CTRL_ENABLE_Msk;
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		SysTick->CTRL = systick_ctrl;	//Une milliseconde vient de s'écouler : son IT doit d'abord être servie
+		return;
+	}
+
+	//Date de réveil : une période de LSI avant l'échéance, pour ne jamais être en retard
+	core_hz = SystemCoreClock;
+	period = SysTick->LOAD + 1;
+	cycles = period - 1 - SysTick->VAL;		//Déjà écoulés dans la milliseconde en cours
+	ticks = (uint32_t)((uint64_t)(max_ms * period - cycles) * lsi_hz / core_hz);
+	IDLE_lptim_set_compare((uint16_t)(start + ticks - 1));
+	LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+	if(!(LPTIM1->ISR & LPTIM_ISR_ARRM))
+		NVIC_ClearPendingIRQ(LPTIM1_IRQn);	//Comparaison précédente, sans intérêt
+
+#if IDLE_STOP_MODE
+	HAL_PWREx_EnterSTOP1Mode(PWR_STOPENTRY_WFI);
+	SystemClock_Config();					//Le processeur redémarre sur HSI16 : PLL et 170 MHz à rétablir
+#else
+	__DSB();
+	__WFI();
+#endif
+
+	//Remise à l'heure : HAL_GetTick() avance des millisecondes écoulées, SysTick repart dans la même phase
+	slept = (uint16_t)(IDLE_lptim_read() - start);
+	cycles += (uint32_t)((uint64_t)slept * core_hz / lsi_hz);
+	ms = cycles / period;
+	remaining = period - cycles % period;
+	if(remaining < IDLE_SYSTICK_MIN_CYCLES)
+	{
+		ms++;
+		remaining += period;
+	}
+	SysTick->LOAD = remaining - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL = systick_ctrl;
+	while(SysTick->VAL == 0);				//Chargement de LOAD au premier front d'horloge...
+	SysTick->LOAD = period - 1;				//...les périodes suivantes sont normales
+	uwTick += ms;
+	if(ms)
+		BSP_SWTIMER_process_it();			//Échéances des timers logiciels, comme dans SysTick_Handler()
+
+	stats.tickless_sleeps++;
+	if(ms > stats.longest_sleep_ms)
+		stats.longest_sleep_ms = ms;
+	IDLE_account(start + slept, slept);
+}
+
+/**
+ * @brief Pourcentage de temps passé au repos pendant la dernière fenêtre de IDLE_WINDOW_MS
+ */
+uint8_t BSP_IDLE_get_idle_percent(void)
+{
+	idle_stats_t s;
+
+	BSP_IDLE_get_stats(&s);
+	return s.idle_percent;
+}
+
+/**
+ * @brief Copie les statistiques de repos
+ */
+void BSP_IDLE_get_stats(idle_stats_t * s)
+{
+	uint32_t primask;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	if(initialized)
+		IDLE_account(IDLE_lptim_read(), 0);
+	*s = stats;
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief IT de LPTIM1 : réveil programmé par BSP_IDLE_sleep(), ou tour du compteur
+ */
+void LPTIM1_IRQHandler(void)
+{
+	IRQSTAT_ISR_ENTER(LPTIM1);
+	uint32_t flags = LPTIM1->ISR;
+
+	LPTIM1->ICR = flags & (LPTIM_ICR_CMPMCF | LPTIM_ICR_ARRMCF);
+	if(flags & LPTIM_ISR_ARRM)
+		IDLE_account(IDLE_lptim_read(), 0);	//Le compteur 16 bits ne doit pas faire un tour sans mise à jour de la fenêtre
+	IRQSTAT_ISR_EXIT(LPTIM1);
+}
+
+#endif /* USE_IDLE */
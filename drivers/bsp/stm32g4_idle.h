@@ -0,0 +1,50 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_idle.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Repos sans tick : quand l'ordonnanceur n'a rien à faire, SysTick est suspendu et le processeur
+ * 			dort (Sleep ou Stop 1) jusqu'à la prochaine échéance, réveillé par LPTIM1 ou par n'importe quelle IT.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_IDLE_H_
+#define BSP_STM32G4_IDLE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef IDLE_STOP_MODE
+	#define IDLE_STOP_MODE		0		//1 : mode Stop 1 au lieu de Sleep (cf. stm32g4_idle.c)
+#endif
+
+#define IDLE_MIN_TICKLESS_MS	2		//En deçà, simple WFI : SysTick continue de battre
+#define IDLE_MAX_SLEEP_MS		1000	//Durée maximale d'un repos (le compteur de LPTIM1 fait un tour en ~2 s)
+#define IDLE_WINDOW_MS			1000	//Fenêtre de calcul du pourcentage de repos
+
+/* Public types --------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t idle_percent;			//Temps passé au repos pendant la dernière fenêtre de IDLE_WINDOW_MS
+	uint32_t sleeps;				//Repos avec SysTick battant (échéance trop proche, ou callbacks SysTick enregistrées)
+	uint32_t tickless_sleeps;		//Repos avec SysTick suspendu
+	uint32_t longest_sleep_ms;		//Plus long repos sans tick
+	uint32_t lsi_hz;				//Fréquence de LSI mesurée par BSP_IDLE_init()
+}idle_stats_t;
+
+#if USE_IDLE
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_IDLE_init(void);
+
+void BSP_IDLE_sleep(uint32_t max_ms);
+
+uint8_t BSP_IDLE_get_idle_percent(void);
+
+void BSP_IDLE_get_stats(idle_stats_t * stats);
+
+#endif /* USE_IDLE */
+#endif /* BSP_STM32G4_IDLE_H_ */
@@ -0,0 +1,306 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_irqstat.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Statistiques des interruptions : latence, durée et imbrication (histogrammes log2),
+ * 			et plus longue section exécutée avec les IT masquées.
+ *******************************************************************************
+ */
+
+/*
+ * Toutes les dates sont lues dans le compteur de cycles du DWT (DWT->CYCCNT).
+ *
+ * 	Durée : la durée PROPRE de chaque routine est mesurée, c'est-à-dire sans le temps passé dans les routines
+ * 	plus prioritaires qui l'ont interrompue (ce temps leur est attribué).
+ *
+ * 	Latence : temps entre le déclenchement de l'IT et l'entrée dans la routine. Elle n'est connue que lorsque le
+ * 	déclenchement est daté :
+ * 		- par le matériel : SysTick et timers (leur compteur indique le temps écoulé depuis le débordement),
+ * 		- par le logiciel : BSP_IRQSTAT_trigger() juste avant d'autoriser une IT qui va se déclencher aussitôt
+ * 		  (IT TXE de l'UART par exemple).
+ * 	Une latence anormale révèle une section trop longue avec les IT masquées, ou une routine plus prioritaire trop lente.
+ *
+ * 	Sections masquées : IRQSTAT_IRQ_DISABLE / IRQSTAT_IRQ_RESTORE remplacent le couple
+ * 	__get_PRIMASK() + __disable_irq() / __set_PRIMASK() et mesurent la durée du masquage (seule la section
+ * 	la plus externe compte lorsqu'elles sont imbriquées).
+ *
+ * 	BSP_IRQSTAT_dump() écrit les statistiques sous forme de lignes de texte, mises en forme sur PC
+ * 	par tools/irqstat_report.c.
+ * 	Tout le module disparaît quand USE_IRQSTAT vaut 0 (les macros redeviennent de simples masquages d'IT).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_irqstat.h"
+
+#if USE_IRQSTAT
+#include "stm32g4_systick.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define IRQSTAT_DEPTH_MAX		(1 + (1 << __NVIC_PRIO_BITS))	//Programme principal + un niveau par priorité
+
+#define IRQSTAT_SOURCE_NAME(name)	#name,
+
+/* Private variables ---------------------------------------------------------*/
+static const char * const source_names[IRQSTAT_SOURCE_NB] = { IRQSTAT_SOURCES_LIST(IRQSTAT_SOURCE_NAME) };
+static irqstat_source_stats_t sources[IRQSTAT_SOURCE_NB];
+static irqstat_mask_stats_t masks;
+
+static uint32_t trigger_date[IRQSTAT_SOURCE_NB];
+static bool trigger_armed[IRQSTAT_SOURCE_NB];
+
+static uint32_t children[IRQSTAT_DEPTH_MAX];	//Temps passé dans les routines qui ont interrompu chaque niveau
+static uint8_t depth = 0;						//0 : programme principal
+static uint8_t max_depth = 0;
+static uint32_t mask_date;
+static bool initialized = false;
+
+/* Private functions definitions ---------------------------------------------*/
+static uint8_t IRQSTAT_bucket(uint32_t cycles)
+{
+	uint8_t b;
+
+	cycles >>= IRQSTAT_HISTO_SHIFT;
+	if(cycles == 0)
+		return 0;
+	b = (uint8_t)(32 - __CLZ(cycles));
+	return (b >= IRQSTAT_HISTO_NB) ? IRQSTAT_HISTO_NB - 1 : b;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Active le compteur de cycles du DWT.
+ * @note Appelée automatiquement à la première mesure. Peut être appelée plusieurs fois.
+ */
+void BSP_IRQSTAT_init(void)
+{
+	if(initialized)
+		return;
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	initialized = true;
+}
+
+/**
+ * @brief Entrée dans une routine d'interruption (appelée par IRQSTAT_ISR_ENTER)
+ * @param latency : [cycles] latence connue, ou IRQSTAT_NO_LATENCY
+ * @return la date d'entrée, à transmettre à BSP_IRQSTAT_exit()
+ */
+uint32_t BSP_IRQSTAT_enter(irqstat_source_id_t source, uint32_t latency)
+{
+	irqstat_source_stats_t * s;
+	uint32_t primask;
+	uint32_t now;
+
+	//IT masquées le temps de la mise à jour : une routine plus prioritaire ne doit pas s'intercaler entre la date et le niveau
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if(!initialized)
+		BSP_IRQSTAT_init();
+	now = DWT->CYCCNT;
+	if(source < IRQSTAT_SOURCE_NB)
+	{
+		s = &sources[source];
+		if(trigger_armed[source])
+		{
+			if(latency == IRQSTAT_NO_LATENCY)
+				latency = now - trigger_date[source];
+			trigger_armed[source] = false;
+		}
+		if(latency != IRQSTAT_NO_LATENCY)
+		{
+			s->latency_histo[IRQSTAT_bucket(latency)]++;
+			if(latency > s->max_latency)
+				s->max_latency = latency;
+		}
+		if(depth)
+			s->nested++;
+	}
+	if(depth < IRQSTAT_DEPTH_MAX - 1)
+		depth++;
+	children[depth] = 0;
+	if(depth > max_depth)
+		max_depth = depth;
+	__set_PRIMASK(primask);
+	return now;
+}
+
+/**
+ * @brief Sortie d'une routine d'interruption (appelée par IRQSTAT_ISR_EXIT)
+ * @param entry : date renvoyée par BSP_IRQSTAT_enter()
+ */
+void BSP_IRQSTAT_exit(irqstat_source_id_t source, uint32_t entry)
+{
+	irqstat_source_stats_t * s;
+	uint32_t primask;
+	uint32_t total;
+	uint32_t own;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	total = DWT->CYCCNT - entry;
+	own = (total > children[depth]) ? total - children[depth] : 0;
+	if(depth)
+		depth--;
+	children[depth] += total;		//Le niveau interrompu ne doit pas se voir attribuer ce temps
+	if(source < IRQSTAT_SOURCE_NB)
+	{
+		s = &sources[source];
+		s->count++;
+		s->duration_histo[IRQSTAT_bucket(own)]++;
+		if(own > s->max_duration)
+			s->max_duration = own;
+	}
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Date le déclenchement d'une IT, pour mesurer sa latence à l'entrée de la routine.
+ * @note  À appeler juste avant l'action qui déclenche l'IT. Seul le premier déclenchement non servi est retenu.
+ */
+void BSP_IRQSTAT_trigger(irqstat_source_id_t source)
+{
+	uint32_t primask;
+
+	if(source >= IRQSTAT_SOURCE_NB)
+		return;
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if(!trigger_armed[source])
+	{
+		trigger_date[source] = DWT->CYCCNT;
+		trigger_armed[source] = true;
+	}
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Début d'une section masquée (appelée par IRQSTAT_IRQ_DISABLE, IT déjà masquées)
+ * @param primask : état précédent ; 0 si les IT étaient autorisées (section la plus externe)
+ */
+void BSP_IRQSTAT_mask_start(uint32_t primask)
+{
+	if(primask)
+		return;
+	if(!initialized)
+		BSP_IRQSTAT_init();
+	mask_date = DWT->CYCCNT;
+}
+
+/**
+ * @brief Fin d'une section masquée (appelée par IRQSTAT_IRQ_RESTORE, IT encore masquées)
+ * @param site : nom de la fonction contenant la section
+ */
+void BSP_IRQSTAT_mask_stop(uint32_t primask, const char * site)
+{
+	uint32_t duration;
+
+	if(primask || !initialized)
+		return;
+	duration = DWT->CYCCNT - mask_date;
+	masks.count++;
+	masks.histo[IRQSTAT_bucket(duration)]++;
+	if(duration > masks.longest)
+	{
+		masks.longest = duration;
+		masks.longest_site = site;
+	}
+}
+
+/**
+ * @brief Copie les statistiques d'une routine d'interruption
+ * @return false si la routine ne s'est jamais exécutée
+ */
+bool BSP_IRQSTAT_get_stats(irqstat_source_id_t source, irqstat_source_stats_t * stats)
+{
+	uint32_t primask;
+
+	if(source >= IRQSTAT_SOURCE_NB)
+		return false;
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*stats = sources[source];
+	__set_PRIMASK(primask);
+	return stats->count != 0;
+}
+
+/**
+ * @brief Copie les statistiques des sections masquées
+ */
+void BSP_IRQSTAT_get_mask_stats(irqstat_mask_stats_t * stats)
+{
+	uint32_t primask;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*stats = masks;
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Plus grand nombre de routines instrumentées imbriquées observé
+ */
+uint8_t BSP_IRQSTAT_get_max_depth(void)
+{
+	return max_depth;
+}
+
+/**
+ * @brief Remet à zéro toutes les statistiques
+ */
+void BSP_IRQSTAT_reset(void)
+{
+	uint32_t primask;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	memset(sources, 0, sizeof(sources));
+	memset(&masks, 0, sizeof(masks));
+	memset(trigger_armed, 0, sizeof(trigger_armed));
+	max_depth = depth;
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Écrit les statistiques sur la sortie standard, dans le format lu par tools/irqstat_report.c :
+ * 		IRQSTAT <MHz> <SHIFT> <NB> <profondeur max>
+ * 		IRQ <nom> <count> <nested> <max_duration> <max_latency>
+ * 		DUR <nom> <cases...>
+ * 		LAT <nom> <cases...>
+ * 		MASK <count> <longest> <fonction>
+ * 		MSK <cases...>
+ * 		END
+ */
+void BSP_IRQSTAT_dump(void)
+{
+	irqstat_source_stats_t s;
+	irqstat_mask_stats_t m;
+	uint8_t i;
+	uint8_t k;
+
+	printf("IRQSTAT %d %d %d %u\n", SYSTEM_CLOCK_MHZ, IRQSTAT_HISTO_SHIFT, IRQSTAT_HISTO_NB, max_depth);
+	for(i = 0; i < IRQSTAT_SOURCE_NB; i++)
+	{
+		if(!BSP_IRQSTAT_get_stats((irqstat_source_id_t)i, &s))
+			continue;
+		printf("IRQ %s %lu %lu %lu %lu\n", source_names[i], (unsigned long)s.count, (unsigned long)s.nested,
+				(unsigned long)s.max_duration, (unsigned long)s.max_latency);
+		printf("DUR %s", source_names[i]);
+		for(k = 0; k < IRQSTAT_HISTO_NB; k++)
+			printf(" %lu", (unsigned long)s.duration_histo[k]);
+		printf("\nLAT %s", source_names[i]);
+		for(k = 0; k < IRQSTAT_HISTO_NB; k++)
+			printf(" %lu", (unsigned long)s.latency_histo[k]);
+		printf("\n");
+	}
+	BSP_IRQSTAT_get_mask_stats(&m);
+	printf("MASK %lu %lu %s\nMSK", (unsigned long)m.count, (unsigned long)m.longest, m.longest_site ? m.longest_site : "-");
+	for(k = 0; k < IRQSTAT_HISTO_NB; k++)
+		printf(" %lu", (unsigned long)m.histo[k]);
+	printf("\nEND\n");
+}
+
+#endif /* USE_IRQSTAT */
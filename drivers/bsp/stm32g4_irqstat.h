@@ -0,0 +1,160 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_irqstat.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Statistiques des interruptions : latence, durée et imbrication (histogrammes log2),
+ * 			et plus longue section exécutée avec les IT masquées.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_IRQSTAT_H_
+#define BSP_STM32G4_IRQSTAT_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+#include "stm32g4_trace.h"
+
+/* Defines -------------------------------------------------------------------*/
+/*
+ * Routines d'interruption instrumentées. Pour en ajouter une : une ligne IRQSTAT_SOURCE(NOM) ici,
+ * puis IRQSTAT_ISR_ENTER(NOM); au début de la routine et IRQSTAT_ISR_EXIT(NOM); à la fin.
+ */
+#define IRQSTAT_SOURCES_LIST(IRQSTAT_SOURCE)	\
+	IRQSTAT_SOURCE(SYSTICK)						\
+	IRQSTAT_SOURCE(USART1)						\
+	IRQSTAT_SOURCE(USART2)						\
+	IRQSTAT_SOURCE(EXTI0)						\
+	IRQSTAT_SOURCE(EXTI1)						\
+	IRQSTAT_SOURCE(EXTI2)						\
+	IRQSTAT_SOURCE(EXTI3)						\
+	IRQSTAT_SOURCE(EXTI4)						\
+	IRQSTAT_SOURCE(EXTI9_5)						\
+	IRQSTAT_SOURCE(EXTI15_10)					\
+	IRQSTAT_SOURCE(DMA1_CH1)					\
+	IRQSTAT_SOURCE(ADC1_2)						\
+	IRQSTAT_SOURCE(TIM1)						\
+	IRQSTAT_SOURCE(TIM2)						\
+	IRQSTAT_SOURCE(TIM3)						\
+	IRQSTAT_SOURCE(TIM4)						\
+	IRQSTAT_SOURCE(TIM6)						\
+	IRQSTAT_SOURCE(LPTIM1)
+
+/*
+ * Histogrammes log2 en cycles : la case 0 compte les valeurs < 2^IRQSTAT_HISTO_SHIFT,
+ * la case i (i > 0) les valeurs de [2^(i+SHIFT-1), 2^(i+SHIFT)[, la dernière case tout ce qui dépasse.
+ * Avec 16 cases et SHIFT = 5 : de "moins de 32 cycles" à "plus de 2^19 cycles" (~3 ms à 170 MHz).
+ */
+#define IRQSTAT_HISTO_NB		16
+#define IRQSTAT_HISTO_SHIFT		5
+
+#define IRQSTAT_NO_LATENCY		UINT32_MAX		//La date de déclenchement de l'IT n'est pas connue
+
+/*
+ * Avec USE_TRACE, l'entrée et la sortie des routines instrumentées sont aussi enregistrées dans la trace
+ * (cf. stm32g4_trace.h), que USE_IRQSTAT vaille 1 ou non.
+ */
+#if USE_TRACE
+	#define IRQSTAT_TRACE(id, source)	BSP_TRACE_record((id), (source))
+#else
+	#define IRQSTAT_TRACE(id, source)	((void)0)
+#endif
+
+/* Public types --------------------------------------------------------------*/
+#define IRQSTAT_SOURCE_ENUM(name)	IRQSTAT_##name,
+typedef enum
+{
+	IRQSTAT_SOURCES_LIST(IRQSTAT_SOURCE_ENUM)
+	IRQSTAT_SOURCE_NB
+}irqstat_source_id_t;
+
+/**
+ * @brief Statistiques d'une routine d'interruption, en cycles
+ */
+typedef struct
+{
+	uint32_t count;								//Nombre d'exécutions
+	uint32_t nested;							//Exécutions ayant interrompu une autre routine instrumentée
+	uint32_t max_duration;						//Durée propre (sans les routines qui l'ont interrompue)
+	uint32_t max_latency;						//Entre le déclenchement et l'entrée dans la routine
+	uint32_t duration_histo[IRQSTAT_HISTO_NB];
+	uint32_t latency_histo[IRQSTAT_HISTO_NB];	//Seulement pour les exécutions dont le déclenchement est daté
+}irqstat_source_stats_t;
+
+/**
+ * @brief Sections exécutées avec les IT masquées (entre IRQSTAT_IRQ_DISABLE et IRQSTAT_IRQ_RESTORE)
+ */
+typedef struct
+{
+	uint32_t count;
+	uint32_t longest;							//[cycles]
+	const char * longest_site;					//Fonction contenant la plus longue section
+	uint32_t histo[IRQSTAT_HISTO_NB];
+}irqstat_mask_stats_t;
+
+#if USE_IRQSTAT
+
+/**
+ * @brief Début d'une routine d'interruption instrumentée, sans date de déclenchement matérielle.
+ * @note  La latence est tout de même mesurée si BSP_IRQSTAT_trigger() a daté le déclenchement.
+ */
+#define IRQSTAT_ISR_ENTER(name)					uint32_t irqstat_entry = (IRQSTAT_TRACE(TRACE_ISR_ENTER, IRQSTAT_##name), BSP_IRQSTAT_enter(IRQSTAT_##name, IRQSTAT_NO_LATENCY))
+
+/**
+ * @brief Début d'une routine d'interruption instrumentée, dont la latence (en cycles) est connue
+ * 		  (par exemple lue dans le compteur du timer qui a déclenché l'IT)
+ */
+#define IRQSTAT_ISR_ENTER_LATENCY(name, cycles)	uint32_t irqstat_entry = (IRQSTAT_TRACE(TRACE_ISR_ENTER, IRQSTAT_##name), BSP_IRQSTAT_enter(IRQSTAT_##name, (cycles)))
+
+/**
+ * @brief Fin d'une routine d'interruption instrumentée
+ */
+#define IRQSTAT_ISR_EXIT(name)					do { BSP_IRQSTAT_exit(IRQSTAT_##name, irqstat_entry); IRQSTAT_TRACE(TRACE_ISR_EXIT, IRQSTAT_##name); } while(0)
+
+/**
+ * @brief Masque les IT (en sauvegardant l'état précédent dans primask), et mesure la durée du masquage
+ */
+#define IRQSTAT_IRQ_DISABLE(primask)	do { (primask) = __get_PRIMASK(); __disable_irq(); BSP_IRQSTAT_mask_start(primask); } while(0)
+
+/**
+ * @brief Rétablit l'état des IT sauvegardé par IRQSTAT_IRQ_DISABLE
+ */
+#define IRQSTAT_IRQ_RESTORE(primask)	do { BSP_IRQSTAT_mask_stop((primask), __func__); __set_PRIMASK(primask); } while(0)
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_IRQSTAT_init(void);
+
+uint32_t BSP_IRQSTAT_enter(irqstat_source_id_t source, uint32_t latency);
+
+void BSP_IRQSTAT_exit(irqstat_source_id_t source, uint32_t entry);
+
+void BSP_IRQSTAT_trigger(irqstat_source_id_t source);
+
+void BSP_IRQSTAT_mask_start(uint32_t primask);
+
+void BSP_IRQSTAT_mask_stop(uint32_t primask, const char * site);
+
+bool BSP_IRQSTAT_get_stats(irqstat_source_id_t source, irqstat_source_stats_t * stats);
+
+void BSP_IRQSTAT_get_mask_stats(irqstat_mask_stats_t * stats);
+
+uint8_t BSP_IRQSTAT_get_max_depth(void);
+
+void BSP_IRQSTAT_reset(void);
+
+void BSP_IRQSTAT_dump(void);
+
+#else
+	#define IRQSTAT_ISR_ENTER(name)						IRQSTAT_TRACE(TRACE_ISR_ENTER, IRQSTAT_##name)
+	#define IRQSTAT_ISR_ENTER_LATENCY(name, cycles)		IRQSTAT_TRACE(TRACE_ISR_ENTER, IRQSTAT_##name)
+	#define IRQSTAT_ISR_EXIT(name)						IRQSTAT_TRACE(TRACE_ISR_EXIT, IRQSTAT_##name)
+	#define IRQSTAT_IRQ_DISABLE(primask)				do { (primask) = __get_PRIMASK(); __disable_irq(); } while(0)
+	#define IRQSTAT_IRQ_RESTORE(primask)				__set_PRIMASK(primask)
+	#define BSP_IRQSTAT_trigger(source)					(void)0
+	#define BSP_IRQSTAT_dump()							(void)0
+	#define BSP_IRQSTAT_reset()							(void)0
+#endif /* USE_IRQSTAT */
+
+#endif /* BSP_STM32G4_IRQSTAT_H_ */
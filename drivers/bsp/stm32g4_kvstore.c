@@ -0,0 +1,574 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_kvstore.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Stockage clé-valeur en flash : écritures à la suite sur plusieurs pages,
+ * 			index en RAM, ramasse-miettes dans une page de réserve.
+ *******************************************************************************
+ */
+
+/*
+ * 		BSP_KVSTORE_set_u64(CLE_REGLAGE, reglage);			//Valeur de 64 bits
+ * 		BSP_KVSTORE_set(CLE_NOM, nom, strlen(nom) + 1);		//Ou de 0 à KVSTORE_VALUE_MAX octets
+ * 		if(BSP_KVSTORE_get_u64(CLE_REGLAGE, &reglage)) ...
+ *
+ * 	- Une valeur n'est jamais réécrite en place : chaque écriture ajoute un enregistrement à la suite
+ * 	  dans la page courante. L'enregistrement : un en-tête (clé, longueur, CRC16 des données, CRC16 de l'en-tête)
+ * 	  puis les données, sur des doubles mots. Une suppression ajoute un enregistrement sans données.
+ * 	- L'index en RAM (clé -> emplacement de sa dernière valeur) est reconstruit au démarrage en parcourant
+ * 	  les pages une fois, de la plus ancienne à la courante : la dernière valeur écrite l'emporte.
+ * 	- Une écriture est atomique : tant que ses données ne sont pas toutes programmées, leur CRC est faux et
+ * 	  l'ancienne valeur reste celle relue au démarrage. Une coupure d'alimentation ne perd que l'écriture en cours.
+ * 	  Sur la cible, lire un double mot dont la programmation a été interrompue lève en général une double erreur ECC (NMI) :
+ * 	  les lectures passent par BSP_FLASH_read_ecc, qui la signale au lieu de bloquer ; le double mot compte comme un CRC faux.
+ * 	- Les pages forment un anneau ; celle qui suit la page courante est toujours effacée (réserve).
+ * 	  Quand la page courante est pleine, la réserve devient la page courante, les valeurs encore valides de
+ * 	  la page la plus ancienne y sont recopiées, puis cette page est effacée et devient la réserve.
+ * 	  Si une coupure interrompt ce ramasse-miettes, il est terminé au démarrage suivant.
+ * 	- Une écriture dure environ 0,1 ms par double mot ; celle qui déclenche le ramasse-miettes jusqu'à
+ * 	  environ 45 ms (effacement et recopie d'une page), pendant lesquelles l'exécution depuis la flash est suspendue.
+ * 	- Une valeur identique à celle déjà en flash n'est pas réécrite.
+ * 	- Les pages sont réservées dans le script de l'éditeur de liens (région KVSTORE).
+ * 	- Banc d'essai sur PC (usure, durées, coupures d'alimentation) : tools/kvstore_bench.c.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_kvstore.h"
+
+#if USE_KVSTORE
+#if KVSTORE_PAGES_NB < 2
+	#error "KVSTORE_PAGES_NB doit valoir au moins 2"
+#endif
+
+#include "stm32g4xx_hal.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#ifndef KVSTORE_READ
+	#include "stm32g4_flash.h"
+	#define KVSTORE_READ(address, value)	BSP_FLASH_read_ecc(address, value)	//Redéfinie par les outils PC (flash simulée)
+#endif
+#define SLOTS_NB			(FLASH_PAGE_SIZE / 8)
+#define ERASED				UINT64_MAX
+#define HEADER_MAGIC		0x4B56ULL		//"KV"
+#define FLAG_DELETED		0x8000			//Dans le champ longueur : suppression de la clé
+#define FLAG_COLLECTED		0x4000			//Dans le champ longueur : recopie terminée, la page suivante dans l'anneau peut être effacée
+#define LENGTH_MASK			0x3FFF
+#define SLOTS_FOR(length)	(1 + ((length) + 7) / 8)	//En-tête et données
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	uint16_t key;
+	uint16_t length;
+	uint16_t slot;				//Emplacement de l'en-tête dans la page
+	uint8_t page;				//De 0 à KVSTORE_PAGES_NB - 1
+}entry_t;
+
+/* Private variables ---------------------------------------------------------*/
+static entry_t entries[KVSTORE_KEYS_MAX];
+static uint16_t entries_nb = 0;
+static uint8_t head = 0;				//Page courante
+static bool initialized = false;
+static kvstore_stats_t stats = {.capacity = SLOTS_NB};
+
+/* Private functions definitions ---------------------------------------------*/
+
+static uint32_t KVSTORE_address(uint8_t page, uint16_t slot)
+{
+	return FLASH_BASE + (KVSTORE_FIRST_PAGE + page) * FLASH_PAGE_SIZE + 8U * slot;
+}
+
+/**
+ * @brief CRC16 CCITT-FALSE (polynôme 0x1021), à poursuivre à partir de crc (0xFFFF au départ)
+ */
+static uint16_t KVSTORE_crc16(uint16_t crc, const uint8_t * data, uint16_t size)
+{
+	for(uint16_t i = 0; i < size; i++)
+	{
+		crc ^= (uint16_t)(data[i] << 8);
+		for(uint8_t bit = 0; bit < 8; bit++)
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+	}
+	return crc;
+}
+
+/**
+ * @brief Double mot formé de 48 bits de champs, puis de leur CRC16
+ */
+static uint64_t KVSTORE_seal(uint64_t fields)
+{
+	uint8_t bytes[6];
+
+	for(uint8_t i = 0; i < 6; i++)
+		bytes[i] = (uint8_t)(fields >> (40 - 8 * i));
+	return (fields << 16) | KVSTORE_crc16(0xFFFF, bytes, 6);
+}
+
+/**
+ * @return false si le double mot est effacé ou si son CRC est faux
+ */
+static bool KVSTORE_unseal(uint64_t word, uint64_t * fields)
+{
+	if(word == ERASED)
+		return false;
+	*fields = word >> 16;
+	return KVSTORE_seal(*fields) == word;
+}
+
+/**
+ * @brief Octets i * 8 à i * 8 + 7 de la valeur, complétés par des 0xFF
+ */
+static uint64_t KVSTORE_pack(const uint8_t * value, uint16_t length, uint16_t i)
+{
+	uint64_t word = ERASED;
+	uint16_t n = (uint16_t)(length - 8 * i);
+
+	memcpy(&word, value + 8 * i, n < 8 ? n : 8);
+	return word;
+}
+
+/**
+ * @brief CRC16 des données d'un enregistrement, lues en flash
+ * @return false si un double mot est illisible (double erreur ECC)
+ */
+static bool KVSTORE_flash_crc(uint8_t page, uint16_t slot, uint16_t length, uint16_t * crc)
+{
+	uint64_t word;
+
+	*crc = 0xFFFF;
+	for(uint16_t done = 0; done < length; done += 8, slot++)
+	{
+		if(!KVSTORE_READ(KVSTORE_address(page, slot), &word))
+			return false;
+		*crc = KVSTORE_crc16(*crc, (const uint8_t *)&word, (uint16_t)(length - done < 8 ? length - done : 8));
+	}
+	return true;
+}
+
+static bool KVSTORE_is_erased(uint8_t page)
+{
+	uint64_t word;
+
+	for(uint16_t slot = 0; slot < SLOTS_NB; slot++)
+		if(!KVSTORE_READ(KVSTORE_address(page, slot), &word) || word != ERASED)
+			return false;
+	return true;
+}
+
+/**
+ * @pre La flash est déverrouillée
+ */
+static bool KVSTORE_program(uint8_t page, uint16_t slot, uint64_t value)
+{
+	uint32_t address = KVSTORE_address(page, slot);
+	uint64_t written;
+
+	if(value == ERASED)		//Déjà à cette valeur
+		return KVSTORE_READ(address, &written) && written == ERASED;
+	if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, address, value) != HAL_OK
+			|| !KVSTORE_READ(address, &written) || written != value)
+	{
+		stats.errors++;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @pre La flash est déverrouillée
+ */
+static bool KVSTORE_erase(uint8_t page)
+{
+	FLASH_EraseInitTypeDef erase = {.TypeErase = FLASH_TYPEERASE_PAGES, .Banks = FLASH_BANK_1,
+			.Page = KVSTORE_FIRST_PAGE + page, .NbPages = 1};
+	uint32_t page_error;
+
+	if(HAL_FLASHEx_Erase(&erase, &page_error) != HAL_OK || !KVSTORE_is_erased(page))
+	{
+		stats.errors++;
+		return false;
+	}
+	return true;
+}
+
+static entry_t * KVSTORE_find(uint16_t key)
+{
+	for(uint16_t i = 0; i < entries_nb; i++)
+		if(entries[i].key == key)
+			return &entries[i];
+	return NULL;
+}
+
+static void KVSTORE_index_put(uint16_t key, uint8_t page, uint16_t slot, uint16_t length)
+{
+	entry_t * e = KVSTORE_find(key);
+
+	if(e == NULL)
+	{
+		if(entries_nb == KVSTORE_KEYS_MAX)
+		{
+			stats.errors++;
+			return;
+		}
+		e = &entries[entries_nb++];
+		e->key = key;
+	}
+	e->page = page;
+	e->slot = slot;
+	e->length = length;
+}
+
+static void KVSTORE_index_remove(uint16_t key)
+{
+	entry_t * e = KVSTORE_find(key);
+
+	if(e)
+		*e = entries[--entries_nb];
+}
+
+/**
+ * @brief Parcourt les enregistrements d'une page et, si replay, met l'index à jour
+ * @param collected : écrit à true si la page contient la marque de fin de recopie (FLAG_COLLECTED)
+ * @return emplacement qui suit le dernier enregistrement
+ */
+static uint16_t KVSTORE_scan(uint8_t page, bool replay, bool * collected)
+{
+	uint16_t slot = 1, length, flags, key, crc;
+	uint64_t word, fields;
+	bool readable;
+
+	while(slot < SLOTS_NB)
+	{
+		readable = KVSTORE_READ(KVSTORE_address(page, slot), &word);
+		if(readable && word == ERASED)
+			break;
+		if(!readable || !KVSTORE_unseal(word, &fields))		//En-tête interrompu : ses données n'ont pas été programmées, la suite commence juste après
+		{
+			stats.corrupted += replay;
+			slot++;
+			continue;
+		}
+		key = (uint16_t)(fields >> 32);
+		flags = (uint16_t)(fields >> 16);
+		length = flags & LENGTH_MASK;
+		if(length > KVSTORE_VALUE_MAX || (uint32_t)(slot + SLOTS_FOR(length)) > SLOTS_NB)
+		{
+			stats.corrupted += replay;
+			return SLOTS_NB;
+		}
+		if(flags & FLAG_COLLECTED)
+			*collected = true;
+		else if(replay)
+		{
+			if(!KVSTORE_flash_crc(page, (uint16_t)(slot + 1), length, &crc) || crc != (uint16_t)fields)
+				stats.corrupted++;
+			else if(flags & FLAG_DELETED)
+				KVSTORE_index_remove(key);
+			else
+				KVSTORE_index_put(key, page, slot, length);
+		}
+		slot = (uint16_t)(slot + SLOTS_FOR(length));
+	}
+	return slot;
+}
+
+/**
+ * @brief Recopie à la suite de la page courante les valeurs encore valides d'une page, puis l'efface
+ * @pre La flash est déverrouillée
+ */
+static bool KVSTORE_collect(uint8_t victim)
+{
+	uint16_t n;
+	uint64_t word;
+
+	for(uint16_t i = 0; i < entries_nb; i++)
+	{
+		entry_t * e = &entries[i];
+
+		if(e->page != victim)
+			continue;
+		n = SLOTS_FOR(e->length);
+		if(stats.used + n > SLOTS_NB)
+		{
+			stats.errors++;
+			return false;
+		}
+		for(uint16_t s = 0; s < n; s++)		//En-tête et données recopiés tels quels : ils ne dépendent pas de leur emplacement
+		{
+			if(!KVSTORE_READ(KVSTORE_address(victim, (uint16_t)(e->slot + s)), &word))
+			{
+				stats.errors++;
+				return false;
+			}
+			if(!KVSTORE_program(head, (uint16_t)(stats.used + s), word))
+				return false;
+		}
+		e->page = head;
+		e->slot = stats.used;
+		stats.used = (uint16_t)(stats.used + n);
+		stats.copied++;
+	}
+	if(stats.used >= SLOTS_NB)
+	{
+		stats.errors++;
+		return false;
+	}
+	//Marque écrite avant l'effacement : un effacement interrompu ne laisse pas relire au démarrage des valeurs supprimées depuis
+	if(!KVSTORE_program(head, stats.used++, KVSTORE_seal((uint64_t)FLAG_COLLECTED << 16 | 0xFFFF)))
+		return false;
+	stats.collections++;
+	return KVSTORE_erase(victim);
+}
+
+/**
+ * @brief La réserve devient la page courante ; la page la plus ancienne y est recopiée puis effacée
+ * @return false si la flash n'a pas pu être écrite
+ */
+static bool KVSTORE_next_page(void)
+{
+	uint8_t next = (uint8_t)((head + 1) % KVSTORE_PAGES_NB);
+	bool ok = true;
+
+	for(uint16_t i = 0; i < entries_nb; i++)
+		if(entries[i].page == next)		//Ramasse-miettes précédent inachevé (échec de la flash) : la réserve n'est pas libre
+		{
+			stats.errors++;
+			return false;
+		}
+	HAL_FLASH_Unlock();
+	if(!KVSTORE_is_erased(next))
+		ok = KVSTORE_erase(next);
+	if(ok)
+		ok = KVSTORE_program(next, 0, KVSTORE_seal(HEADER_MAGIC << 32 | (uint32_t)(stats.sequence + 1)));
+	if(ok)
+	{
+		head = next;
+		stats.sequence++;
+		stats.used = 1;
+		ok = KVSTORE_collect((uint8_t)((head + 1) % KVSTORE_PAGES_NB));
+	}
+	HAL_FLASH_Lock();
+	return ok;
+}
+
+/**
+ * @brief Ajoute un enregistrement à la suite de la page courante, en changeant de page si besoin
+ */
+static bool KVSTORE_append(uint16_t key, uint16_t flags, const uint8_t * value, uint16_t length)
+{
+	uint16_t n = SLOTS_FOR(length), slot;
+	uint8_t switches = 0;
+	bool ok;
+
+	while(stats.used + n > SLOTS_NB)
+	{
+		if(switches++ == KVSTORE_PAGES_NB - 1 || !KVSTORE_next_page())
+		{
+			stats.errors++;
+			return false;
+		}
+	}
+	slot = stats.used;
+	HAL_FLASH_Unlock();
+	ok = KVSTORE_program(head, slot, KVSTORE_seal((uint64_t)key << 32 | (uint32_t)(flags | length) << 16 | KVSTORE_crc16(0xFFFF, value, length)));
+	for(uint16_t i = 0; ok && i < n - 1; i++)
+		ok = KVSTORE_program(head, (uint16_t)(slot + 1 + i), KVSTORE_pack(value, length, i));
+	HAL_FLASH_Lock();
+	stats.used = (uint16_t)(stats.used + n);		//Même en cas d'échec : ces emplacements ne sont plus effacés
+	if(!ok)
+		return false;
+
+	stats.writes++;
+	if(flags & FLAG_DELETED)
+		KVSTORE_index_remove(key);
+	else
+		KVSTORE_index_put(key, head, slot, length);
+	return true;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Reconstruit l'index à partir des pages, et termine un ramasse-miettes interrompu.
+ * 		  Appelée par les autres fonctions au premier accès ; à appeler au démarrage pour ne pas en subir la durée plus tard.
+ * 		  Si aucune page n'est valide (première mise en service), les pages sont effacées.
+ */
+void BSP_KVSTORE_init(void)
+{
+	uint32_t sequences[KVSTORE_PAGES_NB];
+	bool valid[KVSTORE_PAGES_NB];
+	bool found = false, collected = false, marker;
+	uint64_t word, fields = 0;
+	uint8_t page, spare;
+	uint16_t used;
+
+	initialized = true;
+	for(page = 0; page < KVSTORE_PAGES_NB; page++)
+	{
+		valid[page] = KVSTORE_READ(KVSTORE_address(page, 0), &word) && KVSTORE_unseal(word, &fields) && (fields >> 32) == HEADER_MAGIC;
+		sequences[page] = (uint32_t)fields;
+		if(valid[page] && (!found || (int32_t)(sequences[page] - sequences[head]) > 0))
+		{
+			found = true;
+			head = page;
+		}
+	}
+	if(!found)
+	{
+		BSP_KVSTORE_format();
+		return;
+	}
+
+	stats.sequence = sequences[head];
+	entries_nb = 0;
+	spare = (uint8_t)((head + 1) % KVSTORE_PAGES_NB);
+	KVSTORE_scan(head, false, &collected);		//Recopie de la réserve terminée : son contenu (peut-être à moitié effacé) n'est plus relu
+	for(uint8_t i = 1; i <= KVSTORE_PAGES_NB; i++)		//De la plus ancienne (après la page courante dans l'anneau) à la page courante
+	{
+		page = (uint8_t)((head + i) % KVSTORE_PAGES_NB);
+		if(valid[page] && !(page == spare && collected))
+		{
+			used = KVSTORE_scan(page, true, &marker);		//Seule la marque de la page courante compte
+			if(page == head)
+				stats.used = used;
+		}
+	}
+
+	if(!KVSTORE_is_erased(spare))		//Ramasse-miettes interrompu par une coupure d'alimentation
+	{
+		HAL_FLASH_Unlock();
+		if(collected)
+			KVSTORE_erase(spare);
+		else
+			KVSTORE_collect(spare);
+		HAL_FLASH_Lock();
+	}
+}
+
+/**
+ * @brief Écrit la valeur d'une clé (nouvelle ou non)
+ * @param length : de 0 à KVSTORE_VALUE_MAX octets
+ * @return false si la valeur n'a pas pu être écrite : l'ancienne valeur est conservée
+ */
+bool BSP_KVSTORE_set(uint16_t key, const void * value, uint16_t length)
+{
+	entry_t * e;
+	uint8_t current[8];
+	uint16_t done;
+
+	if(!initialized)
+		BSP_KVSTORE_init();
+	if(length > KVSTORE_VALUE_MAX || (length && value == NULL))
+		return false;
+	e = KVSTORE_find(key);
+	if(e == NULL && entries_nb == KVSTORE_KEYS_MAX)
+	{
+		stats.errors++;
+		return false;
+	}
+	if(e && e->length == length)
+	{
+		for(done = 0; done < length; done += 8)
+		{
+			uint64_t word;
+
+			if(!KVSTORE_READ(KVSTORE_address(e->page, (uint16_t)(e->slot + 1 + done / 8)), &word))
+				break;		//Illisible : la valeur est réécrite
+			memcpy(current, &word, 8);
+			if(memcmp(current, (const uint8_t *)value + done, length - done < 8 ? length - done : 8))
+				break;
+		}
+		if(done >= length)
+		{
+			stats.unchanged++;
+			return true;
+		}
+	}
+	return KVSTORE_append(key, 0, value, length);
+}
+
+/**
+ * @brief Lit la valeur d'une clé
+ * @param size : taille de value ; seuls les size premiers octets d'une valeur plus longue sont copiés
+ * @return longueur de la valeur, -1 si la clé est absente ou si sa valeur est illisible en flash
+ */
+int32_t BSP_KVSTORE_get(uint16_t key, void * value, uint16_t size)
+{
+	entry_t * e;
+	uint64_t word;
+	uint16_t n;
+
+	if(!initialized)
+		BSP_KVSTORE_init();
+	e = KVSTORE_find(key);
+	if(e == NULL)
+		return -1;
+	if(size > e->length)
+		size = e->length;
+	for(uint16_t done = 0; done < size; done += 8)
+	{
+		if(!KVSTORE_READ(KVSTORE_address(e->page, (uint16_t)(e->slot + 1 + done / 8)), &word))
+		{
+			stats.errors++;
+			return -1;
+		}
+		n = (uint16_t)(size - done < 8 ? size - done : 8);
+		memcpy((uint8_t *)value + done, &word, n);
+	}
+	return e->length;
+}
+
+/**
+ * @return false si la suppression n'a pas pu être écrite
+ */
+bool BSP_KVSTORE_delete(uint16_t key)
+{
+	if(!initialized)
+		BSP_KVSTORE_init();
+	if(KVSTORE_find(key) == NULL)
+		return true;
+	return KVSTORE_append(key, FLAG_DELETED, NULL, 0);
+}
+
+bool BSP_KVSTORE_set_u64(uint16_t key, uint64_t value)
+{
+	return BSP_KVSTORE_set(key, &value, sizeof(value));
+}
+
+/**
+ * @return false si la clé est absente ou si sa valeur ne fait pas 64 bits
+ */
+bool BSP_KVSTORE_get_u64(uint16_t key, uint64_t * value)
+{
+	return BSP_KVSTORE_get(key, value, sizeof(*value)) == sizeof(*value);
+}
+
+void BSP_KVSTORE_get_stats(kvstore_stats_t * s)
+{
+	*s = stats;
+	s->keys = entries_nb;
+}
+
+/**
+ * @brief Efface toutes les pages et toutes les clés
+ */
+void BSP_KVSTORE_format(void)
+{
+	bool ok = true;
+
+	initialized = true;
+	HAL_FLASH_Unlock();
+	for(uint8_t page = 0; page < KVSTORE_PAGES_NB; page++)
+		ok = (KVSTORE_is_erased(page) || KVSTORE_erase(page)) && ok;
+	if(ok)
+		KVSTORE_program(0, 0, KVSTORE_seal(HEADER_MAGIC << 32));
+	HAL_FLASH_Lock();
+	head = 0;
+	entries_nb = 0;
+	stats.sequence = 0;
+	stats.used = 1;
+}
+
+#endif /* USE_KVSTORE */
@@ -0,0 +1,68 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_kvstore.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Stockage clé-valeur en flash : écritures à la suite sur plusieurs pages,
+ * 			index en RAM, ramasse-miettes dans une page de réserve.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_KVSTORE_H_
+#define BSP_STM32G4_KVSTORE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef KVSTORE_FIRST_PAGE
+	#define KVSTORE_FIRST_PAGE		58		//Pages réservées par le script de l'éditeur de liens (région KVSTORE)
+#endif
+#ifndef KVSTORE_PAGES_NB
+	#define KVSTORE_PAGES_NB		3		//Au moins 2, dont une toujours effacée (réserve du ramasse-miettes)
+#endif
+#ifndef KVSTORE_KEYS_MAX
+	#define KVSTORE_KEYS_MAX		32		//Clés présentes à la fois (index en RAM : 8 octets par clé)
+#endif
+#ifndef KVSTORE_VALUE_MAX
+	#define KVSTORE_VALUE_MAX		256		//Octets au plus dans une valeur
+#endif
+#define KVSTORE_KEY_FLASH(index)	((uint16_t)(0xFF00 | (index)))	//Clés 0xFF00 à 0xFFFF : cases de stm32g4_flash.c
+
+/* Public types --------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t sequence;				//Numéro de la page courante (nombre de changements de page depuis la première mise en service)
+	uint16_t used;					//Doubles mots occupés dans la page courante (en-tête compris)
+	uint16_t capacity;				//Doubles mots d'une page
+	uint16_t keys;					//Clés présentes
+	uint32_t writes;				//Valeurs écrites depuis le démarrage
+	uint32_t unchanged;				//Écritures évitées : valeur identique à celle déjà en flash
+	uint32_t collections;			//Passages du ramasse-miettes depuis le démarrage
+	uint32_t copied;				//Enregistrements recopiés par le ramasse-miettes
+	uint32_t corrupted;				//Enregistrements ignorés au démarrage (CRC faux : écriture interrompue)
+	uint32_t errors;				//Échecs de programmation ou d'effacement, index ou pages pleins
+}kvstore_stats_t;
+
+#if USE_KVSTORE
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_KVSTORE_init(void);
+
+bool BSP_KVSTORE_set(uint16_t key, const void * value, uint16_t length);
+
+int32_t BSP_KVSTORE_get(uint16_t key, void * value, uint16_t size);
+
+bool BSP_KVSTORE_delete(uint16_t key);
+
+bool BSP_KVSTORE_set_u64(uint16_t key, uint64_t value);
+
+bool BSP_KVSTORE_get_u64(uint16_t key, uint64_t * value);
+
+void BSP_KVSTORE_get_stats(kvstore_stats_t * stats);
+
+void BSP_KVSTORE_format(void);
+
+#endif /* USE_KVSTORE */
+#endif /* BSP_STM32G4_KVSTORE_H_ */
@@ -0,0 +1,331 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_memwatch.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Surveillance de la RAM : plus grande profondeur de pile (pile peinte au démarrage),
+ * 			garde à la frontière tas/pile, et occupation du tas par site d'allocation.
+ *******************************************************************************
+ */
+
+/*
+ * Organisation de la RAM (cf. core/Src/sysmem.c) :
+ *
+ * 		| .data | .bss | tas -->            <-- pile |
+ * 		               ^ _end        ^ limite     ^ _estack
+ * 		                             <-_Min_Stack_Size->
+ *
+ * 	_sbrk() refuse de faire croître le tas au-delà de la limite, mais rien n'empêche la pile de descendre
+ * 	plus bas que les _Min_Stack_Size octets réservés (1 Ko seulement) : elle écrase alors le tas sans bruit.
+ *
+ * 	BSP_MEMWATCH_init(), à appeler au tout début de main() :
+ * 		- peint toute la RAM libre, du sommet du tas jusque sous la pile courante, avec un motif connu :
+ * 		  la plus profonde adresse où le motif a disparu donne la plus grande profondeur de pile atteinte,
+ * 		- écrit une garde (MEMWATCH_GUARD_WORDS mots) au bas de la réserve de pile, à la limite utilisée par _sbrk() :
+ * 		  le tas ne l'atteint jamais, seule une pile qui déborde de sa réserve l'écrase.
+ * 		  BSP_MEMWATCH_process_main() (fonction de repos de l'ordonnanceur) la vérifie et le signale.
+ *
+ * 	Tas : malloc, calloc, realloc et free sont redéfinis ici (ceux de la bibliothèque C ne sont alors pas liés) :
+ * 	chaque bloc est précédé d'un en-tête de 8 octets qui mémorise sa taille et le site d'allocation
+ * 	(adresse de retour de l'appel). Les blocs alloués en interne par la bibliothèque C (printf, strdup...)
+ * 	ne passent pas par ces fonctions et ne sont pas comptés dans heap_live.
+ *
+ * 	BSP_MEMWATCH_dump() écrit le tout sur la sortie standard ; le bilan statique (.data, .bss, plus gros objets)
+ * 	est donné par tools/mem_report.c à partir du fichier .elf.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_memwatch.h"
+
+#if USE_MEMWATCH
+#include <reent.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MEMWATCH_PAINT			0xC5C5C5C5u
+#define MEMWATCH_GUARD			0xDEADBEEFu
+#define MEMWATCH_GUARD_WORDS	8			//32 octets pris sur la réserve de pile
+#define MEMWATCH_SP_MARGIN		64			//[octets] laissés sous la pile courante lors de la peinture
+#define MEMWATCH_TAG_MAGIC		0x4D574800u	//Vérifie qu'un bloc libéré a bien été alloué par malloc() ci-dessous
+#define MEMWATCH_TAG_MASK		0xFFFFFF00u
+#define MEMWATCH_OTHER_SITES	MEMWATCH_SITES_NB	//Index regroupant les sites au-delà de MEMWATCH_SITES_NB
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t size;
+	uint32_t tag;					//(MEMWATCH_TAG_MAGIC ^ size) & MEMWATCH_TAG_MASK | index du site
+}block_header_t;					//8 octets : l'alignement des blocs est conservé
+
+/* Private variables ---------------------------------------------------------*/
+extern uint8_t _end;				//Symboles du script d'édition de liens
+extern uint8_t _estack;
+extern uint32_t _Min_Stack_Size;
+
+static bool initialized = false;
+static uint32_t * paint_bottom;
+static uint32_t * paint_top;
+static uint32_t * guard;
+static bool guard_reported = false;
+static memwatch_site_t sites[MEMWATCH_SITES_NB + 1];
+static uint32_t heap_live = 0;
+
+/* Private functions declarations --------------------------------------------*/
+void * _sbrk(ptrdiff_t incr);
+void * _malloc_r(struct _reent * r, size_t size);
+void * _realloc_r(struct _reent * r, void * ptr, size_t size);
+void _free_r(struct _reent * r, void * ptr);
+
+/* Private functions definitions ---------------------------------------------*/
+
+/**
+ * @brief Index du site d'allocation (créé au premier appel), ou MEMWATCH_OTHER_SITES si la table est pleine
+ */
+static uint8_t MEMWATCH_site_index(uint32_t site)
+{
+	uint8_t i;
+
+	for(i = 0; i < MEMWATCH_SITES_NB; i++)
+	{
+		if(sites[i].site == site)
+			return i;
+		if(sites[i].site == 0)
+		{
+			sites[i].site = site;
+			return i;
+		}
+	}
+	return MEMWATCH_OTHER_SITES;
+}
+
+static void * MEMWATCH_alloc(size_t size, uint32_t site)
+{
+	block_header_t * block;
+	memwatch_site_t * s;
+	uint8_t index;
+
+	if(size > SIZE_MAX - sizeof(block_header_t))
+		return NULL;
+	block = _malloc_r(_REENT, sizeof(block_header_t) + size);
+	if(block == NULL)
+		return NULL;
+	index = MEMWATCH_site_index(site);
+	block->size = size;
+	block->tag = ((MEMWATCH_TAG_MAGIC ^ size) & MEMWATCH_TAG_MASK) | index;
+	s = &sites[index];
+	s->allocations++;
+	s->live_blocks++;
+	s->live_bytes += size;
+	if(s->live_bytes > s->peak_bytes)
+		s->peak_bytes = s->live_bytes;
+	heap_live += size;
+	return block + 1;
+}
+
+/**
+ * @brief En-tête du bloc s'il a été alloué par MEMWATCH_alloc(), NULL sinon
+ */
+static block_header_t * MEMWATCH_header(void * ptr)
+{
+	block_header_t * block = (block_header_t *)ptr - 1;
+	uint8_t index = (uint8_t)(block->tag & ~MEMWATCH_TAG_MASK);
+
+	if((block->tag & MEMWATCH_TAG_MASK) != ((MEMWATCH_TAG_MAGIC ^ block->size) & MEMWATCH_TAG_MASK) || index > MEMWATCH_OTHER_SITES)
+		return NULL;
+	return block;
+}
+
+static void MEMWATCH_release(block_header_t * block)
+{
+	memwatch_site_t * s = &sites[block->tag & ~MEMWATCH_TAG_MASK];
+
+	s->live_blocks--;
+	s->live_bytes -= block->size;
+	heap_live -= block->size;
+	block->tag = 0;		//Une seconde libération du même bloc ne sera pas comptée
+	_free_r(_REENT, block);
+}
+
+/**
+ * @brief Plus profonde adresse de pile atteinte : premier mot (en remontant depuis le sommet du tas) où le motif a disparu
+ */
+static uint32_t * MEMWATCH_deepest(void)
+{
+	uint32_t * p = (uint32_t *)(((uint32_t)_sbrk(0) + 3) & ~3u);
+
+	if(p < paint_bottom)
+		p = paint_bottom;
+	for(; p < paint_top; p++)
+	{
+		if(*p == MEMWATCH_PAINT)
+			continue;
+		if(p >= guard && p < guard + MEMWATCH_GUARD_WORDS && *p == MEMWATCH_GUARD)
+			continue;
+		break;
+	}
+	return p;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Peint la RAM libre sous la pile et pose la garde. À appeler au tout début de main().
+ */
+void BSP_MEMWATCH_init(void)
+{
+	uint32_t * p;
+	uint8_t i;
+
+	if(initialized)
+		return;
+	paint_bottom = (uint32_t *)(((uint32_t)_sbrk(0) + 3) & ~3u);
+	paint_top = (uint32_t *)((__get_MSP() - MEMWATCH_SP_MARGIN) & ~3u);
+	guard = (uint32_t *)(((uint32_t)&_estack - (uint32_t)&_Min_Stack_Size + 3) & ~3u);
+
+	for(p = paint_bottom; p < paint_top; p++)
+		*p = MEMWATCH_PAINT;
+	if(guard + MEMWATCH_GUARD_WORDS <= paint_top)
+		for(i = 0; i < MEMWATCH_GUARD_WORDS; i++)
+			guard[i] = MEMWATCH_GUARD;
+	initialized = true;
+}
+
+/**
+ * @brief Calcule l'occupation de la pile et du tas
+ * @note Parcourt la zone peinte : quelques dizaines de microsecondes
+ */
+void BSP_MEMWATCH_get_stats(memwatch_stats_t * stats)
+{
+	uint32_t heap_end = (uint32_t)_sbrk(0);
+	uint32_t deepest;
+
+	memset(stats, 0, sizeof(*stats));
+	stats->stack_reserved = (uint32_t)&_Min_Stack_Size;
+	stats->heap_size = heap_end - (uint32_t)&_end;
+	stats->heap_live = heap_live;
+	if(!initialized)
+		return;
+	deepest = (uint32_t)MEMWATCH_deepest();
+	stats->stack_peak = (uint32_t)&_estack - deepest;
+	stats->margin = (int32_t)(deepest - heap_end);
+	stats->guard_intact = BSP_MEMWATCH_check_guard();
+}
+
+/**
+ * @brief Copie les statistiques du site d'allocation d'index index
+ * @return false si ce site n'existe pas. Le dernier index (MEMWATCH_SITES_NB) regroupe les sites qui n'ont pas trouvé de place.
+ */
+bool BSP_MEMWATCH_get_site(uint8_t index, memwatch_site_t * site)
+{
+	if(index > MEMWATCH_OTHER_SITES || sites[index].allocations == 0)
+		return false;
+	*site = sites[index];
+	return true;
+}
+
+/**
+ * @brief Indique si la garde au bas de la réserve de pile est intacte
+ */
+bool BSP_MEMWATCH_check_guard(void)
+{
+	uint8_t i;
+
+	if(!initialized || guard + MEMWATCH_GUARD_WORDS > paint_top)
+		return true;
+	for(i = 0; i < MEMWATCH_GUARD_WORDS; i++)
+		if(guard[i] != MEMWATCH_GUARD)
+			return false;
+	return true;
+}
+
+/**
+ * @brief Vérifie la garde et signale (une fois) un débordement de pile. Fonction de repos de l'ordonnanceur.
+ */
+void BSP_MEMWATCH_process_main(void)
+{
+	if(guard_reported || BSP_MEMWATCH_check_guard())
+		return;
+	guard_reported = true;
+	printf("MEMWATCH : la pile a débordé de sa réserve de %lu octets (garde écrasée en 0x%08lx)\n",
+			(unsigned long)(uint32_t)&_Min_Stack_Size, (unsigned long)(uint32_t)guard);
+}
+
+/**
+ * @brief Écrit l'occupation de la pile et du tas sur la sortie standard
+ */
+void BSP_MEMWATCH_dump(void)
+{
+	memwatch_stats_t stats;
+	memwatch_site_t s;
+	uint8_t i;
+
+	BSP_MEMWATCH_get_stats(&stats);
+	printf("MEMWATCH pile : %lu octets au plus profond, %lu réservés (%lu %%), garde %s\n",
+			(unsigned long)stats.stack_peak, (unsigned long)stats.stack_reserved,
+			(unsigned long)(stats.stack_reserved ? stats.stack_peak * 100 / stats.stack_reserved : 0),
+			stats.guard_intact ? "intacte" : "ÉCRASÉE");
+	printf("MEMWATCH tas : %lu octets (dont %lu alloués par malloc), marge tas/pile : %ld octets\n",
+			(unsigned long)stats.heap_size, (unsigned long)stats.heap_live, (long)stats.margin);
+	for(i = 0; i <= MEMWATCH_OTHER_SITES; i++)
+	{
+		if(!BSP_MEMWATCH_get_site(i, &s))
+			continue;
+		printf("MEMWATCH site 0x%08lx : %lu allocations, %lu blocs / %lu octets en cours, pic %lu octets\n",
+				(unsigned long)s.site, (unsigned long)s.allocations, (unsigned long)s.live_blocks,
+				(unsigned long)s.live_bytes, (unsigned long)s.peak_bytes);
+	}
+}
+
+/* Allocation (remplace celle de la bibliothèque C) ----------------------------*/
+
+void * malloc(size_t size)
+{
+	return MEMWATCH_alloc(size, (uint32_t)__builtin_return_address(0));
+}
+
+void * calloc(size_t nb, size_t size)
+{
+	void * ptr;
+
+	if(size && nb > SIZE_MAX / size)
+		return NULL;
+	ptr = MEMWATCH_alloc(nb * size, (uint32_t)__builtin_return_address(0));
+	if(ptr)
+		memset(ptr, 0, nb * size);
+	return ptr;
+}
+
+void * realloc(void * ptr, size_t size)
+{
+	block_header_t * block;
+	void * new_ptr;
+
+	if(ptr == NULL)
+		return MEMWATCH_alloc(size, (uint32_t)__builtin_return_address(0));
+	block = MEMWATCH_header(ptr);
+	if(block == NULL)
+		return _realloc_r(_REENT, ptr, size);		//Bloc alloué par la bibliothèque C
+	new_ptr = MEMWATCH_alloc(size, (uint32_t)__builtin_return_address(0));
+	if(new_ptr == NULL)
+		return NULL;
+	memcpy(new_ptr, ptr, (block->size < size) ? block->size : size);
+	MEMWATCH_release(block);
+	return new_ptr;
+}
+
+void free(void * ptr)
+{
+	block_header_t * block;
+
+	if(ptr == NULL)
+		return;
+	block = MEMWATCH_header(ptr);
+	if(block)
+		MEMWATCH_release(block);
+	else
+		_free_r(_REENT, ptr);		//Bloc alloué par la bibliothèque C
+}
+
+#endif /* USE_MEMWATCH */
@@ -0,0 +1,62 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_memwatch.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Surveillance de la RAM : plus grande profondeur de pile (pile peinte au démarrage),
+ * 			garde à la frontière tas/pile, et occupation du tas par site d'allocation.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_MEMWATCH_H_
+#define BSP_STM32G4_MEMWATCH_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+
+#if USE_MEMWATCH
+
+/* Defines -------------------------------------------------------------------*/
+#define MEMWATCH_SITES_NB		16		//Sites d'allocation suivis (adresses d'appel de malloc)
+
+/* Public types --------------------------------------------------------------*/
+/**
+ * @brief Occupation du tas par un site d'allocation.
+ * 		  site est l'adresse de retour de l'appel à malloc : arm-none-eabi-addr2line -e firmware.elf <site>
+ */
+typedef struct
+{
+	uint32_t site;
+	uint32_t allocations;			//Nombre total d'allocations
+	uint32_t live_blocks;			//Blocs alloués et pas encore libérés
+	uint32_t live_bytes;
+	uint32_t peak_bytes;
+}memwatch_site_t;
+
+typedef struct
+{
+	uint32_t stack_reserved;		//[octets] _Min_Stack_Size (script d'édition de liens)
+	uint32_t stack_peak;			//[octets] plus grande profondeur de pile observée
+	uint32_t heap_size;				//[octets] du début du tas (_end) à son sommet actuel (_sbrk)
+	uint32_t heap_live;				//[octets] alloués et pas encore libérés (hors blocs alloués par la bibliothèque C elle-même)
+	int32_t margin;					//[octets] entre le sommet du tas et la plus profonde adresse de pile atteinte
+	bool guard_intact;				//La pile n'a jamais débordé de _Min_Stack_Size
+}memwatch_stats_t;
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_MEMWATCH_init(void);
+
+void BSP_MEMWATCH_get_stats(memwatch_stats_t * stats);
+
+bool BSP_MEMWATCH_get_site(uint8_t index, memwatch_site_t * site);
+
+bool BSP_MEMWATCH_check_guard(void);
+
+void BSP_MEMWATCH_process_main(void);
+
+void BSP_MEMWATCH_dump(void);
+
+#endif /* USE_MEMWATCH */
+#endif /* BSP_STM32G4_MEMWATCH_H_ */
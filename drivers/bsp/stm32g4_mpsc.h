@@ -0,0 +1,179 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_mpsc.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	File d'évènements sans verrou à plusieurs producteurs et un consommateur (MPSC), typée par macro.
+ *******************************************************************************
+ */
+
+/*
+ * Plusieurs IT (de priorités différentes) et la boucle principale peuvent poster, seule la boucle principale consomme.
+ *
+ * 	Un producteur réserve une position en avançant tail par LDREX/STREX : si une IT survient entre les deux
+ * 	instructions (et poste à son tour), le processeur annule la réservation exclusive au retour d'IT,
+ * 	le STREX échoue et le producteur recommence avec la nouvelle valeur de tail. Aucune IT n'est masquée.
+ *
+ * 	L'élément est ensuite écrit, puis publié en écrivant le numéro de la position (+1) dans son emplacement
+ * 	(sémantique "release"). Le consommateur ne lit un emplacement que lorsque ce numéro correspond à sa position :
+ * 	un producteur interrompu entre sa réservation et sa publication retarde donc les éléments suivants,
+ * 	mais aucun n'est lu à moitié écrit.
+ *
+ * 	Une file pleine refuse l'élément (name##_post renvoie false) et le compte dans lost : rien n'est écrasé.
+ *
+ * 	MPSC_DEFINE(event_queue, event_t) définit le type event_queue_t et les fonctions event_queue_xxx() :
+ *
+ * 		static event_queue_slot_t slots[16];			//Taille : puissance de 2
+ * 		static event_queue_t queue = MPSC_INITIALIZER(slots, 16);	//Ou event_queue_init(&queue, slots, 16);
+ *
+ * 		event_queue_post(&queue, &e);					//N'importe où, y compris en IT
+ * 		while(event_queue_pop(&queue, &e))				//Boucle principale uniquement
+ * 			handle(&e);
+ */
+
+#ifndef BSP_STM32G4_MPSC_H_
+#define BSP_STM32G4_MPSC_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#if defined(__arm__)
+	#include "stm32g4xx.h"		//__LDREXW, __STREXW, __CLREX
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define MPSC_LOAD_RELAXED(p)		__atomic_load_n((p), __ATOMIC_RELAXED)
+#define MPSC_LOAD_ACQUIRE(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define MPSC_STORE_RELEASE(p, v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+#define MPSC_IS_POWER_OF_2(size)	((size) != 0 && ((size) & ((size) - 1)) == 0)
+
+/**
+ * @brief Initialisation statique, équivalente à name##_init() : static name##_t q = MPSC_INITIALIZER(slots, 16);
+ * @pre les emplacements sont à 0 (variable statique) et size est une puissance de 2
+ */
+#define MPSC_INITIALIZER(slots_, size)	{ .head = 0, .tail = 0, .mask = (size) - 1, .lost = 0, .slots = (slots_) }
+
+/* Inline functions ----------------------------------------------------------*/
+
+/**
+ * @brief Réserve la position *tail (et avance tail), si la file n'est pas pleine
+ * @return false si la file est pleine
+ */
+static inline bool MPSC_claim(uint32_t * tail, const uint32_t * head, uint32_t size, uint32_t * position)
+{
+	uint32_t t;
+#if defined(__arm__)
+	do
+	{
+		t = __LDREXW(tail);
+		if(t - MPSC_LOAD_ACQUIRE(head) >= size)
+		{
+			__CLREX();
+			return false;
+		}
+	}while(__STREXW(t + 1, tail));
+#else
+	t = MPSC_LOAD_RELAXED(tail);
+	do
+	{
+		if(t - MPSC_LOAD_ACQUIRE(head) >= size)
+			return false;
+	}while(!__atomic_compare_exchange_n(tail, &t, t + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+#endif
+	*position = t;
+	return true;
+}
+
+/**
+ * @brief Définit les types name##_t et name##_slot_t (file d'éléments de type type) et les fonctions name##_xxx()
+ */
+#define MPSC_DEFINE(name, type)																\
+	typedef struct																			\
+	{																						\
+		type item;																			\
+		uint32_t sequence;				/* Position + 1 lorsque l'élément est publié */		\
+	}name##_slot_t;																			\
+																							\
+	typedef struct																			\
+	{																						\
+		uint32_t head;					/* Avancé uniquement par le consommateur */			\
+		uint32_t tail;					/* Réservations des producteurs (LDREX/STREX) */		\
+		uint32_t mask;																		\
+		uint32_t lost;					/* Éléments refusés, file pleine */					\
+		name##_slot_t * slots;																\
+	}name##_t;																				\
+																							\
+	/* @pre la file n'est pas utilisée pendant l'initialisation */							\
+	static inline bool name##_init(name##_t * q, name##_slot_t * slots, uint32_t size)		\
+	{																						\
+		uint32_t i;																			\
+		if(!MPSC_IS_POWER_OF_2(size))														\
+			return false;																	\
+		for(i = 0; i < size; i++)															\
+			slots[i].sequence = 0;															\
+		q->head = 0;																		\
+		q->tail = 0;																		\
+		q->mask = size - 1;																	\
+		q->lost = 0;																		\
+		q->slots = slots;																	\
+		return true;																		\
+	}																						\
+																							\
+	/* Producteurs (IT ou boucle principale) : false si la file est pleine */					\
+	static inline bool name##_post(name##_t * q, const type * item)						\
+	{																						\
+		uint32_t position;																	\
+		name##_slot_t * slot;																\
+		if(!MPSC_claim(&q->tail, &q->head, q->mask + 1, &position))							\
+		{																					\
+			__atomic_fetch_add(&q->lost, 1, __ATOMIC_RELAXED);								\
+			return false;																	\
+		}																					\
+		slot = &q->slots[position & q->mask];												\
+		slot->item = *item;																	\
+		MPSC_STORE_RELEASE(&slot->sequence, position + 1);									\
+		return true;																		\
+	}																						\
+																							\
+	/* Consommateur : plus ancien élément publié, ou NULL */									\
+	static inline type * name##_read_slot(name##_t * q)									\
+	{																						\
+		uint32_t head = MPSC_LOAD_RELAXED(&q->head);										\
+		name##_slot_t * slot = &q->slots[head & q->mask];									\
+		if(MPSC_LOAD_ACQUIRE(&slot->sequence) != head + 1)									\
+			return NULL;																	\
+		return &slot->item;																	\
+	}																						\
+																							\
+	/* Consommateur : libère l'élément lu dans name##_read_slot() */							\
+	static inline void name##_release(name##_t * q)										\
+	{																						\
+		MPSC_STORE_RELEASE(&q->head, MPSC_LOAD_RELAXED(&q->head) + 1);						\
+	}																						\
+																							\
+	/* Consommateur : false si aucun élément publié n'est disponible */						\
+	static inline bool name##_pop(name##_t * q, type * item)								\
+	{																						\
+		type * p = name##_read_slot(q);														\
+		if(p == NULL)																		\
+			return false;																	\
+		*item = *p;																			\
+		name##_release(q);																	\
+		return true;																		\
+	}																						\
+																							\
+	/* true si aucune position n'est réservée (ni publiée, ni en cours d'écriture) */			\
+	static inline bool name##_is_empty(const name##_t * q)									\
+	{																						\
+		uint32_t head = MPSC_LOAD_ACQUIRE(&q->head);										\
+		return MPSC_LOAD_ACQUIRE(&q->tail) == head;											\
+	}																						\
+																							\
+	static inline uint32_t name##_get_lost(const name##_t * q)								\
+	{																						\
+		return MPSC_LOAD_RELAXED(&q->lost);													\
+	}
+
+#endif /* BSP_STM32G4_MPSC_H_ */
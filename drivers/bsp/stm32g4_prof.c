@@ -0,0 +1,166 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_prof.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Profilage par zones, mesuré en cycles processeur avec le compteur DWT->CYCCNT.
+ *******************************************************************************
+ */
+
+/*
+ * Le compteur de cycles du DWT (Data Watchpoint and Trace) s'incrémente à chaque cycle d'horloge du processeur.
+ * Une zone relève ce compteur au début (PROF_ZONE_BEGIN), puis ajoute la différence à ses statistiques
+ * à la fin (PROF_ZONE_END) : nombre de passages, minimum, maximum et total (pour la moyenne).
+ *
+ * 	Le coût de la mesure elle-même (relevés + appel de BSP_PROF_record) est évalué à l'initialisation
+ * 	et retranché de chaque durée.
+ *
+ * 	Les durées sont sur 32 bits : une zone ne doit pas durer plus de 2^32 cycles (~25 s à 170 MHz).
+ *
+ * 	BSP_PROF_dump() affiche le tableau des statistiques sur la sortie standard.
+ * 	Tout le module (et les mesures placées dans les drivers) disparaît quand USE_PROF vaut 0.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_prof.h"
+
+#if USE_PROF
+#include "stm32g4_systick.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define PROF_ZONE_NAME(name)	#name,
+
+/* Private variables ---------------------------------------------------------*/
+static const char * const zone_names[PROF_ZONE_NB] = { PROF_ZONES_LIST(PROF_ZONE_NAME) };
+static prof_zone_stats_t zones[PROF_ZONE_NB];
+static uint32_t overhead = 0;
+static bool initialized = false;
+
+/* Private functions definitions ---------------------------------------------*/
+static void PROF_reset_zone(prof_zone_stats_t * z)
+{
+	z->count = 0;
+	z->min = UINT32_MAX;
+	z->max = 0;
+	z->total = 0;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Active le compteur de cycles du DWT et mesure le coût d'une zone vide.
+ * @note Appelée automatiquement à la première mesure. Peut être appelée plusieurs fois.
+ * @note Le compteur n'est jamais remis à zéro : irqstat et trace y lisent des dates absolues, et cette
+ * 		 fonction peut être appelée depuis une IT, entre deux de leurs lectures.
+ */
+void BSP_PROF_init(void)
+{
+	uint32_t primask;
+	uint8_t i;
+
+	if(initialized)
+		return;
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	initialized = true;
+	BSP_PROF_reset();
+
+	//Coût d'une zone vide : le plus petit de quelques essais, IT masquées
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for(i = 0; i < 8; i++)
+	{
+		PROF_ZONE_BEGIN(ILI9341_INT_FILL);
+		PROF_ZONE_END(ILI9341_INT_FILL);
+	}
+	overhead = zones[PROF_ZONE_ILI9341_INT_FILL].min;
+	PROF_reset_zone(&zones[PROF_ZONE_ILI9341_INT_FILL]);
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Ajoute une durée aux statistiques d'une zone (appelée par PROF_ZONE_END)
+ */
+void BSP_PROF_record(prof_zone_id_t zone, uint32_t cycles)
+{
+	prof_zone_stats_t * z;
+	uint32_t primask;
+
+	if(!initialized)
+	{
+		BSP_PROF_init();	//Première mesure : le compteur n'était pas lancé, la durée n'a pas de sens
+		return;
+	}
+	if(zone >= PROF_ZONE_NB)
+		return;
+
+	cycles = (cycles > overhead) ? cycles - overhead : 0;
+	z = &zones[zone];
+
+	primask = __get_PRIMASK();
+	__disable_irq();	//Une IT peut terminer une zone (la même ou une autre) pendant la mise à jour
+	z->count++;
+	z->total += cycles;
+	if(cycles < z->min)
+		z->min = cycles;
+	if(cycles > z->max)
+		z->max = cycles;
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Copie les statistiques d'une zone
+ * @return false si la zone n'a jamais été mesurée
+ */
+bool BSP_PROF_get_stats(prof_zone_id_t zone, prof_zone_stats_t * stats)
+{
+	uint32_t primask;
+
+	if(zone >= PROF_ZONE_NB)
+		return false;
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*stats = zones[zone];
+	__set_PRIMASK(primask);
+	return stats->count != 0;
+}
+
+/**
+ * @brief Remet à zéro les statistiques de toutes les zones
+ */
+void BSP_PROF_reset(void)
+{
+	uint32_t primask;
+	uint8_t i;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for(i = 0; i < PROF_ZONE_NB; i++)
+		PROF_reset_zone(&zones[i]);
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Affiche les statistiques de toutes les zones mesurées (cycles et microsecondes)
+ */
+void BSP_PROF_dump(void)
+{
+	prof_zone_stats_t z;
+	uint32_t mean;
+	uint8_t i;
+
+	printf("%-20s %10s %10s %10s %10s %10s\n", "zone", "count", "min", "mean", "max", "mean[us]");
+	for(i = 0; i < PROF_ZONE_NB; i++)
+	{
+		if(!BSP_PROF_get_stats((prof_zone_id_t)i, &z))
+			continue;
+		mean = (uint32_t)(z.total / z.count);
+		printf("%-20s %10lu %10lu %10lu %10lu %10lu\n", zone_names[i], (unsigned long)z.count,
+				(unsigned long)z.min, (unsigned long)mean, (unsigned long)z.max, (unsigned long)(mean / SYSTEM_CLOCK_MHZ));
+	}
+	printf("(cycles @ %d MHz, measurement overhead of %lu cycles removed)\n", SYSTEM_CLOCK_MHZ, (unsigned long)overhead);
+}
+
+#endif /* USE_PROF */
@@ -0,0 +1,83 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_prof.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Profilage par zones, mesuré en cycles processeur avec le compteur DWT->CYCCNT.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_PROF_H_
+#define BSP_STM32G4_PROF_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+/*
+ * Liste des zones mesurées. Pour en ajouter une : une ligne PROF_ZONE(NOM) ici,
+ * puis PROF_ZONE_BEGIN(NOM); ... PROF_ZONE_END(NOM); autour du code à mesurer.
+ */
+#define PROF_ZONES_LIST(PROF_ZONE)		\
+	PROF_ZONE(ILI9341_INT_FILL)			\
+	PROF_ZONE(ILI9341_PUTC)				\
+	PROF_ZONE(ILI9341_DRAW_PIXEL)		\
+	PROF_ZONE(LD19_PARSE)				\
+	PROF_ZONE(SD_READ_BLOCKS)			\
+	PROF_ZONE(BANQUE_SD_CHARGER)		\
+	PROF_ZONE(GERER_BOUTONS)			\
+	PROF_ZONE(MACHINE_ETATS)
+
+/* Public types --------------------------------------------------------------*/
+#define PROF_ZONE_ENUM(name)	PROF_ZONE_##name,
+typedef enum
+{
+	PROF_ZONES_LIST(PROF_ZONE_ENUM)
+	PROF_ZONE_NB
+}prof_zone_id_t;
+
+/**
+ * @brief Statistiques d'une zone, en cycles (1 cycle = 1/SYSTEM_CLOCK_MHZ us)
+ */
+typedef struct
+{
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;		//mean = total / count
+}prof_zone_stats_t;
+
+#if USE_PROF
+#include "stm32g4xx_hal.h"
+
+/**
+ * @brief Début d'une zone mesurée. Les zones s'imbriquent librement (chacune a sa propre date de début).
+ * @note La durée mesurée inclut les zones imbriquées et les interruptions survenues pendant la zone.
+ */
+#define PROF_ZONE_BEGIN(name)	uint32_t prof_start_##name = DWT->CYCCNT
+
+/**
+ * @brief Fin d'une zone : met à jour ses statistiques. Utilisable en IT.
+ */
+#define PROF_ZONE_END(name)		BSP_PROF_record(PROF_ZONE_##name, DWT->CYCCNT - prof_start_##name)
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_PROF_init(void);
+
+void BSP_PROF_record(prof_zone_id_t zone, uint32_t cycles);
+
+bool BSP_PROF_get_stats(prof_zone_id_t zone, prof_zone_stats_t * stats);
+
+void BSP_PROF_reset(void);
+
+void BSP_PROF_dump(void);
+
+#else
+	#define PROF_ZONE_BEGIN(name)	do {} while(0)
+	#define PROF_ZONE_END(name)		do {} while(0)
+	#define BSP_PROF_dump()			(void)0
+	#define BSP_PROF_reset()		(void)0
+#endif /* USE_PROF */
+
+#endif /* BSP_STM32G4_PROF_H_ */
@@ -0,0 +1,145 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_ring.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	File circulaire sans verrou à un producteur et un consommateur (SPSC), typée par macro.
+ *******************************************************************************
+ */
+
+/*
+ * Passage de données d'une IT vers la boucle principale (ou l'inverse) sans masquer les IT :
+ * le producteur est le seul à avancer head, le consommateur le seul à avancer tail.
+ * Les deux index tournent librement sur 32 bits : head - tail est le nombre d'éléments présents.
+ *
+ * 	Barrières : chaque côté lit l'index de l'autre avec une sémantique "acquire" et publie le sien avec
+ * 	une sémantique "release" (barrière DMB générée par le compilateur sur Cortex-M4). Les données d'un élément
+ * 	sont donc toujours écrites avant que le consommateur ne le voie, et lues avant que le producteur ne le réutilise.
+ *
+ * 	Une file pleine refuse l'élément : rien n'est jamais écrasé, à l'appelant de compter la perte.
+ *
+ * 	RING_DEFINE(sample_ring, sample_t) définit le type sample_ring_t et les fonctions sample_ring_xxx() :
+ *
+ * 		static sample_t storage[8];						//Taille : puissance de 2
+ * 		static sample_ring_t ring;
+ * 		sample_ring_init(&ring, storage, 8);
+ *
+ * 		//Producteur (en IT)							//Consommateur (boucle principale)
+ * 		if(!sample_ring_push(&ring, &s))				while(sample_ring_pop(&ring, &s))
+ * 			lost++;										 	use(&s);
+ *
+ * 	Variante sans recopie, pour les gros éléments : l'élément est construit puis lu directement dans la file.
+ *
+ * 		p = sample_ring_write_slot(&ring);				p = sample_ring_read_slot(&ring);
+ * 		if(p) { fill(p); sample_ring_publish(&ring); }	if(p) { use(p); sample_ring_release(&ring); }
+ */
+
+#ifndef BSP_STM32G4_RING_H_
+#define BSP_STM32G4_RING_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define RING_LOAD_RELAXED(p)		__atomic_load_n((p), __ATOMIC_RELAXED)
+#define RING_LOAD_ACQUIRE(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RING_STORE_RELEASE(p, v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+#define RING_IS_POWER_OF_2(size)	((size) != 0 && ((size) & ((size) - 1)) == 0)
+
+/**
+ * @brief Initialisation statique, équivalente à name##_init() : static name##_t r = RING_INITIALIZER(storage, 8);
+ * @pre size est une puissance de 2
+ */
+#define RING_INITIALIZER(storage, size)	{ .head = 0, .tail = 0, .mask = (size) - 1, .items = (storage) }
+
+/**
+ * @brief Définit le type name##_t (file d'éléments de type type) et ses fonctions name##_xxx()
+ */
+#define RING_DEFINE(name, type)																\
+	typedef struct																			\
+	{																						\
+		uint32_t head;					/* Avancé uniquement par le producteur */				\
+		uint32_t tail;					/* Avancé uniquement par le consommateur */			\
+		uint32_t mask;																		\
+		type * items;																		\
+	}name##_t;																				\
+																							\
+	/* @pre ni le producteur ni le consommateur n'utilisent la file pendant l'initialisation */	\
+	static inline bool name##_init(name##_t * r, type * storage, uint32_t size)				\
+	{																						\
+		if(!RING_IS_POWER_OF_2(size))														\
+			return false;																	\
+		r->head = 0;																		\
+		r->tail = 0;																		\
+		r->mask = size - 1;																	\
+		r->items = storage;																	\
+		return true;																		\
+	}																						\
+																							\
+	static inline uint32_t name##_count(const name##_t * r)								\
+	{																						\
+		uint32_t tail = RING_LOAD_ACQUIRE(&r->tail);										\
+		return RING_LOAD_ACQUIRE(&r->head) - tail;											\
+	}																						\
+																							\
+	static inline bool name##_is_empty(const name##_t * r)									\
+	{																						\
+		return name##_count(r) == 0;														\
+	}																						\
+																							\
+	/* Producteur : emplacement libre suivant, ou NULL si la file est pleine */				\
+	static inline type * name##_write_slot(name##_t * r)									\
+	{																						\
+		uint32_t head = RING_LOAD_RELAXED(&r->head);										\
+		if(head - RING_LOAD_ACQUIRE(&r->tail) > r->mask)									\
+			return NULL;																	\
+		return &r->items[head & r->mask];													\
+	}																						\
+																							\
+	/* Producteur : rend visible l'élément rempli dans name##_write_slot() */				\
+	static inline void name##_publish(name##_t * r)										\
+	{																						\
+		RING_STORE_RELEASE(&r->head, RING_LOAD_RELAXED(&r->head) + 1);						\
+	}																						\
+																							\
+	/* Consommateur : plus ancien élément, ou NULL si la file est vide */					\
+	static inline type * name##_read_slot(name##_t * r)									\
+	{																						\
+		uint32_t tail = RING_LOAD_RELAXED(&r->tail);										\
+		if(RING_LOAD_ACQUIRE(&r->head) == tail)												\
+			return NULL;																	\
+		return &r->items[tail & r->mask];													\
+	}																						\
+																							\
+	/* Consommateur : libère l'élément lu dans name##_read_slot() */							\
+	static inline void name##_release(name##_t * r)										\
+	{																						\
+		RING_STORE_RELEASE(&r->tail, RING_LOAD_RELAXED(&r->tail) + 1);						\
+	}																						\
+																							\
+	/* Producteur : false si la file est pleine (l'élément n'est pas ajouté) */				\
+	static inline bool name##_push(name##_t * r, const type * item)						\
+	{																						\
+		type * slot = name##_write_slot(r);													\
+		if(slot == NULL)																	\
+			return false;																	\
+		*slot = *item;																		\
+		name##_publish(r);																	\
+		return true;																		\
+	}																						\
+																							\
+	/* Consommateur : false si la file est vide */											\
+	static inline bool name##_pop(name##_t * r, type * item)								\
+	{																						\
+		type * slot = name##_read_slot(r);													\
+		if(slot == NULL)																	\
+			return false;																	\
+		*item = *slot;																		\
+		name##_release(r);																	\
+		return true;																		\
+	}
+
+#endif /* BSP_STM32G4_RING_H_ */
@@ -0,0 +1,84 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_rng.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Générateur de nombres aléatoires matériel (RNG), cadencé par l'oscillateur HSI48.
+ *******************************************************************************
+ */
+
+/*
+ * Le RNG tire son entropie du bruit analogique de la puce : contrairement à time(NULL) (toujours le même
+ * au démarrage, faute de RTC réglée) ou à HAL_GetTick(), la valeur change à chaque mise sous tension.
+ *
+ * 		BSP_RNG_init();
+ * 		srand(BSP_RNG_get());		//Graine du générateur pseudo-aléatoire de la bibliothèque C
+ *
+ * 	Une valeur de 32 bits est prête toutes les ~42 périodes de l'horloge du RNG (moins d'une microseconde).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_rng.h"
+
+#if USE_RNG
+#include "stm32g4_sys.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define RNG_ATTEMPTS_NB		3		//Tentatives (réinitialisation du RNG entre deux) avant de renoncer
+
+/* Private variables ---------------------------------------------------------*/
+static RNG_HandleTypeDef hrng;
+static bool initialized = false;
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Démarre l'oscillateur HSI48 et le RNG. Peut être appelée plusieurs fois (les appels suivants sont sans effet).
+ */
+void BSP_RNG_init(void)
+{
+	RCC_OscInitTypeDef osc = {0};
+	RCC_PeriphCLKInitTypeDef clk = {0};
+
+	if(initialized)
+		return;
+
+	osc.OscillatorType = RCC_OSCILLATORTYPE_HSI48;
+	osc.HSI48State = RCC_HSI48_ON;
+	osc.PLL.PLLState = RCC_PLL_NONE;
+	if(HAL_RCC_OscConfig(&osc) != HAL_OK)
+		return;
+
+	clk.PeriphClockSelection = RCC_PERIPHCLK_RNG;
+	clk.RngClockSelection = RCC_RNGCLKSOURCE_HSI48;
+	if(HAL_RCCEx_PeriphCLKConfig(&clk) != HAL_OK)
+		return;
+
+	__HAL_RCC_RNG_CLK_ENABLE();
+	hrng.Instance = RNG;
+	hrng.Init.ClockErrorDetection = RNG_CED_ENABLE;
+	initialized = (HAL_RNG_Init(&hrng) == HAL_OK);
+}
+
+/**
+ * @brief Renvoie une valeur aléatoire de 32 bits.
+ * @note En cas d'erreur du RNG (horloge ou graine), il est réinitialisé. S'il ne fournit toujours rien,
+ * 		 la valeur renvoyée mélange le compteur de cycles et l'heure : imprévisible à la milliseconde près, sans plus.
+ */
+uint32_t BSP_RNG_get(void)
+{
+	uint32_t value;
+	uint8_t i;
+
+	BSP_RNG_init();
+	for(i = 0; initialized && i < RNG_ATTEMPTS_NB; i++)
+	{
+		if(HAL_RNG_GenerateRandomNumber(&hrng, &value) == HAL_OK)
+			return value;
+		HAL_RNG_DeInit(&hrng);
+		HAL_RNG_Init(&hrng);
+	}
+	return DWT->CYCCNT ^ (HAL_GetTick() * 2654435761u);
+}
+
+#endif /* USE_RNG */
@@ -0,0 +1,26 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_rng.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Générateur de nombres aléatoires matériel (RNG), cadencé par l'oscillateur HSI48.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_RNG_H_
+#define BSP_STM32G4_RNG_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+
+#if USE_RNG
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_RNG_init(void);
+
+uint32_t BSP_RNG_get(void);
+
+#endif /* USE_RNG */
+#endif /* BSP_STM32G4_RNG_H_ */
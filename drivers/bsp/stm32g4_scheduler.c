@@ -0,0 +1,282 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_scheduler.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Ordonnanceur coopératif : tâches à échéance (exécutées jusqu'au bout,
+ * 			la plus urgente d'abord), file d'évènements et fonctions de repos.
+ *******************************************************************************
+ */
+
+/*
+ * La boucle principale se résume à BSP_SCHEDULER_run(). À chaque tour :
+ * 		1- les callbacks différés des timers logiciels sont appelés (BSP_SWTIMER_process_main)
+ * 		2- les évènements postés (depuis une IT ou une tâche) sont transmis au gestionnaire d'évènements
+ * 		3- parmi les tâches activées, celle dont l'échéance est la plus proche est exécutée
+ * 		4- s'il n'y a rien d'autre à faire, les fonctions de repos sont appelées, puis le processeur
+ * 		   est endormi (WFI) jusqu'à la prochaine interruption (au plus tard le SysTick suivant).
+ * 		   Avec USE_IDLE, SysTick est suspendu jusqu'à la prochaine échéance (cf. stm32g4_idle.c).
+ *
+ * 	Une tâche ne doit jamais attendre (pas de HAL_Delay ni de boucle d'attente) : une attente devient
+ * 	un état de la machine à états de la tâche, dont on sort quand une date est atteinte.
+ *
+ * 		static task_t task;
+ * 		BSP_SCHEDULER_task_init(&task, &my_process, 5);		//Exécution au plus tard 5ms après l'activation
+ * 		BSP_SCHEDULER_task_start(&task, 0, 10);				//Activée toutes les 10ms
+ * 		BSP_SCHEDULER_run();
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_scheduler.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_mpsc.h"
+#include "stm32g4_idle.h"
+#include "stm32g4xx_hal.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t event;
+	uint32_t param;
+}event_t;
+
+//Les évènements peuvent être postés depuis plusieurs IT et la boucle principale : file MPSC, sans masquage des IT
+MPSC_DEFINE(event_queue, event_t)
+
+/* Private variables ---------------------------------------------------------*/
+static task_t * tasks = NULL;
+static event_handler_t event_handler = NULL;
+static callback_fun_t idle_hooks[SCHEDULER_IDLE_HOOK_NB];
+
+static event_queue_slot_t event_slots[SCHEDULER_EVENT_QUEUE_SIZE];
+static event_queue_t events = MPSC_INITIALIZER(event_slots, SCHEDULER_EVENT_QUEUE_SIZE);
+
+/* Private functions definitions ---------------------------------------------*/
+
+/**
+ * @brief Active les tâches dont la date d'activation est atteinte, et renvoie la plus urgente des tâches activées
+ */
+static task_t * SCHEDULER_elect(uint32_t now)
+{
+	task_t * task;
+	task_t * elected = NULL;
+
+	for(task = tasks; task != NULL; task = task->next)
+	{
+		if(task->armed && (int32_t)(now - task->release) >= 0)
+		{
+			task->deadline = task->release + task->relative_deadline;
+			task->ready = true;
+			if(task->period)
+				task->release += task->period;	//Pas de dérive. Une activation pas encore exécutée n'est pas dupliquée.
+			else
+				task->armed = false;
+		}
+		if(task->ready && (elected == NULL || (int32_t)(task->deadline - elected->deadline) < 0))
+			elected = task;
+	}
+	return elected;
+}
+
+/**
+ * @brief Transmet les évènements postés au gestionnaire d'évènements
+ * @return true si au moins un évènement a été traité
+ */
+static bool SCHEDULER_dispatch_events(void)
+{
+	bool done = false;
+	event_t e;
+
+	while(event_queue_pop(&events, &e))
+	{
+		if(event_handler)
+			event_handler(e.event, e.param);
+		done = true;
+	}
+	return done;
+}
+
+/**
+ * @brief Délai avant la prochaine activation de tâche ou échéance de timer logiciel
+ * @return [ms] 0 s'il ne faut pas s'endormir
+ * @pre IT masquées
+ */
+static uint32_t SCHEDULER_idle_ms(uint32_t now)
+{
+	task_t * task;
+	uint32_t idle_ms = BSP_SWTIMER_get_idle_ms();
+	int32_t delta;
+
+	for(task = tasks; task != NULL; task = task->next)
+	{
+		if(task->ready)
+			return 0;
+		if(task->armed)
+		{
+			delta = (int32_t)(task->release - now);
+			if(delta <= 0)
+				return 0;
+			if((uint32_t)delta < idle_ms)
+				idle_ms = (uint32_t)delta;
+		}
+	}
+	return idle_ms;
+}
+
+/**
+ * @brief Enregistre une tâche dans la liste des tâches, si elle n'y est pas déjà
+ */
+static void SCHEDULER_register(task_t * task)
+{
+	task_t * t;
+	for(t = tasks; t != NULL; t = t->next)
+		if(t == task)
+			return;
+	task->next = tasks;
+	tasks = task;
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Initialise une tâche (non activée)
+ *
+ * @param run					fonction exécutée à chaque activation
+ * @param relative_deadline_ms	délai accordé à chaque activation : départage les tâches prêtes en même temps
+ */
+void BSP_SCHEDULER_task_init(task_t * task, callback_fun_t run, uint32_t relative_deadline_ms)
+{
+	task->run = run;
+	task->relative_deadline = relative_deadline_ms;
+	task->period = 0;
+	task->ready = false;
+	task->armed = false;
+	task->missed_deadlines = 0;
+	SCHEDULER_register(task);
+}
+
+/**
+ * @brief Programme l'activation d'une tâche
+ *
+ * @param delay_ms	délai avant la première activation (0 : dès le prochain tour de boucle)
+ * @param period_ms	période des activations suivantes, 0 pour une activation unique
+ */
+void BSP_SCHEDULER_task_start(task_t * task, uint32_t delay_ms, uint32_t period_ms)
+{
+	task->period = period_ms;
+	task->release = HAL_GetTick() + delay_ms;
+	task->armed = true;
+}
+
+/**
+ * @brief Active immédiatement une tâche (utilisable en IT)
+ */
+void BSP_SCHEDULER_task_activate(task_t * task)
+{
+	task->deadline = HAL_GetTick() + task->relative_deadline;
+	task->ready = true;
+}
+
+/**
+ * @brief Annule les activations programmées ou en attente d'une tâche
+ */
+void BSP_SCHEDULER_task_stop(task_t * task)
+{
+	task->armed = false;
+	task->ready = false;
+}
+
+/**
+ * @brief Définit la fonction appelée (depuis la boucle principale) pour chaque évènement posté
+ */
+void BSP_SCHEDULER_set_event_handler(event_handler_t handler)
+{
+	event_handler = handler;
+}
+
+/**
+ * @brief Poste un évènement. Utilisable en IT.
+ *
+ * @return false si la file est pleine (l'évènement est perdu)
+ */
+bool BSP_SCHEDULER_post_event(uint8_t event, uint32_t param)
+{
+	return event_queue_post(&events, &(event_t){event, param});
+}
+
+/**
+ * @brief Renvoie le nombre d'évènements perdus parce que la file était pleine
+ */
+uint32_t BSP_SCHEDULER_get_lost_events(void)
+{
+	return event_queue_get_lost(&events);
+}
+
+/**
+ * @brief Ajoute une fonction appelée quand il n'y a rien d'autre à faire (travail de fond). Elle doit être courte.
+ *
+ * @return false s'il n'y a plus de place
+ */
+bool BSP_SCHEDULER_add_idle_hook(callback_fun_t hook)
+{
+	uint8_t i;
+	for(i = 0; i < SCHEDULER_IDLE_HOOK_NB; i++)
+	{
+		if(!idle_hooks[i])
+		{
+			idle_hooks[i] = hook;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Un tour de l'ordonnanceur : évènements, puis la tâche la plus urgente, ou à défaut le repos
+ */
+void BSP_SCHEDULER_run_once(void)
+{
+	task_t * task;
+	uint8_t i;
+
+	BSP_SWTIMER_process_main();
+	if(SCHEDULER_dispatch_events())
+		return;		//Un évènement a pu activer une tâche plus urgente : on réélit
+
+	task = SCHEDULER_elect(HAL_GetTick());
+	if(task)
+	{
+		task->ready = false;
+		if((int32_t)(HAL_GetTick() - task->deadline) > 0)
+			task->missed_deadlines++;
+		task->run();
+		return;
+	}
+
+	for(i = 0; i < SCHEDULER_IDLE_HOOK_NB; i++)
+		if(idle_hooks[i])
+			idle_hooks[i]();
+
+	//On ne s'endort que si rien n'a été posté ou activé entre-temps. Une IT survenue après __disable_irq() réveille quand même le WFI.
+	__disable_irq();
+#if USE_IDLE
+	if(event_queue_is_empty(&events))
+		BSP_IDLE_sleep(SCHEDULER_idle_ms(HAL_GetTick()));	//Sans tick jusqu'à la prochaine échéance
+#else
+	for(task = tasks; task != NULL; task = task->next)
+		if(task->ready)
+			break;
+	if(task == NULL && event_queue_is_empty(&events))
+		__WFI();
+#endif
+	__enable_irq();
+}
+
+/**
+ * @brief Boucle principale de l'ordonnanceur (ne rend jamais la main)
+ */
+void BSP_SCHEDULER_run(void)
+{
+	while(1)
+		BSP_SCHEDULER_run_once();
+}
@@ -0,0 +1,64 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_scheduler.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Ordonnanceur coopératif : tâches à échéance (exécutées jusqu'au bout,
+ * 			la plus urgente d'abord), file d'évènements et fonctions de repos.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_SCHEDULER_H_
+#define BSP_STM32G4_SCHEDULER_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef SCHEDULER_EVENT_QUEUE_SIZE
+	#define SCHEDULER_EVENT_QUEUE_SIZE	16		//Évènements en attente au plus (puissance de 2)
+#endif
+
+#define SCHEDULER_IDLE_HOOK_NB			4
+
+/* Public types --------------------------------------------------------------*/
+/**
+ * @brief Tâche. La structure appartient à l'appelant (variable statique ou globale).
+ */
+typedef struct task_s
+{
+	struct task_s * next;			//Chaînage des tâches enregistrées
+	callback_fun_t run;				//Fonction exécutée jusqu'au bout à chaque activation : elle ne doit jamais attendre !
+	uint32_t period;				//[ms] 0 pour une tâche activée une seule fois
+	uint32_t relative_deadline;		//[ms] délai accordé après l'activation
+	uint32_t release;				//[ms] date de la prochaine activation
+	uint32_t deadline;				//[ms] échéance absolue de l'activation en cours
+	volatile bool ready;			//Activation en attente d'exécution
+	bool armed;						//Activation programmée à la date release
+	uint32_t missed_deadlines;		//Activations exécutées après leur échéance
+}task_t;
+
+typedef void (*event_handler_t)(uint8_t event, uint32_t param);
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_SCHEDULER_task_init(task_t * task, callback_fun_t run, uint32_t relative_deadline_ms);
+
+void BSP_SCHEDULER_task_start(task_t * task, uint32_t delay_ms, uint32_t period_ms);
+
+void BSP_SCHEDULER_task_activate(task_t * task);
+
+void BSP_SCHEDULER_task_stop(task_t * task);
+
+void BSP_SCHEDULER_set_event_handler(event_handler_t handler);
+
+bool BSP_SCHEDULER_post_event(uint8_t event, uint32_t param);
+
+uint32_t BSP_SCHEDULER_get_lost_events(void);
+
+bool BSP_SCHEDULER_add_idle_hook(callback_fun_t hook);
+
+void BSP_SCHEDULER_run_once(void);
+
+void BSP_SCHEDULER_run(void);
+
+#endif /* BSP_STM32G4_SCHEDULER_H_ */
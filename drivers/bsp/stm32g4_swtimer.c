@@ -0,0 +1,353 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_swtimer.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Timers logiciels (simples ou périodiques) rangés dans une roue
+ * 			hiérarchique, cadencée par l'interruption SysTick.
+ *******************************************************************************
+ */
+
+/*
+ * Au lieu d'ajouter une fonction appelée toutes les millisecondes (BSP_systick_add_callback_function) qui décompte
+ * sa propre variable, un module arme un timer :
+ *
+ * 		static swtimer_t timer;
+ * 		BSP_SWTIMER_init(&timer, &my_callback, SWTIMER_DISPATCH_MAIN);
+ * 		BSP_SWTIMER_start(&timer, 100, 100);		//Première échéance dans 100ms, puis toutes les 100ms
+ * 		...
+ * 		BSP_SWTIMER_process_main();					//Dans la boucle principale, pour les timers SWTIMER_DISPATCH_MAIN
+ *
+ * 	Les timers sont rangés selon leur date d'échéance dans une roue à plusieurs niveaux :
+ * 		- niveau 0 : SWTIMER_LEVEL0_SIZE alvéoles d'une milliseconde
+ * 		- niveau n : SWTIMER_LEVELN_SIZE alvéoles, chacune couvrant la totalité du niveau n-1
+ * 	Quand le niveau 0 a fait un tour, l'alvéole courante du niveau 1 est redistribuée dans les niveaux inférieurs, etc.
+ * 	Insertion et retrait d'un timer se font en temps constant (listes doublement chaînées).
+ *
+ * 	La date de la prochaine alvéole non vide (ou du prochain tour à redistribuer) est tenue à jour :
+ * 	tant qu'elle n'est pas atteinte, l'interruption SysTick se contente d'une comparaison.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_swtimer.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4xx_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SWTIMER_LEVEL0_BITS		6
+#define SWTIMER_LEVEL0_SIZE		(1U << SWTIMER_LEVEL0_BITS)
+#define SWTIMER_LEVEL0_MASK		(SWTIMER_LEVEL0_SIZE - 1)
+#define SWTIMER_LEVELN_BITS		3
+#define SWTIMER_LEVELN_SIZE		(1U << SWTIMER_LEVELN_BITS)
+#define SWTIMER_LEVELN_MASK		(SWTIMER_LEVELN_SIZE - 1)
+#define SWTIMER_LEVELS			5		//Niveau 0 + 4 niveaux supérieurs : échéances jusqu'à 2^18 ms (~262 s) sans recalcul
+
+//Décalage donnant l'alvéole du niveau l (l >= 1) à partir d'une date
+#define SWTIMER_SHIFT(l)		(SWTIMER_LEVEL0_BITS + ((l) - 1) * SWTIMER_LEVELN_BITS)
+//Au-delà, le timer est rangé dans l'alvéole la plus lointaine, puis reclassé quand elle est redistribuée
+#define SWTIMER_RANGE			((uint32_t)1 << SWTIMER_SHIFT(SWTIMER_LEVELS))
+
+/* Private variables ---------------------------------------------------------*/
+static swtimer_t * level0[SWTIMER_LEVEL0_SIZE];
+static swtimer_t * leveln[SWTIMER_LEVELS - 1][SWTIMER_LEVELN_SIZE];
+static uint64_t level0_map = 0;			//Bit i à 1 si l'alvéole i du niveau 0 est non vide
+static uint32_t wheel_time = 0;			//[ms] date de la prochaine alvéole du niveau 0 à traiter
+static volatile uint32_t next_check = 0;	//[ms] date avant laquelle l'IT n'a rien à faire
+static volatile uint32_t armed_count = 0;	//Nombre de timers dans la roue
+static uint32_t upper_count = 0;			//Nombre de timers dans les niveaux supérieurs
+static swtimer_t * deferred_head = NULL;
+static swtimer_t * deferred_tail = NULL;
+
+/* Private functions definitions ---------------------------------------------*/
+
+/**
+ * @brief Range un timer dans la roue selon sa date d'échéance
+ * @pre expiry >= wheel_time, IT masquées
+ */
+static void SWTIMER_link(swtimer_t * timer)
+{
+	uint32_t delta = timer->expiry - wheel_time;
+	uint32_t expiry = timer->expiry;
+	swtimer_t ** head;
+	uint32_t index;
+	uint8_t l;
+
+	if(delta < SWTIMER_LEVEL0_SIZE)
+	{
+		index = expiry & SWTIMER_LEVEL0_MASK;
+		head = &level0[index];
+		level0_map |= (uint64_t)1 << index;
+		timer->level = 0;
+	}
+	else
+	{
+		for(l = 1; l < SWTIMER_LEVELS - 1 && delta >= ((uint32_t)1 << SWTIMER_SHIFT(l + 1)); l++);
+		if(delta >= SWTIMER_RANGE)
+			expiry = wheel_time + SWTIMER_RANGE - 1;
+		head = &leveln[l - 1][(expiry >> SWTIMER_SHIFT(l)) & SWTIMER_LEVELN_MASK];
+		timer->level = l;
+		upper_count++;
+	}
+
+	timer->next = *head;
+	if(*head)
+		(*head)->pprev = &timer->next;
+	*head = timer;
+	timer->pprev = head;
+	armed_count++;
+}
+
+/**
+ * @brief Retire un timer de la roue
+ * @pre le timer est dans la roue, IT masquées
+ */
+static void SWTIMER_unlink(swtimer_t * timer)
+{
+	uint32_t index;
+
+	*timer->pprev = timer->next;
+	if(timer->next)
+		timer->next->pprev = timer->pprev;
+	timer->pprev = NULL;
+	timer->next = NULL;
+
+	if(timer->level == 0)
+	{
+		index = timer->expiry & SWTIMER_LEVEL0_MASK;
+		if(!level0[index])
+			level0_map &= ~((uint64_t)1 << index);
+	}
+	else
+		upper_count--;
+	armed_count--;
+}
+
+/**
+ * @brief Calcule la date à laquelle l'IT aura quelque chose à faire
+ */
+static void SWTIMER_update_next_check(void)
+{
+	uint32_t index = wheel_time & SWTIMER_LEVEL0_MASK;
+	uint64_t ahead = level0_map >> index;
+
+	if(index == 0 && upper_count)
+		next_check = wheel_time;	//Début de tour pas encore traité : redistribution à faire
+	else if(ahead)
+		next_check = wheel_time + (uint32_t)__builtin_ctzll(ahead);
+	else if(!upper_count && level0_map)	//Rien à redistribuer : on peut passer directement au tour suivant
+		next_check = wheel_time + (SWTIMER_LEVEL0_SIZE - index) + (uint32_t)__builtin_ctzll(level0_map);
+	else
+		next_check = (wheel_time | SWTIMER_LEVEL0_MASK) + 1;	//Fin du tour : redistribution des niveaux supérieurs
+}
+
+/**
+ * @brief Redistribue l'alvéole courante des niveaux supérieurs, au début d'un tour du niveau 0
+ */
+static void SWTIMER_cascade(void)
+{
+	swtimer_t * timer;
+	swtimer_t * next;
+	uint32_t index;
+	uint8_t l;
+
+	for(l = 1; l < SWTIMER_LEVELS; l++)
+	{
+		index = (wheel_time >> SWTIMER_SHIFT(l)) & SWTIMER_LEVELN_MASK;
+		timer = leveln[l - 1][index];
+		leveln[l - 1][index] = NULL;
+		while(timer)
+		{
+			next = timer->next;
+			timer->pprev = NULL;
+			upper_count--;
+			armed_count--;
+			SWTIMER_link(timer);
+			timer = next;
+		}
+		if(index)	//Le niveau l n'a pas fini son tour : rien à redistribuer au-dessus
+			break;
+	}
+}
+
+/**
+ * @brief Traite l'échéance d'un timer qui vient d'être retiré de la roue
+ */
+static void SWTIMER_expire(swtimer_t * timer)
+{
+	if(timer->period)
+	{
+		timer->expiry += timer->period;		//Pas de dérive : la prochaine échéance ne dépend pas du retard de traitement
+		SWTIMER_link(timer);
+	}
+	else
+		timer->running = false;
+
+	if(!timer->callback)
+		return;
+	if(timer->dispatch == SWTIMER_DISPATCH_IT)
+	{
+		timer->callback();
+		return;
+	}
+
+	if(timer->pending < UINT16_MAX)
+		timer->pending++;
+	if(!timer->queued)
+	{
+		timer->queued = true;
+		timer->next_deferred = NULL;
+		if(deferred_tail)
+			deferred_tail->next_deferred = timer;
+		else
+			deferred_head = timer;
+		deferred_tail = timer;
+	}
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Initialise un timer (arrêté)
+ *
+ * @param timer		structure du timer, qui doit rester valide tant que le timer est utilisé
+ * @param callback	fonction appelée à chaque échéance (NULL si inutile)
+ * @param dispatch	contexte d'appel de la fonction de callback
+ * @pre La structure est une variable statique ou globale (donc mise à zéro au démarrage), ou un timer arrêté
+ */
+void BSP_SWTIMER_init(swtimer_t * timer, callback_fun_t callback, swtimer_dispatch_t dispatch)
+{
+	BSP_SWTIMER_stop(timer);
+	timer->callback = callback;
+	timer->dispatch = dispatch;
+	timer->overruns = 0;
+}
+
+/**
+ * @brief Arme (ou réarme) un timer
+ *
+ * @param delay_ms	délai avant la première échéance (au moins 1ms)
+ * @param period_ms	période des échéances suivantes, 0 pour un timer simple
+ * @note Utilisable en IT, y compris depuis la fonction de callback du timer lui-même.
+ */
+void BSP_SWTIMER_start(swtimer_t * timer, uint32_t delay_ms, uint32_t period_ms)
+{
+	uint32_t primask;
+
+	if(delay_ms == 0)
+		delay_ms = 1;	//La milliseconde courante a peut-être déjà été traitée
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	if(timer->pprev)
+		SWTIMER_unlink(timer);
+	if(!armed_count)
+		wheel_time = HAL_GetTick();		//Roue vide : on la recale sur la date courante
+	timer->expiry = HAL_GetTick() + delay_ms;
+	timer->period = period_ms;
+	timer->running = true;
+	SWTIMER_link(timer);
+	SWTIMER_update_next_check();
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief Arrête un timer. Une échéance déjà survenue mais pas encore traitée par BSP_SWTIMER_process_main() est annulée.
+ */
+void BSP_SWTIMER_stop(swtimer_t * timer)
+{
+	uint32_t primask;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	if(timer->pprev)
+	{
+		SWTIMER_unlink(timer);
+		SWTIMER_update_next_check();
+	}
+	timer->running = false;
+	timer->pending = 0;		//Le timer reste éventuellement dans la file différée, il y sera ignoré
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief Indique si un timer est armé (un timer simple cesse de l'être à son échéance)
+ */
+bool BSP_SWTIMER_is_running(const swtimer_t * timer)
+{
+	return timer->running;
+}
+
+/**
+ * @brief Appelle les fonctions de callback des timers SWTIMER_DISPATCH_MAIN échus. À appeler dans la boucle principale.
+ * @note Si la boucle principale n'a pas suivi, plusieurs échéances d'un même timer ne donnent lieu qu'à un appel (cf. overruns).
+ */
+void BSP_SWTIMER_process_main(void)
+{
+	swtimer_t * timer;
+	uint16_t pending;
+	uint32_t primask;
+
+	while(deferred_head)
+	{
+		IRQSTAT_IRQ_DISABLE(primask);
+		timer = deferred_head;
+		deferred_head = timer->next_deferred;
+		if(!deferred_head)
+			deferred_tail = NULL;
+		timer->queued = false;
+		pending = timer->pending;
+		timer->pending = 0;
+		IRQSTAT_IRQ_RESTORE(primask);
+
+		if(pending)
+		{
+			timer->overruns += (uint16_t)(pending - 1);
+			timer->callback();
+		}
+	}
+}
+
+/**
+ * @brief Délai pendant lequel ni l'IT SysTick ni BSP_SWTIMER_process_main() n'auront rien à faire (repos sans tick)
+ * @return [ms] 0 si un callback différé attend déjà, UINT32_MAX si aucun timer n'est armé
+ * @pre IT masquées
+ */
+uint32_t BSP_SWTIMER_get_idle_ms(void)
+{
+	int32_t delta;
+
+	if(deferred_head)
+		return 0;
+	if(!armed_count)
+		return UINT32_MAX;
+	delta = (int32_t)(next_check - HAL_GetTick());
+	return (delta > 0) ? (uint32_t)delta : 0;
+}
+
+/**
+ * @brief Avance la roue et traite les échéances. Appelée par SysTick_Handler(), juste après HAL_IncTick().
+ */
+void BSP_SWTIMER_process_it(void)
+{
+	uint32_t now = HAL_GetTick();
+	uint32_t index;
+
+	if(!armed_count || (int32_t)(now - next_check) < 0)
+		return;		//Rien d'échu : cas le plus fréquent
+
+	while(armed_count && (int32_t)(now - next_check) >= 0)
+	{
+		wheel_time = next_check;	//Les alvéoles sautées sont vides
+		if((wheel_time & SWTIMER_LEVEL0_MASK) == 0)
+			SWTIMER_cascade();
+
+		index = wheel_time & SWTIMER_LEVEL0_MASK;
+		while(level0[index])
+		{
+			swtimer_t * timer = level0[index];
+			SWTIMER_unlink(timer);
+			SWTIMER_expire(timer);
+		}
+
+		wheel_time++;
+		SWTIMER_update_next_check();
+	}
+}
@@ -0,0 +1,62 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_swtimer.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Timers logiciels (simples ou périodiques) rangés dans une roue
+ * 			hiérarchique, cadencée par l'interruption SysTick.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_SWTIMER_H_
+#define BSP_STM32G4_SWTIMER_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_utils.h"
+
+/* Public types --------------------------------------------------------------*/
+/**
+ * @brief Contexte d'appel de la fonction de callback à l'échéance d'un timer
+ */
+typedef enum
+{
+	SWTIMER_DISPATCH_IT = 0,	//Appel direct dans l'interruption SysTick : callback très court !
+	SWTIMER_DISPATCH_MAIN		//Appel différé par BSP_SWTIMER_process_main(), depuis la boucle principale
+}swtimer_dispatch_t;
+
+/**
+ * @brief Timer logiciel. La structure appartient à l'appelant (variable statique ou globale) : la roue ne fait que la chaîner.
+ * @note Une structure mise à zéro (variable statique) est un timer valide, sans callback : on se contente alors de BSP_SWTIMER_is_running().
+ */
+typedef struct swtimer_s
+{
+	struct swtimer_s * next;			//Chaînage dans une alvéole de la roue
+	struct swtimer_s ** pprev;			//Adresse du pointeur qui désigne ce timer (NULL si le timer n'est pas dans la roue)
+	struct swtimer_s * next_deferred;	//Chaînage dans la file des callbacks différés
+	uint32_t expiry;					//[ms] date d'échéance (référence HAL_GetTick)
+	uint32_t period;					//[ms] 0 pour un timer simple
+	callback_fun_t callback;
+	swtimer_dispatch_t dispatch;
+	uint8_t level;						//Niveau de la roue dans lequel le timer est rangé
+	bool queued;						//Présent dans la file des callbacks différés
+	volatile bool running;
+	volatile uint16_t pending;			//Échéances pas encore traitées par BSP_SWTIMER_process_main()
+	uint16_t overruns;					//Échéances périodiques fusionnées car la boucle principale n'a pas suivi
+}swtimer_t;
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_SWTIMER_init(swtimer_t * timer, callback_fun_t callback, swtimer_dispatch_t dispatch);
+
+void BSP_SWTIMER_start(swtimer_t * timer, uint32_t delay_ms, uint32_t period_ms);
+
+void BSP_SWTIMER_stop(swtimer_t * timer);
+
+bool BSP_SWTIMER_is_running(const swtimer_t * timer);
+
+void BSP_SWTIMER_process_main(void);
+
+void BSP_SWTIMER_process_it(void);
+
+uint32_t BSP_SWTIMER_get_idle_ms(void);
+
+#endif /* BSP_STM32G4_SWTIMER_H_ */
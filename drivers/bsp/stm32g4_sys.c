@@ -10,6 +10,7 @@
 
 #include "stm32g4_sys.h"
 #include "stm32g4_uart.h"
+#include "stm32g4_timebase.h"
 #include <errno.h>
 #include <sys/unistd.h>
 #include <stdio.h>
@@ -62,6 +63,11 @@ void HAL_MspInit(void)
   /* Configure the system clock */
   SystemClock_Config();
 
+#if USE_TIMEBASE
+  /* Microsecond timebase (TIM2) started once, here : reading the time is then a mere register load */
+  BSP_TIMEBASE_init();
+#endif
+
   /* System interrupt init*/
 
 
@@ -156,31 +162,28 @@ int _read(int file, char *ptr, int len)
  */
 int _write(int file, char *ptr, int len)
 {
+#if TRACE
 	int n;
+#endif
 	switch (file) {
 		case STDOUT_FILENO: /*stdout*/
-			//UART_puts(stdout_usart,ptr, len);
-
-			for (n = 0; n < len; n++)
-			{
 #if TRACE
+			for (n = 0; n < len; n++)
 				trace_putchar(*ptr++);
 #else
-				BSP_UART_putc(stdout_usart,*ptr++);
+			//Recopie en un seul bloc dans le buffer d'émission (len > 0 : sinon BSP_UART_puts ferait un strlen)
+			if(len > 0)
+				BSP_UART_puts(stdout_usart, (uint8_t *)ptr, (uint16_t)len);
 #endif
-			}
 			break;
 		case STDERR_FILENO: /* stderr */
-			for (n = 0; n < len; n++)
-			{
-				//while ((stderr_usart->SR & USART_FLAG_TC) == (uint16_t)RESET);
-				//stderr_usart->DR = (*ptr++ & (uint16_t)0x01FF);
 #if TRACE
+			for (n = 0; n < len; n++)
 				trace_putchar(*ptr++);
 #else
-				BSP_UART_putc(stderr_usart,*ptr++);
+			if(len > 0)
+				BSP_UART_puts(stderr_usart, (uint8_t *)ptr, (uint16_t)len);
 #endif
-			}
 			break;
 		default:
 			errno = EBADF;
@@ -197,6 +200,7 @@ void Error_Handler(void)
 {
   /* User can add his own implementation to report the HAL error return state */
   __disable_irq();
+  BSP_UART_flush(stderr_usart);	//On laisse sortir ce qui a été écrit avant l'erreur (vidage par polling)
   while (1)
   {
   }
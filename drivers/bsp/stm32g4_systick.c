@@ -11,6 +11,9 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32g4_systick.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_timebase.h"
+#include "stm32g4_irqstat.h"
 #include "stm32g4xx_hal.h"
 
 /* Private defines -----------------------------------------------------------*/
@@ -86,13 +89,38 @@ bool BSP_systick_remove_callback_function(callback_fun_t func)
 	return false;
 }
 
+/**
+ * @brief Tell whether at least one callback function is registered
+ *
+ * @note The tickless idle (stm32g4_idle.c) keeps SysTick running in that case: these functions expect a call every 1ms
+ */
+bool BSP_systick_has_callback_functions(void)
+{
+	uint8_t i;
+	for(i = 0; i<MAX_CALLBACK_FUNCTION_NB; i++)
+	{
+		if(callback_functions[i])
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Date courante en microsecondes
+ * @note Avec USE_TIMEBASE, simple lecture du compteur de TIM2, sans effet de bord : utilisable en IT
+ * 		 (TIM2 est lancé une fois pour toutes au démarrage, par HAL_Init() -> HAL_MspInit(), cf. stm32g4_sys.c)
+ */
 uint32_t BSP_systick_get_time_us(void)
 {
+#if USE_TIMEBASE
+	return BSP_TIMEBASE_get_us();
+#else
 	uint32_t t_us;
 	static uint32_t previous_t_us = 0;
-	__disable_irq();
+	uint32_t primask;
+	IRQSTAT_IRQ_DISABLE(primask);
 	t_us = HAL_GetTick() * 1000 + 1000 - SysTick->VAL / SYSTEM_CLOCK_MHZ;
-	__enable_irq();
+	IRQSTAT_IRQ_RESTORE(primask);
 
 
 	if(previous_t_us >= t_us)
@@ -100,6 +128,7 @@ uint32_t BSP_systick_get_time_us(void)
 	previous_t_us = t_us ;
 
 	return t_us;
+#endif
 }
 
 
@@ -107,8 +136,10 @@ uint32_t BSP_systick_get_time_us(void)
  * @brief Interrupt function called every 1ms
  *
  */
-void SysTick_Handler(void)
+__RAM_FUNC_CCM void SysTick_Handler(void)
 {
+	//Latence : SysTick (cadencé par HCLK) décompte à partir de LOAD depuis le déclenchement de l'IT
+	IRQSTAT_ISR_ENTER_LATENCY(SYSTICK, SysTick->LOAD - SysTick->VAL);
 	/* Minimum interruption job for SysTick */
 	HAL_IncTick();
 	/* Use of HAL_SYSTICK_IRQHandler() as been discouraged by ST and is not generated anymore by CubeMX */
@@ -123,4 +154,8 @@ void SysTick_Handler(void)
 		if(callback_functions[i])
 			(*callback_functions[i])();		/* Function calls. */
 	}
+
+	/* Software timers (stm32g4_swtimer.c) : a single comparison when nothing is due */
+	BSP_SWTIMER_process_it();
+	IRQSTAT_ISR_EXIT(SYSTICK);
 }
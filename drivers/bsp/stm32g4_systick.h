@@ -23,6 +23,8 @@ bool BSP_systick_add_callback_function(callback_fun_t func);
 
 bool BSP_systick_remove_callback_function(callback_fun_t func);
 
+bool BSP_systick_has_callback_functions(void);
+
 uint32_t BSP_systick_get_time_us(void);
 
 #endif /* BSP_STM32G4_SYSTICK_H_ */
@@ -0,0 +1,175 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_telemetry.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Canal de télémétrie binaire sur UART : trames COBS typées, protégées
+ * 			par un CRC16 calculé par le périphérique CRC.
+ *******************************************************************************
+ */
+
+/*
+ * Plutôt que d'envoyer du texte avec printf (lent à produire sur la cible, lent à analyser sur PC),
+ * on envoie les données brutes dans des trames binaires :
+ *
+ * 		BSP_TELEMETRY_init();	//après BSP_UART_init(TELEMETRY_UART, ...)
+ * 		BSP_TELEMETRY_send(TELEMETRY_CHANNEL_ADC_BLOCK, samples, sizeof(samples));
+ *
+ * 	Avant encodage, une trame est constituée de :
+ * 		[canal][numéro de séquence][charge utile (0 à TELEMETRY_MAX_PAYLOAD octets)][CRC16 LSB][CRC16 MSB]
+ * 	Le CRC16 (CCITT-FALSE : polynôme 0x1021, valeur initiale 0xFFFF) porte sur le canal, la séquence et la charge utile.
+ *
+ * 	La trame est ensuite encodée en COBS (Consistent Overhead Byte Stuffing) : l'encodage ne contient aucun octet nul,
+ * 	ce qui permet de terminer chaque trame par un 0x00. Le décodeur se resynchronise donc au premier 0x00 venu.
+ * 	Le surcoût est d'un octet tous les 254 octets, plus le délimiteur.
+ *
+ * 	L'encodage est fait directement dans le buffer d'émission de l'UART (BSP_UART_tx_reserve), sans buffer intermédiaire.
+ * 	Décodage sur PC : tools/telemetry_decode.c
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_telemetry.h"
+
+#if USE_TELEMETRY
+#include "stm32g4_uart.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4xx_hal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#ifndef TELEMETRY_UART
+	#define TELEMETRY_UART	UART2_ID
+#endif
+
+#define TELEMETRY_HEADER_SIZE	2	//canal + séquence
+#define TELEMETRY_CRC_SIZE		2
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t sequence = 0;
+static uint32_t sent = 0;
+
+/* Private functions definitions ---------------------------------------------*/
+/**
+ * @brief Renvoie l'octet d'indice i de la trame avant encodage, sans la reconstituer en mémoire
+ */
+static inline uint8_t TELEMETRY_frame_byte(uint32_t i, const uint8_t * header, const uint8_t * payload, uint16_t len, uint16_t crc)
+{
+	if(i < TELEMETRY_HEADER_SIZE)
+		return header[i];
+	i -= TELEMETRY_HEADER_SIZE;
+	if(i < len)
+		return payload[i];
+	return (i == len) ? LOWINT(crc) : HIGHINT(crc);
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Initialise le périphérique CRC pour le calcul du CRC16 des trames
+ *
+ * @pre	L'UART TELEMETRY_UART a été initialisé (BSP_UART_init)
+ */
+void BSP_TELEMETRY_init(void)
+{
+	__HAL_RCC_CRC_CLK_ENABLE();
+	CRC->POL = 0x1021;
+	CRC->INIT = 0xFFFF;
+	CRC->CR = CRC_CR_POLYSIZE_0;	//Polynôme sur 16 bits, pas d'inversion des bits en entrée ni en sortie
+}
+
+/**
+ * @brief Envoie une trame de télémétrie. Fonction non blocante tant que le buffer d'émission de l'UART a de la place.
+ *
+ * @param channel	canal indiquant le format de la charge utile
+ * @param payload	charge utile (envoyée telle quelle, little-endian)
+ * @param len		taille de la charge utile (au plus TELEMETRY_MAX_PAYLOAD)
+ * @return false si la trame n'a pas pu être placée dans le buffer d'émission
+ */
+bool BSP_TELEMETRY_send(telemetry_channel_t channel, const void * payload, uint16_t len)
+{
+	const uint8_t * p = (const uint8_t *)payload;
+	uart_tx_reservation_t reservation;
+	uint8_t header[TELEMETRY_HEADER_SIZE];
+	uint16_t crc;
+	uint32_t frame_len;
+	uint32_t encoded_len;
+	uint32_t primask;
+	uint32_t i;
+	uint32_t out;
+	uint32_t code_pos;
+	uint8_t code;
+	uint8_t b;
+
+	if(len > TELEMETRY_MAX_PAYLOAD)
+		return false;
+
+	//Le périphérique CRC est partagé : le calcul ne doit pas être interrompu par un autre envoi (en IT)
+	IRQSTAT_IRQ_DISABLE(primask);
+	header[0] = (uint8_t)channel;
+	header[1] = sequence++;
+	CRC->CR |= CRC_CR_RESET;
+	*(__IO uint8_t *)&CRC->DR = header[0];
+	*(__IO uint8_t *)&CRC->DR = header[1];
+	for(i = 0; i < len; i++)
+		*(__IO uint8_t *)&CRC->DR = p[i];
+	crc = (uint16_t)CRC->DR;
+	IRQSTAT_IRQ_RESTORE(primask);
+
+	//Taille exacte après encodage COBS : un octet de code initial, plus un à chaque bloc de 254 octets non nuls
+	frame_len = TELEMETRY_HEADER_SIZE + len + TELEMETRY_CRC_SIZE;
+	encoded_len = 1 + frame_len;
+	code = 1;
+	for(i = 0; i < frame_len; i++)
+	{
+		if(TELEMETRY_frame_byte(i, header, p, len, crc) == 0)
+			code = 1;
+		else if(++code == 0xFF)
+		{
+			encoded_len++;
+			code = 1;
+		}
+	}
+
+	if(!BSP_UART_tx_reserve(TELEMETRY_UART, encoded_len + 1, &reservation))	//+1 : délimiteur
+		return false;
+
+	//Encodage COBS directement dans le buffer d'émission
+	code_pos = 0;
+	out = 1;
+	code = 1;
+	for(i = 0; i < frame_len; i++)
+	{
+		b = TELEMETRY_frame_byte(i, header, p, len, crc);
+		if(b == 0)
+		{
+			BSP_UART_tx_byte(TELEMETRY_UART, &reservation, code_pos, code);
+			code_pos = out++;
+			code = 1;
+		}
+		else
+		{
+			BSP_UART_tx_byte(TELEMETRY_UART, &reservation, out++, b);
+			if(++code == 0xFF)
+			{
+				BSP_UART_tx_byte(TELEMETRY_UART, &reservation, code_pos, code);
+				code_pos = out++;
+				code = 1;
+			}
+		}
+	}
+	BSP_UART_tx_byte(TELEMETRY_UART, &reservation, code_pos, code);
+	BSP_UART_tx_byte(TELEMETRY_UART, &reservation, out, 0x00);	//Délimiteur de fin de trame
+
+	BSP_UART_tx_commit(TELEMETRY_UART, &reservation);
+	sent++;
+	return true;
+}
+
+/**
+ * @brief Renvoie le nombre de trames placées dans le buffer d'émission depuis le démarrage
+ */
+uint32_t BSP_TELEMETRY_get_sent_count(void)
+{
+	return sent;
+}
+
+#endif /* USE_TELEMETRY */
@@ -0,0 +1,71 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_telemetry.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Canal de télémétrie binaire sur UART : trames COBS typées, protégées
+ * 			par un CRC16 calculé par le périphérique CRC.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_TELEMETRY_H_
+#define BSP_STM32G4_TELEMETRY_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define TELEMETRY_MAX_PAYLOAD	250		//Octets utiles au plus par trame
+
+/* Public types --------------------------------------------------------------*/
+/**
+ * @brief Canaux de télémétrie : ils indiquent au décodeur (tools/telemetry_decode.c) le format de la charge utile
+ */
+typedef enum
+{
+	TELEMETRY_CHANNEL_RAW = 0,			//Octets quelconques, affichés en hexadécimal
+	TELEMETRY_CHANNEL_TEXT,				//Texte (sans '\0' final)
+	TELEMETRY_CHANNEL_LD19_FRAME,		//telemetry_ld19_frame_t
+	TELEMETRY_CHANNEL_ADC_BLOCK,		//Tableau de uint16_t (valeurs brutes 12 bits)
+	TELEMETRY_CHANNEL_GAME_EVENT,		//telemetry_game_event_t
+	TELEMETRY_CHANNEL_USER = 0x80		//Canaux 0x80 à 0xFF libres pour l'application
+}telemetry_channel_t;
+
+/**
+ * @brief Trame lidar LD19 telle qu'envoyée sur TELEMETRY_CHANNEL_LD19_FRAME (little-endian)
+ */
+typedef struct __attribute__((packed))
+{
+	uint16_t timestamp;		//[ms] % 30000
+	uint16_t speed;			//[°/s]
+	uint16_t start_angle;	//[0.01°]
+	uint16_t end_angle;		//[0.01°]
+	struct __attribute__((packed))
+	{
+		uint16_t distance;	//[mm]
+		uint8_t intensity;
+	}point[12];
+}telemetry_ld19_frame_t;
+
+/**
+ * @brief Évènement de jeu envoyé sur TELEMETRY_CHANNEL_GAME_EVENT (little-endian)
+ */
+typedef struct __attribute__((packed))
+{
+	uint32_t tick_ms;		//HAL_GetTick() au moment de l'évènement
+	uint8_t event;			//Code défini par l'application
+	uint8_t state;			//État de la machine à états
+	int32_t value;			//Donnée associée (somme d'argent, numéro de question...)
+}telemetry_game_event_t;
+
+#if USE_TELEMETRY
+/* Public functions declarations ---------------------------------------------*/
+void BSP_TELEMETRY_init(void);
+
+bool BSP_TELEMETRY_send(telemetry_channel_t channel, const void * payload, uint16_t len);
+
+uint32_t BSP_TELEMETRY_get_sent_count(void);
+
+#endif /* USE_TELEMETRY */
+#endif /* BSP_STM32G4_TELEMETRY_H_ */
@@ -0,0 +1,103 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_timebase.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Base de temps en microsecondes : TIM2 (32 bits) compte librement à 1 MHz.
+ *******************************************************************************
+ */
+
+/*
+ * TIM2 est le seul timer 32 bits du g431 : réglé à 1 MHz et sans période (ARR = 0xFFFFFFFF), son compteur
+ * EST la date en microsecondes. Lire l'heure revient à lire TIM2->CNT : pas de masquage des IT, pas de division,
+ * pas de correction de monotonie (contrairement au calcul à partir de HAL_GetTick() et SysTick->VAL).
+ *
+ * 	TIM2 est donc réservé à cette base de temps quand USE_TIMEBASE vaut 1 (BSP_TIMER_run_us(TIMER2_ID...) est refusé).
+ *
+ * 	La date sur 64 bits est étendue à chaque lecture ; un timer logiciel garantit une lecture au moins
+ * 	toutes les 30 minutes, bien avant que le compteur 32 bits ne fasse un tour (~71 minutes).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_timebase.h"
+
+#if USE_TIMEBASE
+#include "stm32g4_swtimer.h"
+#include "stm32g4_irqstat.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TIMEBASE_KEEPALIVE_MS	(30 * 60 * 1000)
+
+/* Private variables ---------------------------------------------------------*/
+static bool initialized = false;
+static uint32_t last_low = 0;
+static uint32_t high = 0;
+static swtimer_t keepalive;
+
+/* Private functions definitions ---------------------------------------------*/
+static void TIMEBASE_keepalive(void)
+{
+	BSP_TIMEBASE_get_us64();
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Lance TIM2 en comptage libre à 1 MHz. Peut être appelée plusieurs fois (les appels suivants sont sans effet).
+ * @note Appelée au démarrage par HAL_MspInit() (stm32g4_sys.c), une fois l'horloge configurée.
+ */
+void BSP_TIMEBASE_init(void)
+{
+	uint32_t freq;
+
+	if(initialized)
+		return;
+
+	//Fréquence des TIMERS 2,3,4 est PCLK1 lorsque APB1 Prescaler vaut 1, sinon : PCLK1*2
+	freq = HAL_RCC_GetPCLK1Freq();
+	if((RCC->CFGR & RCC_CFGR_PPRE1) >> 8 != RCC_HCLK_DIV1)
+		freq *= 2;
+
+	__HAL_RCC_TIM2_CLK_ENABLE();
+	TIM2->CR1 = 0;
+	TIM2->PSC = freq / 1000000 - 1;
+	TIM2->ARR = 0xFFFFFFFF;
+	TIM2->CNT = 0;
+	TIM2->EGR = TIM_EGR_UG;		//Chargement immédiat du prescaler
+	TIM2->SR = 0;
+	TIM2->CR1 = TIM_CR1_CEN;
+
+	BSP_SWTIMER_init(&keepalive, &TIMEBASE_keepalive, SWTIMER_DISPATCH_IT);
+	BSP_SWTIMER_start(&keepalive, TIMEBASE_KEEPALIVE_MS, TIMEBASE_KEEPALIVE_MS);
+	initialized = true;
+}
+
+/**
+ * @brief Date courante en microsecondes sur 64 bits (ne revient jamais à 0). Utilisable en IT.
+ */
+uint64_t BSP_TIMEBASE_get_us64(void)
+{
+	uint32_t primask;
+	uint32_t now;
+	uint64_t ret;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	now = TIM2->CNT;
+	if(now < last_low)
+		high++;		//Le compteur a fait un tour depuis la lecture précédente
+	last_low = now;
+	ret = ((uint64_t)high << 32) | now;
+	IRQSTAT_IRQ_RESTORE(primask);
+	return ret;
+}
+
+/**
+ * @brief Attente active d'au moins us microsecondes (à réserver aux délais très courts)
+ */
+void BSP_TIMEBASE_delay_us(uint32_t us)
+{
+	uint32_t start = BSP_TIMEBASE_get_us();
+	while(!BSP_TIMEBASE_has_elapsed(start, us + 1));	//+1 : la date de départ est peut-être déjà entamée
+}
+
+#endif /* USE_TIMEBASE */
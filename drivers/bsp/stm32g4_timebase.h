@@ -0,0 +1,64 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_timebase.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Base de temps en microsecondes : TIM2 (32 bits) compte librement à 1 MHz.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_TIMEBASE_H_
+#define BSP_STM32G4_TIMEBASE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+#include "stm32g4xx_hal.h"
+
+#if USE_TIMEBASE
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_TIMEBASE_init(void);
+
+uint64_t BSP_TIMEBASE_get_us64(void);
+
+void BSP_TIMEBASE_delay_us(uint32_t us);
+
+/* Inline functions ----------------------------------------------------------*/
+
+/**
+ * @brief Date courante en microsecondes : une simple lecture de registre, utilisable en IT, sans masquage.
+ * @note Revient à 0 toutes les 2^32 us (~71 minutes) : comparer les dates avec les fonctions ci-dessous.
+ * @pre BSP_TIMEBASE_init() a été appelée (sinon renvoie 0)
+ */
+static inline uint32_t BSP_TIMEBASE_get_us(void)
+{
+	return TIM2->CNT;
+}
+
+/**
+ * @brief Indique si la date a est postérieure à la date b (valable pour des dates distantes de moins de ~35 minutes)
+ */
+static inline bool BSP_TIMEBASE_is_after(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) > 0;
+}
+
+/**
+ * @brief Temps écoulé [us] depuis une date relevée avec BSP_TIMEBASE_get_us()
+ */
+static inline uint32_t BSP_TIMEBASE_elapsed_us(uint32_t since)
+{
+	return TIM2->CNT - since;
+}
+
+/**
+ * @brief Indique si au moins duration_us microsecondes se sont écoulées depuis la date since
+ */
+static inline bool BSP_TIMEBASE_has_elapsed(uint32_t since, uint32_t duration_us)
+{
+	return TIM2->CNT - since >= duration_us;
+}
+
+#endif /* USE_TIMEBASE */
+#endif /* BSP_STM32G4_TIMEBASE_H_ */
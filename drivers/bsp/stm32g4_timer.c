@@ -14,6 +14,8 @@
 #include "stm32g4xx_hal_tim.h"
 #include "stm32g4_sys.h"
 #include "stm32g4_gpio.h"
+#include "stm32g4_irqstat.h"
+#include <stdio.h>
 
 #if USE_BSP_TIMER | 1
 
@@ -35,6 +37,16 @@ static TIM_HandleTypeDef structure_handles[TIMER_ID_NB]; //Ce tableau contient l
 static const TIM_TypeDef * instance_array[TIMER_ID_NB] = {TIM1, TIM2, TIM3, TIM4, TIM6};
 static const IRQn_Type nvic_irq_array[TIMER_ID_NB] = {TIM1_UP_TIM16_IRQn, TIM2_IRQn, TIM3_IRQn, TIM4_IRQn, TIM6_DAC_IRQn};
 
+#if USE_IRQSTAT
+static uint32_t cycles_per_tick[TIMER_ID_NB];	//Cycles processeur par impulsion d'horloge du timer
+
+/**
+ * @brief Cycles processeur écoulés depuis le débordement qui a déclenché l'IT (latence de l'IT de mise à jour)
+ */
+#define TIMER_CYCLES_SINCE_UPDATE(timer_id)	\
+	(structure_handles[timer_id].Instance->CNT * (structure_handles[timer_id].Instance->PSC + 1) * cycles_per_tick[timer_id])
+#endif
+
 
 /* Private functions declarations --------------------------------------------*/
 
@@ -81,6 +93,13 @@ void clear_it_status(timer_id_t timer_id){
  */
 void BSP_TIMER_run_us(timer_id_t timer_id, uint32_t us, bool enable_irq)
 {
+#if USE_TIMEBASE
+	if(timer_id == TIMER2_ID)
+	{
+		debug_printf("TIMER2 is used by stm32g4_timebase.c (USE_TIMEBASE), please choose another timer\n");
+		return;
+	}
+#endif
 	// On active l'horloge du timer concerné.
 	switch(timer_id)
 	{
@@ -122,6 +141,10 @@ void BSP_TIMER_run_us(timer_id_t timer_id, uint32_t us, bool enable_irq)
 			freq *= 2;
 	}
 
+#if USE_IRQSTAT
+	cycles_per_tick[timer_id] = MAX(1, SystemCoreClock / freq);
+#endif
+
 	uint64_t nb_psec_per_event = (uint64_t)(1000000000000/freq);
 	uint64_t period = (((uint64_t)(us))*1000000)/nb_psec_per_event;
 
@@ -441,45 +464,54 @@ __weak void TIMER6_user_handler_it(void)
  * @note	Nous n'avons PAS le choix du nom de cette fonction, c'est comme ça qu'elle est nommée dans le fichier startup.s !
  */
 void TIM1_UP_TIM16_IRQHandler(void){
+	IRQSTAT_ISR_ENTER_LATENCY(TIM1, TIMER_CYCLES_SINCE_UPDATE(TIMER1_ID));
 	if(__HAL_TIM_GET_IT_SOURCE(&structure_handles[TIMER1_ID], TIM_IT_UPDATE) != RESET) 	//Si le flag est levé...
 	{
 		__HAL_TIM_CLEAR_IT(&structure_handles[TIMER1_ID], TIM_IT_UPDATE);				//...On l'acquitte...
 		TIMER1_user_handler_it();									//...Et on appelle la fonction qui nous intéresse
 	}
+	IRQSTAT_ISR_EXIT(TIM1);
 }
 
 void TIM2_IRQHandler(void){
+	IRQSTAT_ISR_ENTER_LATENCY(TIM2, TIMER_CYCLES_SINCE_UPDATE(TIMER2_ID));
 	if(__HAL_TIM_GET_IT_SOURCE(&structure_handles[TIMER2_ID], TIM_IT_UPDATE) != RESET) 	//Si le flag est levé...
 	{
 		__HAL_TIM_CLEAR_IT(&structure_handles[TIMER2_ID], TIM_IT_UPDATE);				//...On l'acquitte...
 		TIMER2_user_handler_it();									//...Et on appelle la fonction qui nous intéresse
 	}
+	IRQSTAT_ISR_EXIT(TIM2);
 }
 
 void TIM3_IRQHandler(void){
+	IRQSTAT_ISR_ENTER_LATENCY(TIM3, TIMER_CYCLES_SINCE_UPDATE(TIMER3_ID));
 	if(__HAL_TIM_GET_IT_SOURCE(&structure_handles[TIMER3_ID], TIM_IT_UPDATE) != RESET) 	//Si le flag est levé...
 	{
 		__HAL_TIM_CLEAR_IT(&structure_handles[TIMER3_ID], TIM_IT_UPDATE);				//...On l'acquitte...
 		TIMER3_user_handler_it();									//...Et on appelle la fonction qui nous intéresse
 	}
+	IRQSTAT_ISR_EXIT(TIM3);
 }
 
 void TIM4_IRQHandler(void){
+	IRQSTAT_ISR_ENTER_LATENCY(TIM4, TIMER_CYCLES_SINCE_UPDATE(TIMER4_ID));
 	if(__HAL_TIM_GET_IT_SOURCE(&structure_handles[TIMER4_ID], TIM_IT_UPDATE) != RESET) 	//Si le flag est levé...
 	{
 		__HAL_TIM_CLEAR_IT(&structure_handles[TIMER4_ID], TIM_IT_UPDATE);				//...On l'acquitte...
 		TIMER4_user_handler_it();									//...Et on appelle la fonction qui nous intéresse
 	}
+	IRQSTAT_ISR_EXIT(TIM4);
 }
 
 void TIM6_DAC_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER_LATENCY(TIM6, TIMER_CYCLES_SINCE_UPDATE(TIMER6_ID));
 	if(__HAL_TIM_GET_IT_SOURCE(&structure_handles[TIMER6_ID], TIM_IT_UPDATE) != RESET) 	//Si le flag est levé...
 	{
 		__HAL_TIM_CLEAR_IT(&structure_handles[TIMER6_ID], TIM_IT_UPDATE);				//...On l'acquitte...
 		TIMER6_user_handler_it();									//...Et on appelle la fonction qui nous intéresse
 	}
-
+	IRQSTAT_ISR_EXIT(TIM6);
 }
 
 #endif /* USE_BSP_TIMER */
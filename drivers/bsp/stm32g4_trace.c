@@ -0,0 +1,168 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_trace.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Enregistreur de trace : évènements datés (8 octets) dans un buffer circulaire en RAM,
+ * 			écrits en quelques instructions depuis les IT comme depuis les tâches.
+ *******************************************************************************
+ */
+
+/*
+ * Chronologie des interactions entre IT, transferts SPI (écran), rafales UART et machines à états,
+ * sans analyseur logique :
+ *
+ * 		BSP_TRACE_start();					//Enregistrement en continu : le buffer garde les TRACE_BUFFER_SIZE derniers évènements
+ * 		...
+ * 		if(latence_anormale)
+ * 			BSP_TRACE_trigger(100);			//On fige le buffer 100 évènements plus tard (ou BSP_TRACE_stop())
+ * 		...
+ * 		BSP_TRACE_dump();					//Écriture sur la sortie standard (UART)
+ *
+ * 	Évènements enregistrés automatiquement quand USE_TRACE vaut 1 :
+ * 		- entrée et sortie des routines instrumentées par IRQSTAT_ISR_ENTER / IRQSTAT_ISR_EXIT,
+ * 		- transactions SPI de l'écran, de la dalle tactile et de la carte SD (chip select),
+ * 		- rafales de réception UART (début au premier octet, fin au dernier octet avant TRACE_UART_GAP_US de silence),
+ * 		- changements d'état de la machine à états du jeu (TRACE_STATE).
+ *
+ * 	Les dates sont lues dans DWT->CYCCNT (un tour en ~25 s à 170 MHz) : le convertisseur PC
+ * 	tools/trace_to_chrome.c les déroule et produit un fichier JSON lisible par chrome://tracing ou ui.perfetto.dev.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_trace.h"
+
+#if USE_TRACE
+#include "stm32g4_irqstat.h"
+#include "stm32g4_systick.h"
+#include "stm32g4_uart.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+	#error "TRACE_BUFFER_SIZE doit être une puissance de 2"
+#endif
+
+#define TRACE_NEVER				0x80000000u		//trace_stop_index - trace_index : pas de fin programmée
+#define TRACE_UART_GAP_CYCLES	(TRACE_UART_GAP_US * SYSTEM_CLOCK_MHZ)
+#define TRACE_UART_COUNT_MAX	0x0FFF
+
+#define TRACE_SOURCE_NAME(name)	#name,
+
+/* Public variables ----------------------------------------------------------*/
+trace_event_t trace_buffer[TRACE_BUFFER_SIZE];
+uint32_t trace_index = 0;
+uint32_t trace_stop_index = TRACE_NEVER;
+volatile bool trace_running = false;
+
+/* Private variables ---------------------------------------------------------*/
+static const char * const source_names[IRQSTAT_SOURCE_NB] = { IRQSTAT_SOURCES_LIST(TRACE_SOURCE_NAME) };
+static uint32_t uart_last_byte[UART_ID_NB];		//Date du dernier octet reçu
+static uint16_t uart_burst_count[UART_ID_NB];	//Octets de la rafale en cours, 0 si aucune
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Vide le buffer et lance l'enregistrement en continu
+ */
+void BSP_TRACE_start(void)
+{
+	uint8_t i;
+
+	trace_running = false;
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	for(i = 0; i < UART_ID_NB; i++)
+		uart_burst_count[i] = 0;
+	trace_index = 0;
+	trace_stop_index = TRACE_NEVER;
+	trace_running = true;
+}
+
+/**
+ * @brief Fige le buffer. Les rafales UART en cours sont closes à leur dernier octet.
+ */
+void BSP_TRACE_stop(void)
+{
+	uint32_t primask;
+	uint8_t i;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	for(i = 0; i < UART_ID_NB; i++)
+	{
+		if(uart_burst_count[i])
+			BSP_TRACE_record_at(uart_last_byte[i], TRACE_UART_RX_END, (uint16_t)(i | (uart_burst_count[i] << 4)));
+		uart_burst_count[i] = 0;
+	}
+	trace_running = false;
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief Fige le buffer après post_events évènements supplémentaires : le buffer contiendra
+ * 		  ce qui a précédé le déclenchement et ce qui l'a suivi. Utilisable en IT.
+ */
+void BSP_TRACE_trigger(uint32_t post_events)
+{
+	uint32_t primask;
+
+	IRQSTAT_IRQ_DISABLE(primask);
+	if(trace_running && trace_stop_index - trace_index >= TRACE_NEVER)
+		trace_stop_index = trace_index + post_events;
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief Découpe la réception en rafales. Appelée par l'IT de réception UART à chaque octet.
+ */
+void BSP_TRACE_uart_rx_byte(uint8_t uart_id)
+{
+	uint32_t now = DWT->CYCCNT;
+
+	if(!trace_running || uart_id >= UART_ID_NB)
+		return;
+	if(uart_burst_count[uart_id] && now - uart_last_byte[uart_id] > TRACE_UART_GAP_CYCLES)
+	{
+		BSP_TRACE_record_at(uart_last_byte[uart_id], TRACE_UART_RX_END, (uint16_t)(uart_id | (uart_burst_count[uart_id] << 4)));
+		uart_burst_count[uart_id] = 0;
+	}
+	if(uart_burst_count[uart_id] == 0)
+		BSP_TRACE_record_at(now, TRACE_UART_RX_BEGIN, uart_id);
+	if(uart_burst_count[uart_id] < TRACE_UART_COUNT_MAX)
+		uart_burst_count[uart_id]++;
+	uart_last_byte[uart_id] = now;
+}
+
+/**
+ * @brief Fige le buffer et l'écrit sur la sortie standard, du plus ancien au plus récent évènement,
+ * 		  dans le format lu par tools/trace_to_chrome.c :
+ * 		TRACE <MHz> <nombre d'évènements> <évènements écrasés>
+ * 		SRC <id> <nom>						(routines d'interruption)
+ * 		E <date en hexadécimal> <id> <arg>
+ * 		END
+ */
+void BSP_TRACE_dump(void)
+{
+	trace_event_t * e;
+	uint32_t first;
+	uint32_t last;
+	uint32_t i;
+
+	BSP_TRACE_stop();
+	last = trace_index;
+	if((int32_t)(last - trace_stop_index) > 0)
+		last = trace_stop_index;		//Réservations refusées après le déclenchement
+	first = (last > TRACE_BUFFER_SIZE) ? last - TRACE_BUFFER_SIZE : 0;
+
+	printf("TRACE %d %lu %lu\n", SYSTEM_CLOCK_MHZ, (unsigned long)(last - first), (unsigned long)first);
+	for(i = 0; i < IRQSTAT_SOURCE_NB; i++)
+		printf("SRC %lu %s\n", (unsigned long)i, source_names[i]);
+	for(i = first; i != last; i++)
+	{
+		e = &trace_buffer[i & (TRACE_BUFFER_SIZE - 1)];
+		printf("E %08lx %u %u\n", (unsigned long)e->timestamp, e->id, e->arg);
+	}
+	printf("END\n");
+}
+
+#endif /* USE_TRACE */
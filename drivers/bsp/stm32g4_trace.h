@@ -0,0 +1,119 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_trace.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Enregistreur de trace : évènements datés (8 octets) dans un buffer circulaire en RAM,
+ * 			écrits en quelques instructions depuis les IT comme depuis les tâches.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_TRACE_H_
+#define BSP_STM32G4_TRACE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef TRACE_BUFFER_SIZE
+	#define TRACE_BUFFER_SIZE	512			//Évènements conservés (puissance de 2) : 4 Ko
+#endif
+
+#define TRACE_UART_GAP_US		200			//Silence séparant deux rafales de réception UART (~2 octets à 115200 bauds)
+
+/* Public types --------------------------------------------------------------*/
+typedef enum
+{
+	TRACE_ISR_ENTER = 1,		//arg : irqstat_source_id_t (IRQSTAT_ISR_ENTER, cf. stm32g4_irqstat.h)
+	TRACE_ISR_EXIT,				//arg : irqstat_source_id_t
+	TRACE_SPI_BEGIN,			//arg : trace_spi_device_t (début de transaction : chip select actif)
+	TRACE_SPI_END,				//arg : trace_spi_device_t
+	TRACE_UART_RX_BEGIN,		//arg : uart_id_t (premier octet d'une rafale)
+	TRACE_UART_RX_END,			//arg : uart_id_t | nombre d'octets de la rafale << 4 (dernier octet de la rafale)
+	TRACE_STATE,				//arg : machine à états << 8 | nouvel état
+	TRACE_USER					//Premier identifiant libre pour l'application
+}trace_event_id_t;
+
+typedef enum
+{
+	TRACE_SPI_ILI9341 = 0,
+	TRACE_SPI_XPT2046,
+	TRACE_SPI_SD
+}trace_spi_device_t;
+
+typedef struct
+{
+	uint32_t timestamp;			//[cycles] DWT->CYCCNT
+	uint16_t id;				//trace_event_id_t
+	uint16_t arg;
+}trace_event_t;
+
+#if USE_TRACE
+#include "stm32g4xx_hal.h"
+
+/* Public variables (utilisées par les fonctions inline) ---------------------*/
+extern trace_event_t trace_buffer[TRACE_BUFFER_SIZE];
+extern uint32_t trace_index;
+extern uint32_t trace_stop_index;
+extern volatile bool trace_running;
+
+/* Inline functions ----------------------------------------------------------*/
+
+/**
+ * @brief Enregistre un évènement daté de timestamp. Utilisable en IT, sans masquage.
+ * @note Réservation de l'emplacement par LDREX/STREX : une IT qui survient pendant l'écriture prend l'emplacement suivant.
+ */
+static inline void BSP_TRACE_record_at(uint32_t timestamp, uint16_t id, uint16_t arg)
+{
+	trace_event_t * e;
+	uint32_t i;
+
+	if(!trace_running)
+		return;
+	i = __atomic_fetch_add(&trace_index, 1, __ATOMIC_RELAXED);
+	if((int32_t)(i - trace_stop_index) >= 0)
+	{
+		trace_running = false;		//Fin de l'enregistrement après un déclenchement (BSP_TRACE_trigger)
+		return;
+	}
+	e = &trace_buffer[i & (TRACE_BUFFER_SIZE - 1)];
+	e->timestamp = timestamp;
+	e->id = id;
+	e->arg = arg;
+}
+
+/**
+ * @brief Enregistre un évènement daté de maintenant
+ */
+static inline void BSP_TRACE_record(uint16_t id, uint16_t arg)
+{
+	BSP_TRACE_record_at(DWT->CYCCNT, id, arg);
+}
+
+/**
+ * @brief Enregistre un évènement (sans effet quand USE_TRACE vaut 0)
+ */
+#define TRACE_RECORD(id, arg)	BSP_TRACE_record((id), (arg))
+
+/* Public functions declarations ---------------------------------------------*/
+void BSP_TRACE_start(void);
+
+void BSP_TRACE_stop(void);
+
+void BSP_TRACE_trigger(uint32_t post_events);
+
+void BSP_TRACE_uart_rx_byte(uint8_t uart_id);
+
+void BSP_TRACE_dump(void);
+
+#else
+	#define TRACE_RECORD(id, arg)			do { (void)(id); (void)(arg); } while(0)
+	#define BSP_TRACE_start()				(void)0
+	#define BSP_TRACE_stop()				(void)0
+	#define BSP_TRACE_trigger(post_events)	(void)0
+	#define BSP_TRACE_uart_rx_byte(uart_id)	(void)0
+	#define BSP_TRACE_dump()				(void)0
+#endif /* USE_TRACE */
+
+#endif /* BSP_STM32G4_TRACE_H_ */
@@ -13,6 +13,9 @@
 #include "stm32g4_sys.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_utils.h"
+#include "stm32g4_irqstat.h"
+#include "stm32g4_ring.h"
+#include "stm32g4_trace.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -44,6 +47,10 @@
  *
  * 	1-> Appeler la fonction BSP_UART_init(UART1_ID, 115200);
  * 	2-> Pour envoyer un octet 'A' sur l'UART1 : BSP_UART_putc(UART1_ID, 'A');
+ * 		L'octet est simplement recopié dans un buffer d'émission (BUFFER_TX_SIZE), vidé en tâche de fond par l'interruption TXE.
+ * 		Le programme n'attend donc pas la fin de l'envoi. Lorsque ce buffer est plein, le comportement est choisi avec
+ * 		BSP_UART_set_tx_policy() : attendre (par défaut), perdre les nouveaux octets, ou écraser les plus anciens.
+ * 		BSP_UART_flush() attend que tout soit réellement envoyé (utilisable en interruption, par exemple dans un fault handler).
  * 	3-> Pour recevoir les octets qui auraient été reçus par l'UART1 :
  * 			if(BSP_UART_data_ready(UART1_ID))
  * 			{
@@ -53,7 +60,9 @@
  * 			}
  * 		Les octets reçus par les périphériques UART initialisés sont traités dans une routine d'interruption, puis mémorisés dans un tableau (que l'on nomme un buffer),
  * 		jusqu'à l'appel à la fonction UART_get_next_byte().
- * 		Ce tableau peut mémoriser 128 octets. (BUFFER_RX_SIZE)
+ * 		Ce tableau peut mémoriser 128 octets. (BUFFER_RX_SIZE, réglable pour chaque UART dans config.h)
+ * 		S'il est plein, les nouveaux octets sont perdus (les données non lues ne sont jamais écrasées) et comptabilisés :
+ * 		BSP_UART_get_stats() renseigne les octets reçus, perdus, les erreurs matérielles et le remplissage maximal atteint.
  * 		Cette méthode permet au processeur de ne pas louper des données arrivant sur ce périphérique pendant qu'il est occupé à autre chose dans le programme.
  * 		Il est simplement interrompu très brièvement pour conserver l'octet reçu, et remettre à plus tard son traitement.
  *
@@ -70,21 +79,69 @@
 
 //Les buffers de réception accumulent les données reçues, dans la limite de leur taille.
 //Les emplacement occupés par les octets reçus sont libérés dès qu'on les consulte.
+//La taille de chaque buffer peut être choisie dans config.h (UART1_RX_BUFFER_SIZE, UART2_RX_BUFFER_SIZE), c'est une puissance de 2.
+//Ce sont des files SPSC (stm32g4_ring.h) : l'IT de réception produit, le lecteur consomme, sans section critique.
 #define BUFFER_RX_SIZE	128
+#ifndef UART1_RX_BUFFER_SIZE
+	#define UART1_RX_BUFFER_SIZE	BUFFER_RX_SIZE
+#endif
+#ifndef UART2_RX_BUFFER_SIZE
+	#define UART2_RX_BUFFER_SIZE	BUFFER_RX_SIZE
+#endif
+#if !RING_IS_POWER_OF_2(UART1_RX_BUFFER_SIZE) || !RING_IS_POWER_OF_2(UART2_RX_BUFFER_SIZE)
+	#error "UART1_RX_BUFFER_SIZE et UART2_RX_BUFFER_SIZE doivent être des puissances de 2"
+#endif
 #define UART_TIMEOUT 1000
 
+//Les buffers d'émission accumulent les octets à envoyer. Ils sont vidés en tâche de fond par l'interruption TXE.
+//Leur taille doit être une puissance de 2 (les index sont masqués plutôt que calculés modulo).
+#ifndef BUFFER_TX_SIZE
+	#define BUFFER_TX_SIZE	512
+#endif
+#if (BUFFER_TX_SIZE & (BUFFER_TX_SIZE - 1)) != 0
+	#error "BUFFER_TX_SIZE doit être une puissance de 2"
+#endif
+#define BUFFER_TX_MASK	(BUFFER_TX_SIZE - 1)
+
+#ifndef UART_TX_POLICY_DEFAULT
+	#define UART_TX_POLICY_DEFAULT	UART_TX_POLICY_BLOCK
+#endif
+
 static UART_HandleTypeDef structure_handles[UART_ID_NB];	//Ce tableau contient les structures qui sont utilisées pour piloter chaque UART avec la librairie HAL.
 static const USART_TypeDef * instances_array[UART_ID_NB] = {USART1, USART2};
 static const IRQn_Type nvic_IRQ_array[UART_ID_NB] = {USART1_IRQn, USART2_IRQn};
 
 //Buffers
-static uint8_t buffer_rx[UART_ID_NB][BUFFER_RX_SIZE];
-static uint8_t buffer_rx_write_index[UART_ID_NB] = {0};
-static uint32_t buffer_rx_read_index[UART_ID_NB] = {0};
-static volatile bool buffer_rx_data_ready[UART_ID_NB] = {false};
+static uint8_t buffer_rx_uart1[UART1_RX_BUFFER_SIZE];
+static uint8_t buffer_rx_uart2[UART2_RX_BUFFER_SIZE];
+static uint8_t * const buffer_rx[UART_ID_NB] = {buffer_rx_uart1, buffer_rx_uart2};
+static const uint32_t buffer_rx_size[UART_ID_NB] = {UART1_RX_BUFFER_SIZE, UART2_RX_BUFFER_SIZE};
+RING_DEFINE(uart_rx_ring, uint8_t)
+static uart_rx_ring_t rx_ring[UART_ID_NB];							//Files sur buffer_rx
+static uint8_t rx_byte[UART_ID_NB];									//Octet en cours de réception par le module HAL
+static uart_stats_t uart_stats[UART_ID_NB];
 static volatile bool uart_initialized[UART_ID_NB] = {false};
 static callback_fun_t callback_uart_rx[UART_ID_NB] = {NULL};
 
+//Buffers d'émission : les index tournent librement sur 32 bits, l'IT TXE avance read_index.
+//Un écrivain réserve d'abord une zone (reserve_index), la remplit hors section critique, puis la valide.
+//write_index (limite de ce que l'IT TXE peut envoyer) ne rattrape reserve_index que lorsque plus aucune réservation n'est en cours :
+//un écrivain préempté par un autre (en IT) ne voit donc jamais sa zone envoyée à moitié remplie.
+static uint8_t buffer_tx[UART_ID_NB][BUFFER_TX_SIZE];
+static volatile uint32_t buffer_tx_write_index[UART_ID_NB] = {0};
+static volatile uint32_t buffer_tx_reserve_index[UART_ID_NB] = {0};
+static volatile uint32_t buffer_tx_read_index[UART_ID_NB] = {0};
+static volatile uint32_t buffer_tx_pending[UART_ID_NB] = {0};
+static uart_tx_policy_t tx_policy[UART_ID_NB] = {UART_TX_POLICY_DEFAULT, UART_TX_POLICY_DEFAULT};
+
+/* Private functions declarations --------------------------------------------*/
+static bool UART_in_interrupt_context(void);
+static bool UART_tx_poll_one(uart_id_t uart_id);
+static void UART_tx_publish(uart_id_t uart_id);
+static void UART_tx_write(uart_id_t uart_id, const uint8_t * datas, uint32_t len);
+static void UART_tx_process_it(uart_id_t uart_id);
+static uart_id_t UART_get_id(UART_HandleTypeDef *huart);
+
 /**
  * @brief Cette fonction blocante a pour but de vous aider à appréhender les fonctionnalités de ce module logiciel.
  *
@@ -128,7 +185,7 @@ void BSP_UART_demo(void)
 bool BSP_UART_data_ready(uart_id_t uart_id)
 {
 	assert(uart_id < UART_ID_NB);
-	return buffer_rx_data_ready[uart_id];
+	return !uart_rx_ring_is_empty(&rx_ring[uart_id]);
 }
 
 /**
@@ -164,17 +221,8 @@ uint8_t BSP_UART_get_next_byte(uart_id_t uart_id)
 	uint8_t ret;
 	assert(uart_id < UART_ID_NB);
 
-	if(!buffer_rx_data_ready[uart_id])	//N'est jamais sensé se produire si l'utilisateur vérifie que BSP_UART_data_ready() avant d'appeler UART_get_next_byte()
+	if(!uart_rx_ring_pop(&rx_ring[uart_id], &ret))	//N'est jamais sensé se produire si l'utilisateur vérifie que BSP_UART_data_ready() avant d'appeler UART_get_next_byte()
 		return 0;
-
-	ret =  buffer_rx[uart_id][buffer_rx_read_index[uart_id]];
-	buffer_rx_read_index[uart_id] = (buffer_rx_read_index[uart_id] + 1) % BUFFER_RX_SIZE;
-
-	//Section critique durant laquelle on désactive les interruptions... pour éviter une mauvaise préemption.
-	NVIC_DisableIRQ(nvic_IRQ_array[uart_id]);
-	if (buffer_rx_write_index[uart_id] == buffer_rx_read_index[uart_id])
-		buffer_rx_data_ready[uart_id] = false;
-	NVIC_EnableIRQ(nvic_IRQ_array[uart_id]);
 	return ret;
 }
 
@@ -260,56 +308,273 @@ uint32_t BSP_UART_gets(uart_id_t uart_id, uint8_t * datas, uint32_t len)
 }
 
 /**
- * @brief	Envoi un caractere sur l'UARTx. Fonction BLOCANTE si un caractere est deja en cours d'envoi.
+ * @brief	Indique si l'on ne peut pas compter sur l'IT TXE pour vider le buffer d'émission
+ *
+ * C'est le cas si l'on s'exécute en interruption (l'IT UART peut être de priorité inférieure) ou si les IT sont masquées.
+ */
+static bool UART_in_interrupt_context(void)
+{
+	return (__get_IPSR() != 0) || (__get_PRIMASK() != 0);
+}
+
+/**
+ * @brief	Envoie "à la main" le plus ancien octet du buffer d'émission, en attendant que le registre TDR soit libre.
+ * @pre		À n'appeler que lorsque l'IT TXE ne peut pas être servie (contexte d'interruption ou IT masquées).
+ * @return	false s'il n'y avait aucun octet prêt à être envoyé
+ */
+static bool UART_tx_poll_one(uart_id_t uart_id)
+{
+	USART_TypeDef * pusart = structure_handles[uart_id].Instance;
+	bool ret = false;
+	uint32_t primask;
+	IRQSTAT_IRQ_DISABLE(primask);
+	if(buffer_tx_read_index[uart_id] != buffer_tx_write_index[uart_id])
+	{
+		while((pusart->ISR & USART_ISR_TXE) == 0);
+		pusart->TDR = (uint16_t)buffer_tx[uart_id][buffer_tx_read_index[uart_id] & BUFFER_TX_MASK];
+		buffer_tx_read_index[uart_id]++;
+		ret = true;
+	}
+	IRQSTAT_IRQ_RESTORE(primask);
+	return ret;
+}
+
+/**
+ * @brief	Termine une réservation. Si c'était la dernière en cours, tout ce qui a été réservé devient envoyable.
+ * @pre		Les IT sont masquées
+ */
+static void UART_tx_publish(uart_id_t uart_id)
+{
+	buffer_tx_pending[uart_id]--;
+	if(buffer_tx_pending[uart_id] == 0)
+	{
+		buffer_tx_write_index[uart_id] = buffer_tx_reserve_index[uart_id];
+#if USE_IRQSTAT
+		if(!(structure_handles[uart_id].Instance->CR1 & USART_CR1_TXEIE))
+			BSP_IRQSTAT_trigger((uart_id == UART1_ID) ? IRQSTAT_USART1 : IRQSTAT_USART2);	//TXE est déjà levé : l'IT est immédiate
+#endif
+		SET_BIT(structure_handles[uart_id].Instance->CR1, USART_CR1_TXEIE);	//L'IT TXE se chargera de l'envoi
+	}
+}
+
+/**
+ * @brief	Recopie des octets dans le buffer d'émission et lance le vidage en IT.
+ *
+ * Les sections critiques ne durent que le temps de mettre à jour les index (pas d'attente sur le périphérique).
+ * Lorsque le buffer est plein, la politique choisie via BSP_UART_set_tx_policy() s'applique.
+ */
+static void UART_tx_write(uart_id_t uart_id, const uint8_t * datas, uint32_t len)
+{
+	uint32_t primask;
+	uint32_t free;
+	uint32_t start;
+	uint32_t n;
+	uint32_t i;
+
+	while(len)
+	{
+		IRQSTAT_IRQ_DISABLE(primask);
+		free = BUFFER_TX_SIZE - (buffer_tx_reserve_index[uart_id] - buffer_tx_read_index[uart_id]);
+		if(free == 0)
+		{
+			switch(tx_policy[uart_id])
+			{
+				case UART_TX_POLICY_OVERWRITE:
+					//On sacrifie les octets les plus anciens (seulement ceux déjà validés) pour faire de la place à ceux-ci
+					n = MIN(len, buffer_tx_write_index[uart_id] - buffer_tx_read_index[uart_id]);
+					if(n)
+					{
+						buffer_tx_read_index[uart_id] += n;
+						uart_stats[uart_id].tx_dropped += n;
+						free = n;
+						break;
+					}
+					//Rien ne peut être écrasé : on perd les nouveaux octets
+					/* fall through */
+				case UART_TX_POLICY_DROP:
+					uart_stats[uart_id].tx_dropped += len;
+					IRQSTAT_IRQ_RESTORE(primask);
+					return;
+				case UART_TX_POLICY_BLOCK:
+				default:
+					IRQSTAT_IRQ_RESTORE(primask);
+					if(UART_in_interrupt_context() && !UART_tx_poll_one(uart_id))
+					{
+						//Personne d'autre ne videra le buffer pour nous, et l'écrivain que l'on a préempté le bloque : on abandonne
+						uart_stats[uart_id].tx_dropped += len;
+						return;
+					}
+					continue;
+			}
+		}
+		n = MIN(len, free);
+		start = buffer_tx_reserve_index[uart_id];
+		buffer_tx_reserve_index[uart_id] = start + n;
+		buffer_tx_pending[uart_id]++;
+		IRQSTAT_IRQ_RESTORE(primask);
+
+		for(i = 0; i < n; i++)
+			buffer_tx[uart_id][(start + i) & BUFFER_TX_MASK] = datas[i];
+
+		IRQSTAT_IRQ_DISABLE(primask);
+		UART_tx_publish(uart_id);
+		IRQSTAT_IRQ_RESTORE(primask);
+		datas += n;
+		len -= n;
+	}
+}
+
+/**
+ * @brief	Traitement de l'IT TXE : un octet du buffer d'émission est placé dans le registre TDR.
+ * @post	L'IT TXE est désactivée lorsque le buffer est vide.
+ */
+__RAM_FUNC_CCM static void UART_tx_process_it(uart_id_t uart_id)
+{
+	USART_TypeDef * pusart = structure_handles[uart_id].Instance;
+	if((pusart->CR1 & USART_CR1_TXEIE) && (pusart->ISR & USART_ISR_TXE))
+	{
+		if(buffer_tx_read_index[uart_id] != buffer_tx_write_index[uart_id])
+		{
+			pusart->TDR = (uint16_t)buffer_tx[uart_id][buffer_tx_read_index[uart_id] & BUFFER_TX_MASK];
+			buffer_tx_read_index[uart_id]++;
+		}
+		if(buffer_tx_read_index[uart_id] == buffer_tx_write_index[uart_id])
+			ATOMIC_CLEAR_BIT(pusart->CR1, USART_CR1_TXEIE);
+	}
+}
+
+/**
+ * @brief	Envoi un caractere sur l'UARTx.
  *
+ * Le caractère est simplement recopié dans le buffer d'émission, l'envoi effectif se fait en interruption.
+ * Fonction non blocante, sauf si le buffer est plein et que la politique UART_TX_POLICY_BLOCK est choisie.
  * @param	c : le caractere a envoyer
  * @param	uart_id UART1_ID, UART2_ID
  */
 void BSP_UART_putc(uart_id_t uart_id, uint8_t c)
- {
-	HAL_StatusTypeDef state;
+{
 	assert(uart_id < UART_ID_NB);
 	if(uart_initialized[uart_id])
-	{
-		do
-		{
-			NVIC_DisableIRQ(nvic_IRQ_array[uart_id]);
-			state = HAL_UART_Transmit(&structure_handles[uart_id], &c, 1, UART_TIMEOUT);
-			NVIC_EnableIRQ(nvic_IRQ_array[uart_id]);
-		}while(state == HAL_BUSY);
-	}
+		UART_tx_write(uart_id, &c, 1);
 }
 
 /**
- * @brief	Envoi une chaine de caractere sur l'USARTx. Fonction BLOCANTE si un caractere est deja en cours d'envoi.
+ * @brief	Envoi une chaine de caractere sur l'USARTx.
  *
+ * La chaîne est recopiée dans le buffer d'émission, l'envoi effectif se fait en interruption.
+ * Fonction non blocante, sauf si le buffer est plein et que la politique UART_TX_POLICY_BLOCK est choisie.
  * @param	uart_id : UART1_ID, UART2_ID
  * @param	str : la chaine de caractère à envoyer
  * @param	len : le nombre de caractères à envoyer. Si 0, la longueur de la chaîne est évaluée dynamiquement avec strlen
  */
 void BSP_UART_puts(uart_id_t uart_id, const uint8_t *str, uint16_t len)
 {
-    HAL_StatusTypeDef state;
-    HAL_UART_StateTypeDef uart_state;
-    assert(uart_id < UART_ID_NB);
+	assert(uart_id < UART_ID_NB);
 	if(uart_initialized[uart_id])
 	{
 		if (len == 0)
 			len = strlen((const char*) str);
-		do
+		UART_tx_write(uart_id, str, len);
+	}
+}
+
+/**
+ * @brief	Choisit le comportement de BSP_UART_putc() / BSP_UART_puts() lorsque le buffer d'émission est plein
+ *
+ * @param	uart_id : UART1_ID, UART2_ID
+ * @param	policy : UART_TX_POLICY_BLOCK (par défaut), UART_TX_POLICY_DROP ou UART_TX_POLICY_OVERWRITE
+ */
+void BSP_UART_set_tx_policy(uart_id_t uart_id, uart_tx_policy_t policy)
+{
+	assert(uart_id < UART_ID_NB);
+	tx_policy[uart_id] = policy;
+}
+
+/**
+ * @brief	Réserve une zone de len octets dans le buffer d'émission, pour y construire une trame sans copie intermédiaire.
+ *
+ * La zone est remplie par l'appelant (via BSP_UART_tx_byte()), puis validée par BSP_UART_tx_commit().
+ * Contrairement à BSP_UART_puts(), une trame n'est jamais découpée ni écrasée : avec la politique UART_TX_POLICY_BLOCK,
+ * on attend qu'il y ait assez de place ; sinon la réservation échoue (et les octets sont comptés dans tx_dropped).
+ * @param	uart_id : UART1_ID, UART2_ID
+ * @param	len : nombre d'octets à réserver (au plus BUFFER_TX_SIZE)
+ * @param	reservation : renseignée par cette fonction
+ * @return	true si la zone est réservée. Dans ce cas, BSP_UART_tx_commit() DOIT être appelée.
+ */
+bool BSP_UART_tx_reserve(uart_id_t uart_id, uint32_t len, uart_tx_reservation_t * reservation)
+{
+	uint32_t primask;
+	assert(uart_id < UART_ID_NB);
+	if(!uart_initialized[uart_id])
+		return false;
+
+	while(1)
+	{
+		IRQSTAT_IRQ_DISABLE(primask);
+		if(BUFFER_TX_SIZE - (buffer_tx_reserve_index[uart_id] - buffer_tx_read_index[uart_id]) >= len)
 		{
-			NVIC_DisableIRQ(nvic_IRQ_array[uart_id]);
-			state = HAL_UART_Transmit(&structure_handles[uart_id], (uint8_t*) str, len, UART_TIMEOUT);
-			NVIC_EnableIRQ(nvic_IRQ_array[uart_id]);
-		}while(state == HAL_BUSY);
+			reservation->start = buffer_tx_reserve_index[uart_id];
+			reservation->len = len;
+			buffer_tx_reserve_index[uart_id] += len;
+			buffer_tx_pending[uart_id]++;
+			IRQSTAT_IRQ_RESTORE(primask);
+			return true;
+		}
+		IRQSTAT_IRQ_RESTORE(primask);
 
-		do
+		if(len > BUFFER_TX_SIZE || tx_policy[uart_id] != UART_TX_POLICY_BLOCK
+				|| (UART_in_interrupt_context() && !UART_tx_poll_one(uart_id)))
 		{
-			uart_state = HAL_UART_GetState(&structure_handles[uart_id]);
-		}while(uart_state == HAL_UART_STATE_BUSY_TX || uart_state == HAL_UART_STATE_BUSY_TX_RX);
+			IRQSTAT_IRQ_DISABLE(primask);
+			uart_stats[uart_id].tx_dropped += len;
+			IRQSTAT_IRQ_RESTORE(primask);
+			return false;
+		}
 	}
 }
 
+/**
+ * @brief	Écrit un octet dans une zone réservée par BSP_UART_tx_reserve()
+ *
+ * @param	offset : position de l'octet dans la zone (de 0 à reservation->len - 1)
+ */
+void BSP_UART_tx_byte(uart_id_t uart_id, const uart_tx_reservation_t * reservation, uint32_t offset, uint8_t c)
+{
+	buffer_tx[uart_id][(reservation->start + offset) & BUFFER_TX_MASK] = c;
+}
+
+/**
+ * @brief	Valide une zone réservée par BSP_UART_tx_reserve() : elle sera envoyée en IT.
+ */
+void BSP_UART_tx_commit(uart_id_t uart_id, const uart_tx_reservation_t * reservation)
+{
+	uint32_t primask;
+	(void)reservation;
+	assert(uart_id < UART_ID_NB);
+	IRQSTAT_IRQ_DISABLE(primask);
+	UART_tx_publish(uart_id);
+	IRQSTAT_IRQ_RESTORE(primask);
+}
+
+/**
+ * @brief	Fonction BLOCANTE qui attend que tous les octets du buffer d'émission soient effectivement sortis sur la broche Tx.
+ *
+ * Utilisable en interruption ou IT masquées (dans un fault handler par exemple) : le buffer est alors vidé par polling.
+ * @param	uart_id : UART1_ID, UART2_ID
+ */
+void BSP_UART_flush(uart_id_t uart_id)
+{
+	assert(uart_id < UART_ID_NB);
+	if(!uart_initialized[uart_id])
+		return;
+	while(buffer_tx_read_index[uart_id] != buffer_tx_write_index[uart_id])
+	{
+		if(UART_in_interrupt_context() && !UART_tx_poll_one(uart_id))
+			break;
+	}
+	while((structure_handles[uart_id].Instance->ISR & USART_ISR_TC) == 0);
+}
+
 /**
  * @brief	Initialise l'USARTx - 8N1 - vitesse des bits (baudrate) indiqué en paramètre
  * @func	void UART_init(uint8_t uart_id, uart_interrupt_mode_e mode)
@@ -331,9 +596,12 @@ void BSP_UART_init(uart_id_t uart_id, uint32_t baudrate)
 	assert(baudrate > 1000);
 	assert(uart_id < UART_ID_NB);
 
-	buffer_rx_read_index[uart_id] = 0;
-	buffer_rx_write_index[uart_id] = 0;
-	buffer_rx_data_ready[uart_id] = false;
+	uart_rx_ring_init(&rx_ring[uart_id], buffer_rx[uart_id], buffer_rx_size[uart_id]);
+	BSP_UART_reset_stats(uart_id);
+	buffer_tx_read_index[uart_id] = 0;
+	buffer_tx_write_index[uart_id] = 0;
+	buffer_tx_reserve_index[uart_id] = 0;
+	buffer_tx_pending[uart_id] = 0;
 	/* UARTx configured as follow:
 		- Word Length = 8 Bits
 		- One Stop Bit
@@ -377,7 +645,7 @@ void BSP_UART_init(uart_id_t uart_id, uint32_t baudrate)
 	/* Interrupt Init */
 	HAL_NVIC_SetPriority(nvic_IRQ_array[uart_id], 1, 1);
 	HAL_NVIC_EnableIRQ(nvic_IRQ_array[uart_id]);
-	HAL_UART_Receive_IT(&structure_handles[uart_id],&buffer_rx[uart_id][buffer_rx_write_index[uart_id]],1);	//Activation de la réception d'un caractère
+	HAL_UART_Receive_IT(&structure_handles[uart_id], &rx_byte[uart_id], 1);	//Activation de la réception d'un caractère
 
 	//Config LibC: no buffering
 	setvbuf(stdout, NULL, _IONBF, 0 );
@@ -492,14 +760,20 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uart_handle)
 	}
 }
 
-void USART1_IRQHandler(void)
+__RAM_FUNC_CCM void USART1_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(USART1);
+	UART_tx_process_it(UART1_ID);
 	HAL_UART_IRQHandler(&structure_handles[UART1_ID]);
+	IRQSTAT_ISR_EXIT(USART1);
 }
 
-void USART2_IRQHandler(void)
+__RAM_FUNC_CCM void USART2_IRQHandler(void)
 {
+	IRQSTAT_ISR_ENTER(USART2);
+	UART_tx_process_it(UART2_ID);
 	HAL_UART_IRQHandler(&structure_handles[UART2_ID]);
+	IRQSTAT_ISR_EXIT(USART2);
 }
 
 /**
@@ -514,43 +788,103 @@ void BSP_UART_set_callback(uart_id_t uart_id, callback_fun_t cb)
 	callback_uart_rx[uart_id] = cb;
 }
 
-#define USART_FLAG_ERRORS (USART_ISR_ORE | USART_ISR_NE | USART_ISR_FE | USART_ISR_PE)
+/**
+ * @brief Retrouve l'ID de l'UART correspondant à un handle HAL
+ * @return UART_ID_NB si l'UART n'est pas géré par ce module
+ */
+__RAM_FUNC_CCM static uart_id_t UART_get_id(UART_HandleTypeDef *huart)
+{
+	if (huart->Instance == USART1)
+		return UART1_ID;
+	if (huart->Instance == USART2)
+		return UART2_ID;
+	return UART_ID_NB;
+}
+
+/**
+ * @brief Cette fonction est appelée en interruption UART par le module HAL lorsqu'une erreur de réception est détectée.
+ *
+ * Les drapeaux d'erreur ont déjà été acquittés par HAL_UART_IRQHandler() : on se contente de les comptabiliser.
+ * @post Une erreur d'overrun interrompt la réception côté HAL : elle est relancée ici.
+ */
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
-	__unused uint8_t trash;
-	uint32_t status;
-	do{
-		status = huart->Instance->ISR;
-		if (status & USART_ISR_RXNE)
-			trash = (uint8_t) (huart->Instance->RDR);
-		if (status & USART_FLAG_ERRORS)
-			huart->Instance->ICR = USART_FLAG_ERRORS;
-	}while(status & USART_FLAG_ERRORS);
+	uart_id_t uart_id = UART_get_id(huart);
+	uint32_t error = huart->ErrorCode;
+	if(uart_id == UART_ID_NB)
+		return;
+
+	if(error & HAL_UART_ERROR_ORE)
+		uart_stats[uart_id].overrun_errors++;
+	if(error & HAL_UART_ERROR_FE)
+		uart_stats[uart_id].framing_errors++;
+	if(error & HAL_UART_ERROR_NE)
+		uart_stats[uart_id].noise_errors++;
+	if(error & HAL_UART_ERROR_PE)
+		uart_stats[uart_id].parity_errors++;
+
+	if(huart->RxState == HAL_UART_STATE_READY)
+		HAL_UART_Receive_IT(huart, &rx_byte[uart_id], 1);
 }
 
 /**
  * @brief Cette fonction est appelée en interruption UART par le module HAL.
  *
  * @param huart handle de l'UART concerné
- * @param Size	Le nombre d'octet à traiter
- * @post Les octets reçus sont stockés dans le buffer correspondant.
- * @post La réception en IT des prochains octets est réactivée.
+ * @post L'octet reçu est stocké dans le buffer correspondant, ou comptabilisé comme perdu si le buffer est plein.
+ * @post La réception en IT des prochains octets est réactivée (avant l'appel de la callback utilisateur, qui peut être longue).
  */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+__RAM_FUNC_CCM void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
-	uart_id_t uart_id;
-	if (huart->Instance == USART1)
-		uart_id = UART1_ID;
-	else if (huart->Instance == USART2)
-		uart_id = UART2_ID;
-	else
+	uint32_t occupancy;
+	uart_id_t uart_id = UART_get_id(huart);
+	if(uart_id == UART_ID_NB)
 		return;
 
-	buffer_rx_data_ready[uart_id] = true;
-	buffer_rx_write_index[uart_id] = (buffer_rx_write_index[uart_id] + 1) % BUFFER_RX_SIZE;
+	uart_stats[uart_id].rx_bytes++;
+	BSP_TRACE_uart_rx_byte(uart_id);
+	if(!uart_rx_ring_push(&rx_ring[uart_id], &rx_byte[uart_id]))
+		uart_stats[uart_id].rx_dropped++;	//Buffer plein : on n'écrase pas les données non lues
+	else
+	{
+		occupancy = uart_rx_ring_count(&rx_ring[uart_id]);
+		if(occupancy > uart_stats[uart_id].rx_peak_occupancy)
+			uart_stats[uart_id].rx_peak_occupancy = occupancy;
+	}
+	HAL_UART_Receive_IT(&structure_handles[uart_id], &rx_byte[uart_id], 1);//Activation de la réception d'un caractère
 	if (callback_uart_rx[uart_id] != NULL)
 		callback_uart_rx[uart_id]();
-	HAL_UART_Receive_IT(&structure_handles[uart_id], &buffer_rx[uart_id][buffer_rx_write_index[uart_id]], 1);//Activation de la réception d'un caractère
+}
+
+/**
+ * @brief Recopie les statistiques de la liaison série demandée
+ *
+ * Permet de dimensionner les buffers de réception (rx_peak_occupancy) et de vérifier qu'aucun octet n'est perdu.
+ * @param uart_id ID de l'uart concerné
+ * @param stats structure remplie par cette fonction
+ */
+void BSP_UART_get_stats(uart_id_t uart_id, uart_stats_t * stats)
+{
+	uint32_t primask;
+	assert(uart_id < UART_ID_NB);
+	IRQSTAT_IRQ_DISABLE(primask);
+	*stats = uart_stats[uart_id];	//Copie cohérente : l'IT ne peut pas modifier les compteurs pendant la recopie
+	IRQSTAT_IRQ_RESTORE(primask);
+	stats->rx_buffer_size = buffer_rx_size[uart_id];
+}
+
+/**
+ * @brief Remet à zéro les statistiques de la liaison série demandée
+ *
+ * @param uart_id ID de l'uart concerné
+ */
+void BSP_UART_reset_stats(uart_id_t uart_id)
+{
+	uint32_t primask;
+	assert(uart_id < UART_ID_NB);
+	IRQSTAT_IRQ_DISABLE(primask);
+	memset(&uart_stats[uart_id], 0, sizeof(uart_stats_t));
+	IRQSTAT_IRQ_RESTORE(primask);
 }
 
 //ecriture impolie forcée bloquante sur l'UART (à utiliser en IT, en cas d'extrême recours)
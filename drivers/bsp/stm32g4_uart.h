@@ -34,6 +34,41 @@ typedef enum
 	UART_ID_NB
 }uart_id_t;
 
+/**
+ * @brief Politique appliquée lorsque le buffer d'émission d'un UART est plein
+ */
+typedef enum
+{
+	UART_TX_POLICY_BLOCK = 0,	//On attend qu'une place se libère (vidage par polling si on est en interruption)
+	UART_TX_POLICY_DROP,		//Les octets qui ne rentrent pas dans le buffer sont perdus
+	UART_TX_POLICY_OVERWRITE	//Les octets les plus anciens (pas encore envoyés) sont écrasés
+}uart_tx_policy_t;
+
+/**
+ * @brief Zone réservée dans le buffer d'émission, cf. BSP_UART_tx_reserve()
+ */
+typedef struct
+{
+	uint32_t start;
+	uint32_t len;
+}uart_tx_reservation_t;
+
+/**
+ * @brief Statistiques d'une liaison série, cf. BSP_UART_get_stats()
+ */
+typedef struct
+{
+	uint32_t rx_bytes;			//Octets reçus par le périphérique
+	uint32_t rx_dropped;		//Octets perdus car le buffer de réception était plein
+	uint32_t rx_peak_occupancy;	//Nombre maximal d'octets en attente dans le buffer de réception
+	uint32_t rx_buffer_size;	//Taille du buffer de réception (UARTx_RX_BUFFER_SIZE)
+	uint32_t overrun_errors;	//Octets écrasés dans le périphérique avant d'avoir été lus (IT servie trop tard)
+	uint32_t framing_errors;	//Bit de stop absent (baudrate incorrect, ligne coupée...)
+	uint32_t noise_errors;		//Bruit détecté pendant l'échantillonnage d'un bit
+	uint32_t parity_errors;		//Parité incorrecte (si la parité est activée)
+	uint32_t tx_dropped;		//Octets non envoyés à cause des politiques UART_TX_POLICY_DROP / UART_TX_POLICY_OVERWRITE
+}uart_stats_t;
+
 /* Exported functions prototypes ---------------------------------------------*/
 void BSP_UART_demo(void);
 
@@ -61,6 +96,20 @@ bool BSP_UART_data_ready(uart_id_t uart_id);
 
 void BSP_UART_set_callback(uart_id_t uart_id, callback_fun_t cb);
 
+void BSP_UART_set_tx_policy(uart_id_t uart_id, uart_tx_policy_t policy);
+
+void BSP_UART_flush(uart_id_t uart_id);
+
+bool BSP_UART_tx_reserve(uart_id_t uart_id, uint32_t len, uart_tx_reservation_t * reservation);
+
+void BSP_UART_tx_byte(uart_id_t uart_id, const uart_tx_reservation_t * reservation, uint32_t offset, uint8_t c);
+
+void BSP_UART_tx_commit(uart_id_t uart_id, const uart_tx_reservation_t * reservation);
+
+void BSP_UART_get_stats(uart_id_t uart_id, uart_stats_t * stats);
+
+void BSP_UART_reset_stats(uart_id_t uart_id);
+
 void BSP_UART_impolite_force_puts_on_uart(uart_id_t uart_id, uint8_t * str, uint32_t len);
 
 #endif /* BSP_STM32G4_UART_H_ */
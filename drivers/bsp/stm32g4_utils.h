@@ -41,6 +41,13 @@
 #define ABSOLUTE(x)					(((x) >= 0) ? (x) : (-(x)))
 #define MODULO(x, N) ((x % N + N) % N)		//vrai modulo, avec un résultat non signé. Car l'opérateur % renvoit le reste signé de la division entière.
 
+// Placement en CCM SRAM (10 Ko sans état d'attente, cf. STM32G431KBTX_FLASH.ld), pour les chemins critiques :
+// code recopié depuis la flash au démarrage, durée d'exécution indépendante du cache de la flash
+#define __RAM_FUNC_CCM			__attribute__((section(".ccmram_text"), noinline))	//Fonction exécutée depuis la CCM SRAM
+#define __CCMRAM_CONST			__attribute__((section(".ccmram_rodata")))			//Table constante
+#define __CCMRAM				__attribute__((section(".ccmram")))					//Variable initialisée
+#define __CCMRAM_BSS			__attribute__((section(".ccmram_bss")))				//Variable mise à zéro au démarrage
+
 // Debug defines
 #undef assert	// Retrait explicite de la macro assert (si déjà définie par une inclusion de <assert.h>) pour éviter un warning de redéfinition
 #if !TRACE
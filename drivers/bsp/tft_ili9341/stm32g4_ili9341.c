@@ -37,6 +37,8 @@
 #include "stm32g4_utils.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_fonts.h"
+#include "stm32g4_prof.h"
+#include "stm32g4_trace.h"
 /*
  * Cette bibliothèque contient les fonctions nécessaires pour utiliser l'écran TFT ILI9341 avec un STM32G4.
  *
@@ -62,8 +64,8 @@
 /* Pin definitions */
 #define ILI9341_RST_SET()			HAL_GPIO_WritePin(ILI9341_RST_PORT,ILI9341_RST_PIN, 1)
 #define ILI9341_RST_RESET()			HAL_GPIO_WritePin(ILI9341_RST_PORT,ILI9341_RST_PIN, 0)
-#define ILI9341_CS_SET()			HAL_GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, 1)
-#define ILI9341_CS_RESET()			HAL_GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, 0)
+#define ILI9341_CS_SET()			do { HAL_GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, 1); TRACE_RECORD(TRACE_SPI_END, TRACE_SPI_ILI9341); } while(0)
+#define ILI9341_CS_RESET()			do { TRACE_RECORD(TRACE_SPI_BEGIN, TRACE_SPI_ILI9341); HAL_GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, 0); } while(0)
 #define ILI9341_WRX_SET()			HAL_GPIO_WritePin(ILI9341_WRX_PORT, ILI9341_WRX_PIN, 1)
 #define ILI9341_WRX_RESET()			HAL_GPIO_WritePin(ILI9341_WRX_PORT, ILI9341_WRX_PIN, 0)
 
@@ -398,12 +400,14 @@ void ILI9341_ReadDatas(uint8_t command_to_write, uint8_t * datas, uint8_t nb_to_
  * @param  y: coordonnée Y du pixel
  * @param  color: couleur du pixel
  */
-void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
+__RAM_FUNC_CCM void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
+	PROF_ZONE_BEGIN(ILI9341_DRAW_PIXEL);
 	ILI9341_SetCursorPosition(x, y, x, y);
 
 	ILI9341_SendCommand(ILI9341_GRAM);
 	ILI9341_SendData(color >> 8);
 	ILI9341_SendData(color & 0xFF);
+	PROF_ZONE_END(ILI9341_DRAW_PIXEL);
 }
 
 uint16_t ILI9341_ReadPixel(int16_t x, int16_t y)
@@ -453,6 +457,7 @@ void ILI9341_Fill(uint16_t color) {
  * @param  color: Couleur à utiliser pour le remplissage
  */
 void ILI9341_INT_Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+	PROF_ZONE_BEGIN(ILI9341_INT_FILL);
 	uint32_t pixels_count;
 	uint8_t datas[2];
 	datas[1] = HIGHINT(color);
@@ -495,6 +500,7 @@ void ILI9341_INT_Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16
 
 	/* Go back to 8-bit SPI mode */
 	BSP_SPI_SetDataSize(ILI9341_SPI, SPI_DATASIZE_8BIT);
+	PROF_ZONE_END(ILI9341_INT_FILL);
 }
 
 void ILI9341_Delay(volatile unsigned int delay) {
@@ -544,7 +550,7 @@ void ILI9341_Rotate(ILI9341_Orientation_t orientation) {
  * @param  foreground: Couleur de la chaîne de caractères
  * @param  background: Couleur de fond de la chaîne de caractères
  */
-void ILI9341_Puts(uint16_t x, uint16_t y, char *str, FontDef_t *font, uint16_t foreground, uint16_t background) {
+void ILI9341_Puts(uint16_t x, uint16_t y, const char *str, FontDef_t *font, uint16_t foreground, uint16_t background) {
 	uint16_t startX = x;
 	
 	/* Set X and Y coordinates */
@@ -656,7 +662,8 @@ void ILI9341_GetStringSize(char *str, FontDef_t *font, uint16_t *width, uint16_t
  * @param  foreground: Couleur du caractère
  * @param  background: Couleur de fond du caractère
  */
-void ILI9341_Putc(uint16_t x, uint16_t y, char c, FontDef_t *font, uint16_t foreground, uint16_t background) {
+__RAM_FUNC_CCM void ILI9341_Putc(uint16_t x, uint16_t y, char c, FontDef_t *font, uint16_t foreground, uint16_t background) {
+	PROF_ZONE_BEGIN(ILI9341_PUTC);
 	uint32_t i, b, j;
 	/* Set coordinates */
 	ILI9341_x = x;
@@ -699,6 +706,7 @@ void ILI9341_Putc(uint16_t x, uint16_t y, char c, FontDef_t *font, uint16_t fore
 	
 	/* Set new pointer */
 	ILI9341_x += font->FontWidth;
+	PROF_ZONE_END(ILI9341_PUTC);
 }
 
 
@@ -1086,6 +1094,55 @@ void ILI9341_putImage_with_transparency(int16_t x0, int16_t y0, int16_t width, i
 	ILI9341_CS_SET();
 }
 
+#define RLE_CHUNK	32		//Pixels envoyés par appel au SPI
+/**
+ * @brief  Place une image compressée en plages (ILI9341_rle_image_t) : une seule fenêtre et un seul transfert,
+ * 		   chaque plage étant envoyée par paquets de RLE_CHUNK pixels plutôt que pixel par pixel
+ * @param  x0: Coordonnée X du point de départ
+ * @param  y0: Coordonnée Y du point de départ
+ * @param  img: Image, en flash (générée par tools/ecrans_gen.c)
+ */
+void ILI9341_putImage_rle(int16_t x0, int16_t y0, const ILI9341_rle_image_t * img){
+	uint16_t chunk[RLE_CHUNK];
+	uint32_t filled = 0;		//Pixels de chunk déjà à la couleur color
+	uint16_t color = 0;
+	uint32_t i, run, n;
+
+	ILI9341_SetCursorPosition(x0, y0, x0 + img->width-1, y0 + img->height-1);
+
+	/* Set command for GRAM data */
+	ILI9341_SendCommand(ILI9341_GRAM);
+
+	/* Send everything */
+	ILI9341_CS_RESET();
+	ILI9341_WRX_SET();
+
+	/* Go to 16-bit SPI mode */
+	BSP_SPI_SetDataSize(ILI9341_SPI, SPI_DATASIZE_16BIT);
+
+	for(i = 0; i < img->size; ){
+		if(img->palette[img->data[i] >> 6] != color || i == 0){
+			color = img->palette[img->data[i] >> 6];
+			filled = 0;
+		}
+		run = img->data[i++] & 0x3F;
+		if(run == 0 && i + 1 < img->size){
+			run = img->data[i] | ((uint32_t)img->data[i + 1] << 8);
+			i += 2;
+		}
+		while(run){
+			n = (run > RLE_CHUNK) ? RLE_CHUNK : run;
+			while(filled < n)
+				chunk[filled++] = color;
+			BSP_SPI_WriteMultiNoRegister(ILI9341_SPI, (uint8_t *)chunk, n);
+			run -= n;
+		}
+	}
+
+	BSP_SPI_SetDataSize(ILI9341_SPI, SPI_DATASIZE_8BIT);
+	ILI9341_CS_SET();
+}
+
 #ifndef LCD_DMA
 /**
  * @brief  Place une image monochrome sur l'écran LCD
@@ -152,6 +152,20 @@ typedef struct {
 	ILI9341_Orientation_t orientation; // 1 = portrait; 0 = landscape
 } ILI931_Options_t;
 
+/**
+ * @brief  Image compressée en plages de pixels de même couleur (cf. ILI9341_putImage_rle et tools/ecrans_gen.c)
+ * 		   Chaque octet donne l'indice de la couleur dans la palette (2 bits de poids fort) et la longueur de la plage
+ * 		   (6 bits, 1 à 63 pixels) ; une longueur nulle est suivie de la longueur sur 16 bits, en little-endian.
+ * 		   Les plages continuent d'une ligne sur la suivante.
+ */
+typedef struct {
+	uint16_t width;
+	uint16_t height;
+	const uint16_t * palette;		// 4 couleurs au plus
+	const uint8_t * data;
+	uint32_t size;					// Nombre d'octets de data
+} ILI9341_rle_image_t;
+
 
 void ILI9341_demo(void);
 
@@ -169,7 +183,7 @@ void ILI9341_Putc(uint16_t x, uint16_t y, char c, FontDef_t* font, uint16_t fore
 
 void ILI9341_PutBigc(uint16_t x, uint16_t y, char c, FontDef_t *font, uint16_t foreground, uint16_t background, uint8_t bigger, uint8_t full_in_bigger);
 
-void ILI9341_Puts(uint16_t x, uint16_t y, char* str, FontDef_t *font, uint16_t foreground, uint16_t background);
+void ILI9341_Puts(uint16_t x, uint16_t y, const char* str, FontDef_t *font, uint16_t foreground, uint16_t background);
 
 void ILI9341_PutBigs(uint16_t x, uint16_t y, char *str, FontDef_t *font, uint16_t foreground, uint16_t background, uint8_t bigger, uint8_t full_in_bigger) ;
 
@@ -199,6 +213,8 @@ void ILI9341_putImage_with_transparency(int16_t x0, int16_t y0, int16_t width, i
 
 void ILI9341_putImage_monochrome(uint16_t color_front, uint16_t color_background, int16_t x0, int16_t y0, int16_t width, int16_t height, const uint8_t *img, int32_t size);
 
+void ILI9341_putImage_rle(int16_t x0, int16_t y0, const ILI9341_rle_image_t * img);
+
 
 /* C++ detection */
 #ifdef __cplusplus
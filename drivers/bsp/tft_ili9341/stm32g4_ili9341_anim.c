@@ -0,0 +1,261 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_ili9341_anim.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Animations de rectangles sur l'écran ILI9341 : interpolation entre des images clés,
+ * 			à cadence fixe, en ne redessinant que les bandes découvertes ou recouvertes.
+ *******************************************************************************
+ */
+
+/*
+ * Redessiner un rectangle entier à chaque image coûte trop cher sur le lien SPI : une trappe de 94 x 41 pixels,
+ * c'est près de 8 ko à transférer, et davantage pour plusieurs objets à 50 images par seconde.
+ * D'une image à la suivante, un rectangle qui se déplace ou change de taille ne modifie que quelques bandes :
+ * 	- la partie de l'ancien rectangle qui n'est plus couverte est repeinte avec la couleur du fond ;
+ * 	- la partie du nouveau rectangle qui n'était pas encore couverte est peinte avec la couleur du rectangle.
+ * Chaque différence de deux rectangles se découpe en quatre bandes au plus (dessus, dessous, gauche, droite).
+ *
+ * 		static const ILI9341_anim_key_t chute[] = {
+ * 			{0,    ILI9341_ANIM_LINEAR,  {100, 50, 40, 20}},		//Immobile...
+ * 			{300,  ILI9341_ANIM_LINEAR,  {100, 50, 40, 20}},
+ * 			{1000, ILI9341_ANIM_EASE_IN, {100, 240, 40, 20}}};	//...puis chute hors de l'écran
+ * 		static ILI9341_anim_sprite_t liasse;
+ * 		ILI9341_DrawFilledRectangle(100, 50, 139, 69, ILI9341_COLOR_GREEN);		//Première image : dessinée par l'appelant
+ * 		ILI9341_ANIM_start(&liasse, chute, 3, ILI9341_COLOR_GREEN, ILI9341_COLOR_BLUE);
+ *
+ * 	- Les images sont cadencées par un timer logiciel périodique (stm32g4_swtimer.c), dont le callback est
+ * 	  différé dans la boucle principale : le SPI n'est jamais utilisé en interruption, en même temps que le reste de l'affichage.
+ * 	- La position est calculée à partir de la date et non du nombre d'images : une image en retard rattrape l'animation.
+ * 	- Chaque image doit tenir dans ILI9341_ANIM_FRAME_MS : une image trop longue, ou sautée parce que la boucle
+ * 	  principale était occupée, est comptée (ILI9341_ANIM_get_overruns) et signalée par DLOG.
+ * 	- Les rectangles animés sont dessinés dans l'ordre de leur démarrage ; ceux qui se chevauchent peuvent s'effacer l'un l'autre.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4_ili9341_anim.h"
+
+#if USE_ILI9341_ANIM
+#if !USE_ILI9341
+	#error "USE_ILI9341_ANIM nécessite USE_ILI9341"
+#endif
+
+#include "tft_ili9341/stm32g4_ili9341.h"
+#include "stm32g4_swtimer.h"
+#include "stm32g4_dlog.h"
+#include <stdio.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;						//Exclu
+	int16_t y1;						//Exclu
+}box_t;
+
+/* Private variables ---------------------------------------------------------*/
+static ILI9341_anim_sprite_t * sprites[ILI9341_ANIM_SPRITES_NB];
+static swtimer_t frame_timer;
+static uint16_t skipped_frames_seen = 0;		//frame_timer.overruns déjà comptées
+static uint32_t overruns = 0;
+
+/* Private functions definitions ---------------------------------------------*/
+
+/**
+ * @brief Rectangle réduit à sa partie visible
+ */
+static box_t ANIM_clip(const ILI9341_anim_rect_t * rect, const ILI931_Options_t * screen)
+{
+	box_t box = {MAX(rect->x, 0), MAX(rect->y, 0),
+			MIN(rect->x + rect->width, (int16_t)screen->width), MIN(rect->y + rect->height, (int16_t)screen->height)};
+	if(box.x0 >= box.x1 || box.y0 >= box.y1)
+		box = (box_t){0, 0, 0, 0};
+	return box;
+}
+
+static void ANIM_fill(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	ILI9341_DrawFilledRectangle(x0, y0, x1 - 1, y1 - 1, color);
+}
+
+/**
+ * @brief Peint les pixels de a qui ne sont pas dans b : quatre bandes au plus
+ */
+static void ANIM_fill_difference(const box_t * a, const box_t * b, uint16_t color)
+{
+	int16_t top, bottom;
+
+	if(a->x0 == a->x1)
+		return;
+	if(b->x0 == b->x1 || b->x0 >= a->x1 || b->x1 <= a->x0 || b->y0 >= a->y1 || b->y1 <= a->y0)
+	{
+		ANIM_fill(a->x0, a->y0, a->x1, a->y1, color);	//Pas d'intersection : tout a
+		return;
+	}
+	top = MAX(a->y0, b->y0);
+	bottom = MIN(a->y1, b->y1);
+	if(b->y0 > a->y0)
+		ANIM_fill(a->x0, a->y0, a->x1, b->y0, color);
+	if(b->y1 < a->y1)
+		ANIM_fill(a->x0, b->y1, a->x1, a->y1, color);
+	if(b->x0 > a->x0)
+		ANIM_fill(a->x0, top, b->x0, bottom, color);
+	if(b->x1 < a->x1)
+		ANIM_fill(b->x1, top, a->x1, bottom, color);
+}
+
+/**
+ * @brief Progression 0..1024 corrigée par la loi d'interpolation
+ */
+static int32_t ANIM_ease(int32_t progress, uint8_t easing)
+{
+	switch(easing)
+	{
+		case ILI9341_ANIM_EASE_IN:
+			return (progress * progress) >> 10;
+		case ILI9341_ANIM_EASE_OUT:
+			return 1024 - (((1024 - progress) * (1024 - progress)) >> 10);
+		default:
+			return progress;
+	}
+}
+
+/**
+ * @brief Position du rectangle à une date
+ * @return true si la dernière image clé est atteinte
+ */
+static bool ANIM_rect_at(const ILI9341_anim_sprite_t * sprite, uint32_t date, ILI9341_anim_rect_t * rect)
+{
+	const ILI9341_anim_key_t * from;
+	const ILI9341_anim_key_t * to;
+	int32_t e;
+	uint8_t k;
+
+	for(k = 1; k < sprite->keys_nb && sprite->keys[k].date_ms <= date; k++);
+	if(k == sprite->keys_nb)
+	{
+		*rect = sprite->keys[k - 1].rect;
+		return true;
+	}
+	from = &sprite->keys[k - 1];
+	to = &sprite->keys[k];
+	e = ANIM_ease(((int32_t)(date - from->date_ms) << 10) / (to->date_ms - from->date_ms), to->easing);
+	rect->x = from->rect.x + (((to->rect.x - from->rect.x) * e) >> 10);
+	rect->y = from->rect.y + (((to->rect.y - from->rect.y) * e) >> 10);
+	rect->width = from->rect.width + (((to->rect.width - from->rect.width) * e) >> 10);
+	rect->height = from->rect.height + (((to->rect.height - from->rect.height) * e) >> 10);
+	return false;
+}
+
+/**
+ * @brief Une image : chaque rectangle animé passe de sa position à l'écran à sa position à cette date.
+ * 		  Appelée toutes les ILI9341_ANIM_FRAME_MS dans la boucle principale (callback différé du timer logiciel).
+ */
+static void ANIM_frame(void)
+{
+	uint32_t begin = HAL_GetTick();
+	ILI931_Options_t screen = ILI9341_getOptions();
+	ILI9341_anim_sprite_t * s;
+	ILI9341_anim_rect_t rect;
+	box_t before, after;
+	bool running = false;
+	bool finished;
+	uint32_t duration;
+	uint16_t skipped;
+
+	for(uint8_t i = 0; i < ILI9341_ANIM_SPRITES_NB; i++)
+	{
+		s = sprites[i];
+		if(s == NULL)
+			continue;
+		finished = ANIM_rect_at(s, begin - s->start, &rect);
+		before = ANIM_clip(&s->drawn, &screen);
+		after = ANIM_clip(&rect, &screen);
+		ANIM_fill_difference(&before, &after, s->background);		//Pixels découverts
+		ANIM_fill_difference(&after, &before, s->color);			//Pixels recouverts
+		s->drawn = rect;
+		if(finished)
+			sprites[i] = NULL;
+		else
+			running = true;
+	}
+	if(!running)
+		BSP_SWTIMER_stop(&frame_timer);
+
+	//Budget : l'image doit tenir dans sa période, et aucune ne doit avoir été sautée
+	duration = HAL_GetTick() - begin;
+	skipped = frame_timer.overruns - skipped_frames_seen;
+	skipped_frames_seen = frame_timer.overruns;
+	if(duration > ILI9341_ANIM_FRAME_MS || skipped)
+	{
+		overruns++;
+		DLOG("ANIM frame %u ms > %u ms, %u skipped\n", duration, ILI9341_ANIM_FRAME_MS, skipped);
+	}
+}
+
+/* Public functions definitions ----------------------------------------------*/
+
+/**
+ * @brief Démarre l'animation d'un rectangle (la redémarre s'il est déjà animé).
+ * @pre	  Le rectangle de la première image clé est déjà à l'écran, dans la couleur color : seules ses modifications sont dessinées.
+ * @param keys : images clés, la première à la date 0 ; elles doivent rester valides pendant l'animation
+ * @param background : couleur des pixels découverts par le rectangle
+ * @return false s'il y a déjà ILI9341_ANIM_SPRITES_NB rectangles animés
+ */
+bool ILI9341_ANIM_start(ILI9341_anim_sprite_t * sprite, const ILI9341_anim_key_t * keys, uint8_t keys_nb, uint16_t color, uint16_t background)
+{
+	uint8_t i, free_slot = ILI9341_ANIM_SPRITES_NB;
+
+	if(keys_nb == 0)
+		return false;
+	for(i = 0; i < ILI9341_ANIM_SPRITES_NB && sprites[i] != sprite; i++)
+		if(sprites[i] == NULL && free_slot == ILI9341_ANIM_SPRITES_NB)
+			free_slot = i;
+	if(i == ILI9341_ANIM_SPRITES_NB)
+	{
+		if(free_slot == ILI9341_ANIM_SPRITES_NB)
+			return false;
+		i = free_slot;
+	}
+
+	*sprite = (ILI9341_anim_sprite_t){.keys = keys, .keys_nb = keys_nb, .color = color, .background = background,
+			.drawn = keys[0].rect, .start = HAL_GetTick()};
+	sprites[i] = sprite;
+	if(frame_timer.callback == NULL)
+		BSP_SWTIMER_init(&frame_timer, &ANIM_frame, SWTIMER_DISPATCH_MAIN);
+	if(!BSP_SWTIMER_is_running(&frame_timer))
+	{
+		skipped_frames_seen = frame_timer.overruns;
+		BSP_SWTIMER_start(&frame_timer, ILI9341_ANIM_FRAME_MS, ILI9341_ANIM_FRAME_MS);
+	}
+	return true;
+}
+
+/**
+ * @brief Arrête toutes les animations (changement d'écran) : les rectangles restent tels qu'ils sont à l'écran.
+ */
+void ILI9341_ANIM_stop_all(void)
+{
+	BSP_SWTIMER_stop(&frame_timer);
+	for(uint8_t i = 0; i < ILI9341_ANIM_SPRITES_NB; i++)
+		sprites[i] = NULL;
+}
+
+/**
+ * @brief Indique si au moins un rectangle est encore animé
+ */
+bool ILI9341_ANIM_is_running(void)
+{
+	return BSP_SWTIMER_is_running(&frame_timer);
+}
+
+/**
+ * @brief Nombre d'images qui ont dépassé ILI9341_ANIM_FRAME_MS ou ont suivi des images sautées
+ */
+uint32_t ILI9341_ANIM_get_overruns(void)
+{
+	return overruns;
+}
+
+#endif /* USE_ILI9341_ANIM */
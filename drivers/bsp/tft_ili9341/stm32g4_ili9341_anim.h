@@ -0,0 +1,80 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4_ili9341_anim.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Animations de rectangles sur l'écran ILI9341 : interpolation entre des images clés,
+ * 			à cadence fixe, en ne redessinant que les bandes découvertes ou recouvertes.
+ *******************************************************************************
+ */
+
+#ifndef BSP_STM32G4_ILI9341_ANIM_H_
+#define BSP_STM32G4_ILI9341_ANIM_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "config.h"
+#include "stm32g4_utils.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef ILI9341_ANIM_FRAME_MS
+	#define ILI9341_ANIM_FRAME_MS		20		//Période des images : 50 images par seconde
+#endif
+#ifndef ILI9341_ANIM_SPRITES_NB
+	#define ILI9341_ANIM_SPRITES_NB		8		//Rectangles animés en même temps au plus
+#endif
+
+/* Public types --------------------------------------------------------------*/
+typedef enum
+{
+	ILI9341_ANIM_LINEAR = 0,		//Vitesse constante
+	ILI9341_ANIM_EASE_IN,			//Départ arrêté, accélération constante (chute)
+	ILI9341_ANIM_EASE_OUT			//Arrivée en douceur
+}ILI9341_anim_easing_e;
+
+/**
+ * @brief Rectangle, en pixels. Il peut sortir de l'écran : seule la partie visible est dessinée.
+ */
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+	int16_t width;					//0 : rectangle vide
+	int16_t height;
+}ILI9341_anim_rect_t;
+
+/**
+ * @brief Image clé : position du rectangle à une date, atteinte depuis l'image clé précédente selon easing
+ */
+typedef struct
+{
+	uint16_t date_ms;				//Depuis le début de l'animation, croissante d'une image clé à la suivante
+	uint8_t easing;					//ILI9341_anim_easing_e, pour aller de l'image clé précédente à celle-ci
+	ILI9341_anim_rect_t rect;
+}ILI9341_anim_key_t;
+
+/**
+ * @brief Rectangle animé. La structure et ses images clés doivent rester valides pendant toute l'animation.
+ */
+typedef struct
+{
+	const ILI9341_anim_key_t * keys;
+	uint8_t keys_nb;
+	uint16_t color;
+	uint16_t background;			//Couleur des pixels découverts
+	ILI9341_anim_rect_t drawn;		//Rectangle actuellement à l'écran
+	uint32_t start;					//[ms] référence HAL_GetTick()
+}ILI9341_anim_sprite_t;
+
+#if USE_ILI9341_ANIM
+
+/* Public functions declarations ---------------------------------------------*/
+bool ILI9341_ANIM_start(ILI9341_anim_sprite_t * sprite, const ILI9341_anim_key_t * keys, uint8_t keys_nb, uint16_t color, uint16_t background);
+
+void ILI9341_ANIM_stop_all(void);
+
+bool ILI9341_ANIM_is_running(void);
+
+uint32_t ILI9341_ANIM_get_overruns(void);
+
+#endif /* USE_ILI9341_ANIM */
+#endif /* BSP_STM32G4_ILI9341_ANIM_H_ */
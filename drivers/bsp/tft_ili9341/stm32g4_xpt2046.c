@@ -37,6 +37,7 @@
 #include "stm32g4_ili9341.h"
 #include "stm32g4_gpio.h"
 #include "stm32g4_utils.h"
+#include "stm32g4_trace.h"
 
 
 // Définition du bit de départ (S n7)
@@ -77,8 +78,8 @@
 // Type d'octet de contrôle
 typedef uint8_t controlByte_t;
 
-#define XPT2046_CS_SET()			HAL_GPIO_WritePin(PIN_CS_TOUCH,GPIO_PIN_SET)
-#define XPT2046_CS_RESET()			HAL_GPIO_WritePin(PIN_CS_TOUCH,GPIO_PIN_RESET)
+#define XPT2046_CS_SET()			do { HAL_GPIO_WritePin(PIN_CS_TOUCH,GPIO_PIN_SET); TRACE_RECORD(TRACE_SPI_END, TRACE_SPI_XPT2046); } while(0)
+#define XPT2046_CS_RESET()			do { TRACE_RECORD(TRACE_SPI_BEGIN, TRACE_SPI_XPT2046); HAL_GPIO_WritePin(PIN_CS_TOUCH,GPIO_PIN_RESET); } while(0)
 
 static uint16_t XPT2046_getReading(controlByte_t controlByte);
 static void XPT2046_convertCoordinateScreenMode(int16_t * pX, int16_t * pY);
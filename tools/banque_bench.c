@@ -0,0 +1,232 @@
+/**
+ *******************************************************************************
+ * @file	banque_bench.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Banc d'essai PC (Linux) du chargement des questions d'une banque sur carte SD
+ * 			(fichier produit par tools/banque_csv.c, lu sur la cible par app/banque_sd.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -Iapp -o banque_bench tools/banque_bench.c
+ * Utilisation :
+ * 		banque_bench [-n tirages] [-i entrées d'index en RAM] [-f kHz SPI] [-a µs d'accès] questions.bnk
+ *
+ * Rejoue les accès de banque_sd.c (index en RAM en une lecture s'il tient dans -i entrées, comme
+ * BANQUE_SD_INDEX_MAX ; sinon une lecture d'entrée par question ; puis l'enregistrement) en comptant
+ * les secteurs lus par la carte : FatFs garde le dernier secteur lu du fichier, une lecture dans ce
+ * secteur ne coûte rien. La durée sur la cible est estimée à partir de l'horloge SPI (-f) et du temps
+ * d'accès de la carte à chaque commande de lecture (-a), et comparée à la durée mesurée sur le PC
+ * (lecture, découpage et repli en ASCII, fichier dans le cache du système).
+ * Le temps de chargement sur la cible se mesure avec la zone BANQUE_SD_CHARGER de stm32g4_prof.h.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "banque_format.h"
+
+typedef struct
+{
+	uint32_t sectors;		//Secteurs lus par la carte
+	uint32_t commands;		//Commandes de lecture (CMD17 ou CMD18)
+}cost_t;
+
+static FILE * bank;
+static entete_banque_t header;
+static entree_banque_t * index_ram = NULL;
+static uint32_t cached_sector = UINT32_MAX;		//Secteur gardé par FatFs (tampon du fichier)
+static double spi_khz = 10625;
+static double access_us = 300;
+
+/**
+ * @brief Lecture dans le fichier, avec le décompte des accès de FatFs :
+ * 		  secteurs entiers lus directement (une commande pour tous), secteurs partiels par le tampon du fichier
+ */
+static int read_at(uint32_t position, void * buffer, uint32_t size, cost_t * cost)
+{
+	uint32_t first = position / BANQUE_SECTEUR;
+	uint32_t last = (position + size - 1) / BANQUE_SECTEUR;
+	uint32_t whole = 0;
+
+	for(uint32_t s = first; s <= last; s++)
+	{
+		int partial = (s == first && position % BANQUE_SECTEUR) || (s == last && (position + size) % BANQUE_SECTEUR);
+		if(!partial)
+		{
+			if(!whole++)
+				cost->commands++;
+			cost->sectors++;
+		}
+		else if(s != cached_sector)
+		{
+			cost->commands++;
+			cost->sectors++;
+			cached_sector = s;
+			whole = 0;
+		}
+	}
+	return fseek(bank, position, SEEK_SET) == 0 && fread(buffer, 1, size, bank) == size;
+}
+
+static double estimate_us(const cost_t * cost)
+{
+	return cost->commands * access_us + cost->sectors * (BANQUE_SECTEUR + 2) * 8 * 1000.0 / spi_khz;
+}
+
+static double now_us(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+/**
+ * @brief Repli en ASCII, comme banque_sd.c (les caractères non ASCII deviennent '?' ici)
+ */
+static void fold(char * text, int utf8)
+{
+	const uint8_t * r = (const uint8_t *)text;
+	char * w = text;
+
+	while(*r)
+	{
+		uint32_t code = *r++;
+		if(utf8 && code >= 0xC0)
+			while((*r & 0xC0) == 0x80)
+				r++;
+		*w++ = (code < 0x80) ? (char)code : '?';
+	}
+	*w = '\0';
+}
+
+/**
+ * @brief Charge une question comme banque_sd.c. Retourne 0 si l'enregistrement est invalide.
+ */
+static int load(uint32_t question, cost_t * cost)
+{
+	entree_banque_t entry;
+	char record[BANQUE_ENREGISTREMENT_MAX];
+	char * text;
+
+	if(index_ram)
+		entry = index_ram[question];
+	else if(!read_at(BANQUE_DEBUT_INDEX + question * sizeof(entry), &entry, sizeof(entry), cost))
+		return 0;
+	if(entry.longueur <= 4 || entry.longueur > BANQUE_ENREGISTREMENT_MAX || !read_at(entry.position, record, entry.longueur, cost))
+		return 0;
+	record[entry.longueur - 1] = '\0';
+	text = &record[1];
+	for(int i = 0; i < 4; i++)
+	{
+		if(text >= &record[entry.longueur])
+			return 0;
+		fold(text, header.encodage == BANQUE_UTF8);
+		text += strlen(text) + 1;
+	}
+	return (uint8_t)record[0] < 3;
+}
+
+static int by_value(const void * a, const void * b)
+{
+	double da = *(const double *)a;
+	double db = *(const double *)b;
+	return (da > db) - (da < db);
+}
+
+static void report(const char * name, double * values, int nb)
+{
+	double sum = 0;
+
+	qsort(values, nb, sizeof(double), by_value);
+	for(int i = 0; i < nb; i++)
+		sum += values[i];
+	printf("  %-28s min %8.1f  moyenne %8.1f  p99 %8.1f  max %8.1f\n", name, values[0], sum / nb, values[(nb * 99) / 100], values[nb - 1]);
+}
+
+int main(int argc, char ** argv)
+{
+	const char * path = NULL;
+	int draws = 10000;
+	uint32_t index_max = 256;
+	uint32_t index_size;
+	cost_t cost = {0};
+	double * host;
+	double * target;
+	uint32_t total_sectors = 0;
+	double start;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-n") && i + 1 < argc)
+			draws = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-i") && i + 1 < argc)
+			index_max = (uint32_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-f") && i + 1 < argc)
+			spi_khz = atof(argv[++i]);
+		else if(!strcmp(argv[i], "-a") && i + 1 < argc)
+			access_us = atof(argv[++i]);
+		else
+			path = argv[i];
+	}
+	if(!path || draws <= 0 || spi_khz <= 0)
+	{
+		fprintf(stderr, "usage : %s [-n tirages] [-i entrées d'index en RAM] [-f kHz SPI] [-a µs d'accès] questions.bnk\n", argv[0]);
+		return 1;
+	}
+	if(!(bank = fopen(path, "rb")))
+	{
+		perror(path);
+		return 1;
+	}
+
+	//Ouverture : en-tête, puis index en une lecture de secteurs entiers s'il tient en RAM
+	start = now_us();
+	if(!read_at(0, &header, sizeof(header), &cost) || memcmp(header.signature, BANQUE_SIGNATURE, 4) || header.version != BANQUE_VERSION
+			|| header.nb_difficultes != BANQUE_DIFFICULTES || header.nb_categories != BANQUE_CATEGORIES || header.nombre == 0)
+	{
+		fprintf(stderr, "%s : banque de questions invalide\n", path);
+		return 1;
+	}
+	index_size = ((header.nombre * sizeof(entree_banque_t) + BANQUE_SECTEUR - 1) / BANQUE_SECTEUR) * BANQUE_SECTEUR;
+	if(header.nombre <= index_max)
+	{
+		index_ram = malloc(index_size);
+		if(!read_at(BANQUE_DEBUT_INDEX, index_ram, index_size, &cost))
+			return 1;
+	}
+	printf("%s : %u questions (%s), index %s\n", path, header.nombre, (header.encodage == BANQUE_UTF8) ? "UTF-8" : "Latin-1",
+			index_ram ? "en RAM" : "lu à la demande");
+	printf("Ouverture : %u secteurs, %u commandes, %.0f µs estimées sur la cible (%.1f µs sur le PC)\n",
+			cost.sectors, cost.commands, estimate_us(&cost), now_us() - start);
+
+	//Tirages au hasard : une question par tirage, comme pendant une partie
+	host = malloc(draws * sizeof(double));
+	target = malloc(draws * sizeof(double));
+	srand(1);
+	for(int i = 0; i < draws; i++)
+	{
+		uint32_t question = (uint32_t)rand() % header.nombre;
+
+		cost = (cost_t){0};
+		start = now_us();
+		if(!load(question, &cost))
+		{
+			fprintf(stderr, "%s : question %u invalide\n", path, question);
+			return 1;
+		}
+		host[i] = now_us() - start;
+		target[i] = estimate_us(&cost);
+		total_sectors += cost.sectors;
+	}
+	printf("Chargement d'une question (%d tirages, %.2f secteurs en moyenne, SPI %.0f kHz, accès %.0f µs) :\n",
+			draws, (double)total_sectors / draws, spi_khz, access_us);
+	report("PC (µs)", host, draws);
+	report("cible, estimation (µs)", target, draws);
+	printf("Avec le préchargement (banque_sd_prechargement), ce temps est pris pendant que le joueur réfléchit.\n");
+	fclose(bank);
+	return 0;
+}
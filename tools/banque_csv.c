@@ -0,0 +1,307 @@
+/**
+ *******************************************************************************
+ * @file	banque_csv.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Compilation PC (Linux) d'un fichier CSV de questions en banque de questions
+ * 			pour la carte SD (format app/banque_format.h, lu par app/banque_sd.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -Iapp -o banque_csv tools/banque_csv.c
+ * Utilisation :
+ * 		banque_csv [-l] questions.csv questions.bnk
+ * 		-l : textes en Latin-1 (un octet par caractère accentué) au lieu d'UTF-8
+ *
+ * Fichier CSV en UTF-8, une question par ligne, séparateur ';' (ou ',' si la première ligne n'a pas de ';') :
+ * 		catégorie;difficulté;question;réponse 1;réponse 2;réponse 3;bonne réponse (1 à 3)
+ * 		sciences;facile;"Combien fait 7x8 ?";49;64;56;3
+ * Catégories : culture, geographie, sciences, arts, histoire, sport (ou 0 à 5).
+ * Difficultés : facile, moyen, difficile (ou 0 à 2).
+ * Les champs peuvent être entre guillemets ("" pour un guillemet). Une première ligne d'en-têtes est ignorée.
+ * Les questions sont rangées par difficulté puis par catégorie, dans l'ordre du fichier CSV.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "banque_format.h"
+
+#define LINE_MAX_LEN	2048
+#define FIELDS_NB		7
+
+typedef struct
+{
+	uint8_t categorie;
+	uint8_t difficulte;
+	uint16_t length;
+	uint32_t line;
+	char record[BANQUE_ENREGISTREMENT_MAX];
+}question_t;
+
+static const char * categories[BANQUE_CATEGORIES] = {"culture", "geographie", "sciences", "arts", "histoire", "sport"};
+static const char * difficultes[BANQUE_DIFFICULTES] = {"facile", "moyen", "difficile"};
+
+static question_t * questions = NULL;
+static uint32_t questions_nb = 0;
+
+/**
+ * @brief Index d'un nom dans une liste (sans tenir compte de la casse), ou nombre ; -1 si inconnu
+ */
+static int lookup(const char * field, const char * const * names, int names_nb)
+{
+	char * end;
+	long value = strtol(field, &end, 10);
+
+	if(*field && !*end)
+		return (value >= 0 && value < names_nb) ? (int)value : -1;
+	for(int i = 0; i < names_nb; i++)
+		if(!strcasecmp(field, names[i]))
+			return i;
+	return -1;
+}
+
+/**
+ * @brief Découpe une ligne CSV sur place. Retourne le nombre de champs.
+ */
+static int split(char * line, char separator, char ** fields)
+{
+	char * read = line;
+	char * write = line;
+	int nb = 0;
+
+	line[strcspn(line, "\r\n")] = '\0';
+	while(nb < FIELDS_NB)
+	{
+		fields[nb++] = write;
+		if(*read == '"')
+		{
+			read++;
+			while(*read && !(read[0] == '"' && read[1] != '"'))
+			{
+				if(*read == '"')
+					read++;				//"" : un guillemet
+				*write++ = *read++;
+			}
+			if(*read == '"')
+				read++;
+		}
+		while(*read && *read != separator)
+			*write++ = *read++;
+		if(*read != separator)
+		{
+			*write = '\0';
+			break;
+		}
+		read++;
+		*write++ = '\0';
+	}
+	return nb;
+}
+
+/**
+ * @brief Ajoute un texte UTF-8 à l'enregistrement, converti en Latin-1 si demandé. Retourne false s'il est trop long.
+ */
+static int append(question_t * q, const char * text, int latin1)
+{
+	const uint8_t * p = (const uint8_t *)text;
+
+	while(*p)
+	{
+		uint32_t code = *p++;
+		char c[4];
+		int n = 0;
+
+		if(latin1 && code >= 0xC0)
+		{
+			int more = (code >= 0xF0) ? 3 : (code >= 0xE0) ? 2 : 1;
+			code &= 0x3F >> more;
+			while(more-- && (*p & 0xC0) == 0x80)
+				code = (code << 6) | (*p++ & 0x3F);
+			if(code == 0x2018 || code == 0x2019)
+				c[n++] = '\'';
+			else if(code == 0x201C || code == 0x201D)
+				c[n++] = '"';
+			else
+				c[n++] = (code <= 0xFF) ? (char)code : '?';
+		}
+		else
+			c[n++] = (char)code;
+		if(q->length + n >= BANQUE_ENREGISTREMENT_MAX)
+			return 0;
+		memcpy(&q->record[q->length], c, n);
+		q->length += n;
+	}
+	q->record[q->length++] = '\0';
+	return 1;
+}
+
+/**
+ * @brief Tri par difficulté puis catégorie, dans l'ordre du fichier CSV
+ */
+static int by_pile(const void * a, const void * b)
+{
+	const question_t * qa = a;
+	const question_t * qb = b;
+	int pa = qa->difficulte * BANQUE_CATEGORIES + qa->categorie;
+	int pb = qb->difficulte * BANQUE_CATEGORIES + qb->categorie;
+
+	if(pa != pb)
+		return pa - pb;
+	return (qa->line > qb->line) - (qa->line < qb->line);
+}
+
+static int load(FILE * in, const char * path, int latin1)
+{
+	char line[LINE_MAX_LEN];
+	char * fields[FIELDS_NB];
+	char separator = 0;
+	uint32_t line_nb = 0;
+	int errors = 0;
+
+	while(fgets(line, sizeof(line), in))
+	{
+		question_t q = {0};
+		int categorie, difficulte, bonne;
+
+		line_nb++;
+		if(line_nb == 1 && !strncmp(line, "\xEF\xBB\xBF", 3))
+			memmove(line, line + 3, strlen(line + 3) + 1);		//Marque d'ordre des octets UTF-8
+		if(!separator)
+			separator = strchr(line, ';') ? ';' : ',';
+		if(line[strspn(line, " \t\r\n")] == '\0')
+			continue;
+		if(split(line, separator, fields) != FIELDS_NB)
+		{
+			if(line_nb == 1)
+				continue;			//Ligne d'en-têtes
+			fprintf(stderr, "%s:%u : %d champs attendus\n", path, line_nb, FIELDS_NB);
+			errors++;
+			continue;
+		}
+		categorie = lookup(fields[0], categories, BANQUE_CATEGORIES);
+		difficulte = lookup(fields[1], difficultes, BANQUE_DIFFICULTES);
+		bonne = atoi(fields[6]);
+		if(categorie < 0 || difficulte < 0 || bonne < 1 || bonne > 3)
+		{
+			if(line_nb > 1)
+			{
+				fprintf(stderr, "%s:%u : catégorie, difficulté ou bonne réponse (1 à 3) invalide\n", path, line_nb);
+				errors++;
+			}
+			continue;			//Ligne d'en-têtes
+		}
+		q.categorie = (uint8_t)categorie;
+		q.difficulte = (uint8_t)difficulte;
+		q.line = line_nb;
+		q.record[q.length++] = (char)(bonne - 1);
+		if(!append(&q, fields[2], latin1) || !append(&q, fields[3], latin1) || !append(&q, fields[4], latin1) || !append(&q, fields[5], latin1))
+		{
+			fprintf(stderr, "%s:%u : question et réponses trop longues (%d octets au plus)\n", path, line_nb, BANQUE_ENREGISTREMENT_MAX);
+			errors++;
+			continue;
+		}
+		questions = realloc(questions, (questions_nb + 1) * sizeof(question_t));
+		questions[questions_nb++] = q;
+	}
+	return errors;
+}
+
+static int save(FILE * out, int latin1)
+{
+	entete_banque_t header = {0};
+	entree_banque_t entry;
+	uint8_t sector[BANQUE_SECTEUR] = {0};
+	uint32_t index_end = BANQUE_DEBUT_INDEX + questions_nb * sizeof(entree_banque_t);
+	uint32_t position;
+
+	memcpy(header.signature, BANQUE_SIGNATURE, 4);
+	header.version = BANQUE_VERSION;
+	header.encodage = latin1 ? BANQUE_LATIN1 : BANQUE_UTF8;
+	header.nb_difficultes = BANQUE_DIFFICULTES;
+	header.nb_categories = BANQUE_CATEGORIES;
+	header.nombre = questions_nb;
+	header.debut_textes = ((index_end + BANQUE_SECTEUR - 1) / BANQUE_SECTEUR) * BANQUE_SECTEUR;
+	for(uint32_t i = 0, p = 0; p <= BANQUE_PILES; p++)
+	{
+		while(i < questions_nb && questions[i].difficulte * BANQUE_CATEGORIES + questions[i].categorie < (int)p)
+			i++;
+		header.piles[p] = i;
+	}
+
+	memcpy(sector, &header, sizeof(header));
+	fwrite(sector, 1, sizeof(sector), out);
+	position = header.debut_textes;
+	for(uint32_t i = 0; i < questions_nb; i++)
+	{
+		entry = (entree_banque_t){position, questions[i].length, questions[i].categorie, questions[i].difficulte};
+		fwrite(&entry, sizeof(entry), 1, out);
+		position += questions[i].length;
+	}
+	memset(sector, 0, sizeof(sector));
+	fwrite(sector, 1, header.debut_textes - index_end, out);
+	for(uint32_t i = 0; i < questions_nb; i++)
+		fwrite(questions[i].record, 1, questions[i].length, out);
+	return ferror(out) ? -1 : (int)position;
+}
+
+int main(int argc, char ** argv)
+{
+	int latin1 = 0;
+	int arg = 1;
+	int size;
+	FILE * in;
+	FILE * out;
+
+	if(arg < argc && !strcmp(argv[arg], "-l"))
+	{
+		latin1 = 1;
+		arg++;
+	}
+	if(argc - arg != 2)
+	{
+		fprintf(stderr, "usage : %s [-l] questions.csv questions.bnk\n", argv[0]);
+		return 1;
+	}
+	if(!(in = fopen(argv[arg], "r")))
+	{
+		perror(argv[arg]);
+		return 1;
+	}
+	if(load(in, argv[arg], latin1))
+		return 1;
+	fclose(in);
+	if(!questions_nb)
+	{
+		fprintf(stderr, "%s : aucune question\n", argv[arg]);
+		return 1;
+	}
+	qsort(questions, questions_nb, sizeof(question_t), by_pile);
+
+	if(!(out = fopen(argv[arg + 1], "wb")))
+	{
+		perror(argv[arg + 1]);
+		return 1;
+	}
+	size = save(out, latin1);
+	if(fclose(out) || size < 0)
+	{
+		perror(argv[arg + 1]);
+		return 1;
+	}
+	fprintf(stderr, "%u questions, %d octets (%s)\n", questions_nb, size, latin1 ? "Latin-1" : "UTF-8");
+	for(int d = 0; d < BANQUE_DIFFICULTES; d++)
+	{
+		fprintf(stderr, "  %-10s", difficultes[d]);
+		for(int c = 0; c < BANQUE_CATEGORIES; c++)
+		{
+			uint32_t count = 0;
+			for(uint32_t i = 0; i < questions_nb; i++)
+				count += (questions[i].difficulte == d && questions[i].categorie == c);
+			fprintf(stderr, " %s %u", categories[c], count);
+		}
+		fprintf(stderr, "\n");
+	}
+	return 0;
+}
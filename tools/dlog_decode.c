@@ -0,0 +1,217 @@
+/**
+ *******************************************************************************
+ * @file	dlog_decode.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Décodeur PC (Linux) des enregistrements DLOG (cf. drivers/bsp/stm32g4_dlog.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -o dlog_decode tools/dlog_decode.c
+ * Utilisation :
+ * 		dlog_decode firmware.elf capture.bin		(ou '-' pour lire l'entrée standard)
+ * 		stty -F /dev/ttyACM0 115200 raw && dlog_decode Debug/firmware.elf - < /dev/ttyACM0
+ *
+ * Les chaînes de format sont lues dans la section .dlog_fmt du fichier .elf
+ * (jamais chargée sur la cible). L'identifiant d'un enregistrement est l'adresse
+ * de sa chaîne dans cette section.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <elf.h>
+
+#define DLOG_MAX_ARGS		6
+#define DLOG_HEADER_MAGIC	0xA0000000u
+#define DLOG_ID_LOST		0x00FFFFFFu
+
+static char * fmt_section = NULL;
+static uint32_t fmt_addr = 0;
+static uint32_t fmt_size = 0;
+
+/**
+ * @brief Charge la section .dlog_fmt d'un fichier ELF32 little-endian (ARM)
+ * @return 0 si la section a été trouvée
+ */
+static int load_elf(const char * path)
+{
+	FILE * f = fopen(path, "rb");
+	Elf32_Ehdr eh;
+	Elf32_Shdr * sh;
+	char * shstr;
+	int ret = -1;
+
+	if(!f)
+	{
+		perror(path);
+		return -1;
+	}
+	if(fread(&eh, sizeof(eh), 1, f) != 1 || memcmp(eh.e_ident, ELFMAG, SELFMAG) || eh.e_ident[EI_CLASS] != ELFCLASS32)
+	{
+		fprintf(stderr, "%s : fichier ELF32 attendu\n", path);
+		fclose(f);
+		return -1;
+	}
+	sh = calloc(eh.e_shnum, sizeof(Elf32_Shdr));
+	fseek(f, eh.e_shoff, SEEK_SET);
+	if(fread(sh, sizeof(Elf32_Shdr), eh.e_shnum, f) != eh.e_shnum)
+	{
+		free(sh);
+		fclose(f);
+		return -1;
+	}
+	shstr = malloc(sh[eh.e_shstrndx].sh_size);
+	fseek(f, sh[eh.e_shstrndx].sh_offset, SEEK_SET);
+	if(fread(shstr, 1, sh[eh.e_shstrndx].sh_size, f) == sh[eh.e_shstrndx].sh_size)
+	{
+		for(int i = 0; i < eh.e_shnum; i++)
+		{
+			if(strcmp(shstr + sh[i].sh_name, ".dlog_fmt") == 0)
+			{
+				fmt_addr = sh[i].sh_addr;
+				fmt_size = sh[i].sh_size;
+				fmt_section = calloc(1, fmt_size + 1);	//+1 : on garantit une fin de chaîne
+				fseek(f, sh[i].sh_offset, SEEK_SET);
+				if(fread(fmt_section, 1, fmt_size, f) == fmt_size)
+					ret = 0;
+				break;
+			}
+		}
+	}
+	if(ret)
+		fprintf(stderr, "%s : pas de section .dlog_fmt (USE_DLOG est-il activé ?)\n", path);
+	free(shstr);
+	free(sh);
+	fclose(f);
+	return ret;
+}
+
+/**
+ * @brief Retrouve la chaîne de format correspondant à un identifiant, NULL si l'identifiant est invalide
+ */
+static const char * lookup(uint32_t id)
+{
+	if(id < fmt_addr || id >= fmt_addr + fmt_size)
+		return NULL;
+	id -= fmt_addr;
+	if(id != 0 && fmt_section[id - 1] != '\0')	//Un identifiant pointe toujours sur le début d'une chaîne
+		return NULL;
+	return fmt_section + id;
+}
+
+/**
+ * @brief Reproduit printf à partir d'arguments bruts de 32 bits
+ */
+static void print_record(const char * fmt, const uint32_t * args, uint32_t nargs)
+{
+	char spec[32];
+	uint32_t a = 0;
+
+	while(*fmt)
+	{
+		if(*fmt != '%')
+		{
+			putchar(*fmt++);
+			continue;
+		}
+		if(fmt[1] == '%')
+		{
+			putchar('%');
+			fmt += 2;
+			continue;
+		}
+		//On recopie drapeaux, largeur et précision, en écartant les modificateurs de longueur (tout est sur 32 bits)
+		size_t n = 0;
+		spec[n++] = *fmt++;
+		while(*fmt && strchr("-+ #0123456789.", *fmt) && n < sizeof(spec) - 2)
+			spec[n++] = *fmt++;
+		while(*fmt && strchr("hlLqjzt", *fmt))
+			fmt++;
+		if(!*fmt)
+			break;
+		char conv = *fmt++;
+		uint32_t v = (a < nargs) ? args[a++] : 0;
+		spec[n++] = conv;
+		spec[n] = '\0';
+		switch(conv)
+		{
+			case 'd': case 'i':
+				printf(spec, (int32_t)v);
+				break;
+			case 'u': case 'x': case 'X': case 'o': case 'c':
+				printf(spec, v);
+				break;
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+			{
+				float fl;
+				memcpy(&fl, &v, sizeof(fl));	//cf. DLOG_FLOAT()
+				printf(spec, (double)fl);
+				break;
+			}
+			case 'p':
+				printf("0x%08x", v);
+				break;
+			default:
+				printf("<%s?0x%08x>", spec, v);
+				break;
+		}
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	FILE * in;
+	uint8_t window[4];
+	size_t filled = 0;
+	uint64_t resync = 0;
+	int c;
+
+	if(argc != 3)
+	{
+		fprintf(stderr, "usage : %s firmware.elf capture.bin|-\n", argv[0]);
+		return 1;
+	}
+	if(load_elf(argv[1]))
+		return 1;
+	in = strcmp(argv[2], "-") ? fopen(argv[2], "rb") : stdin;
+	if(!in)
+	{
+		perror(argv[2]);
+		return 1;
+	}
+
+	//Lecture d'un mot d'en-tête, avec recalage octet par octet si le flux est désynchronisé
+	while((c = fgetc(in)) != EOF)
+	{
+		window[filled++] = (uint8_t)c;
+		if(filled < 4)
+			continue;
+		uint32_t header = (uint32_t)window[0] | ((uint32_t)window[1] << 8) | ((uint32_t)window[2] << 16) | ((uint32_t)window[3] << 24);
+		uint32_t nargs = (header >> 24) & 0x0F;
+		uint32_t id = header & 0x00FFFFFFu;
+		const char * fmt = lookup(id);
+		if((header & 0xF0000000u) != DLOG_HEADER_MAGIC || nargs > DLOG_MAX_ARGS || (id != DLOG_ID_LOST && !fmt))
+		{
+			memmove(window, window + 1, 3);	//Pas un en-tête : on décale d'un octet
+			filled = 3;
+			resync++;
+			continue;
+		}
+		filled = 0;
+
+		uint32_t args[DLOG_MAX_ARGS];
+		if(fread(args, sizeof(uint32_t), nargs, in) != nargs)
+			break;
+		if(id == DLOG_ID_LOST)
+			printf("\n[dlog : %u message(s) perdu(s)]\n", args[0]);
+		else
+			print_record(fmt, args, nargs);
+		fflush(stdout);
+	}
+
+	if(resync)
+		fprintf(stderr, "[dlog : %llu octet(s) ignoré(s) pour se resynchroniser]\n", (unsigned long long)resync);
+	free(fmt_section);
+	return 0;
+}
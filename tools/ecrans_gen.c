@@ -0,0 +1,279 @@
+/**
+ *******************************************************************************
+ * @file	ecrans_gen.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Outil PC (Linux) : dessine les écrans fixes décrits dans app/ecrans.c et les écrit
+ * 			compressés en plages (ILI9341_rle_image_t), sous forme de fichier C pour le jeu
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -std=gnu11 -O2 -Wall -Itools/simu/stub -Iapp -Idrivers/bsp -o ecrans_gen \
+ * 			tools/ecrans_gen.c app/ecrans.c drivers/bsp/tft_ili9341/stm32g4_fonts.c
+ * Utilisation :
+ * 		ecrans_gen [-p dossier] > app/ecrans_images.c
+ *
+ * 	-p : écrit aussi chaque écran en PPM (P6) dans le dossier, pour le vérifier
+ *
+ * Les primitives sont dessinées comme par stm32g4_ili9341.c (fond des caractères compris, de
+ * FontWidth + 1 sur FontHeight + 1 pixels) ; le simulateur (tools/simu) permet de comparer
+ * l'écran précalculé à l'écran dessiné primitive par primitive (USE_ECRANS_PRECALCULES à 0).
+ * Une image compte 4 couleurs au plus. Le fichier produit commence par la taille de chaque image.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ecrans.h"
+
+#define WIDTH		320		//Écran en paysage (ILI9341_Orientation_Landscape_2)
+#define HEIGHT		240
+#define COLORS_MAX	4		//Indice de couleur sur 2 bits
+#define RUN_MAX		63		//Longueur d'une plage sur un octet
+#define RUN_LONG	0xFFFF	//Longueur d'une plage sur trois octets
+
+static uint16_t frame[HEIGHT][WIDTH];
+
+typedef struct
+{
+	uint16_t palette[COLORS_MAX];
+	uint8_t colors_nb;
+	uint8_t * data;
+	uint32_t size;
+	uint32_t max;
+}image_t;
+
+/* Dessin, comme stm32g4_ili9341.c --------------------------------------------*/
+
+static void fill(int x0, int y0, int x1, int y1, uint16_t color)
+{
+	for(int y = y0; y <= y1; y++)
+		for(int x = x0; x <= x1; x++)
+			if(x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT)
+				frame[y][x] = color;
+}
+
+static void put_char(int * x, int * y, char c, const FontDef_t * font, uint16_t foreground, uint16_t background)
+{
+	uint32_t b;
+
+	if(*x + font->FontWidth > WIDTH)
+	{
+		*y += font->FontHeight;
+		*x = 0;
+	}
+	fill(*x, *y, *x + font->FontWidth, *y + font->FontHeight, background);
+	for(int i = 0; i < font->FontHeight; i++)
+	{
+		if(font->datasize == 1)
+			b = (uint32_t)((const uint8_t *)font->data)[(c - 32) * font->FontHeight + i] << 8;
+		else
+			b = ((const uint16_t *)font->data)[(c - 32) * font->FontHeight + i];
+		for(int j = 0; j < font->FontWidth; j++)
+			if((b << j) & 0x8000)
+				fill(*x + j, *y + i, *x + j, *y + i, foreground);
+	}
+	*x += font->FontWidth;
+}
+
+static void put_string(int x, int y, const char * str, const FontDef_t * font, uint16_t foreground, uint16_t background)
+{
+	int start = x;
+
+	for(; *str; str++)
+	{
+		if(x > WIDTH - font->FontWidth)
+		{
+			y += font->FontHeight + 1;
+			x = start;
+		}
+		put_char(&x, &y, *str, font, foreground, background);
+	}
+}
+
+static void draw(const description_ecran_t * screen)
+{
+	const operation_ecran_t * op;
+
+	for(int i = 0; i < screen->nb_operations; i++)
+	{
+		op = &screen->operations[i];
+		switch(op->type)
+		{
+			case OPERATION_REMPLIR:
+				fill(0, 0, WIDTH - 1, HEIGHT - 1, op->couleur);
+				break;
+			case OPERATION_RECTANGLE:
+				fill(op->x0, op->y0, op->x1, op->y0, op->couleur);
+				fill(op->x0, op->y0, op->x0, op->y1, op->couleur);
+				fill(op->x1, op->y0, op->x1, op->y1, op->couleur);
+				fill(op->x0, op->y1, op->x1, op->y1, op->couleur);
+				break;
+			case OPERATION_RECTANGLE_PLEIN:
+				fill(op->x0, op->y0, op->x1, op->y1, op->couleur);
+				break;
+			case OPERATION_TEXTE:
+				put_string(op->x0, op->y0, op->texte, op->police, op->couleur, op->fond);
+				break;
+		}
+	}
+}
+
+/* Compression ----------------------------------------------------------------*/
+
+static void emit(image_t * img, uint8_t byte)
+{
+	if(img->size == img->max)
+	{
+		img->max = img->max ? 2 * img->max : 4096;
+		img->data = realloc(img->data, img->max);
+		if(img->data == NULL)
+		{
+			perror("realloc");
+			exit(EXIT_FAILURE);
+		}
+	}
+	img->data[img->size++] = byte;
+}
+
+static uint8_t color_index(image_t * img, uint16_t color, const char * name)
+{
+	for(uint8_t i = 0; i < img->colors_nb; i++)
+		if(img->palette[i] == color)
+			return i;
+	if(img->colors_nb == COLORS_MAX)
+	{
+		fprintf(stderr, "ecran %s : plus de %d couleurs\n", name, COLORS_MAX);
+		exit(EXIT_FAILURE);
+	}
+	img->palette[img->colors_nb] = color;
+	return img->colors_nb++;
+}
+
+/**
+ * @brief Plage de run pixels : un octet par tranche de RUN_MAX, ou trois octets pour une longue plage
+ */
+static void emit_run(image_t * img, uint8_t index, uint32_t run)
+{
+	uint32_t n;
+
+	while(run)
+	{
+		if(run > 3 * RUN_MAX)
+		{
+			n = run > RUN_LONG ? RUN_LONG : run;
+			emit(img, (uint8_t)(index << 6));
+			emit(img, (uint8_t)(n & 0xFF));
+			emit(img, (uint8_t)(n >> 8));
+		}
+		else
+		{
+			n = run > RUN_MAX ? RUN_MAX : run;
+			emit(img, (uint8_t)(index << 6 | n));
+		}
+		run -= n;
+	}
+}
+
+static void compress(image_t * img, const char * name)
+{
+	uint16_t color = frame[0][0];
+	uint32_t run = 0;
+
+	for(int y = 0; y < HEIGHT; y++)
+		for(int x = 0; x < WIDTH; x++)
+		{
+			if(frame[y][x] != color)
+			{
+				emit_run(img, color_index(img, color, name), run);
+				color = frame[y][x];
+				run = 0;
+			}
+			run++;
+		}
+	emit_run(img, color_index(img, color, name), run);
+}
+
+/* Sorties --------------------------------------------------------------------*/
+
+static void write_ppm(const char * dir, const char * name)
+{
+	char path[512];
+	FILE * f;
+	uint16_t c;
+
+	snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+	f = fopen(path, "wb");
+	if(f == NULL)
+	{
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(f, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+	for(int y = 0; y < HEIGHT; y++)
+		for(int x = 0; x < WIDTH; x++)
+		{
+			c = frame[y][x];
+			fputc(((c >> 11) & 0x1F) * 255 / 31, f);
+			fputc(((c >> 5) & 0x3F) * 255 / 63, f);
+			fputc((c & 0x1F) * 255 / 31, f);
+		}
+	fclose(f);
+}
+
+int main(int argc, char ** argv)
+{
+	static image_t images[NB_ECRANS];
+	const char * preview_dir = NULL;
+	uint32_t total = 0;
+
+	if(argc == 3 && strcmp(argv[1], "-p") == 0)
+		preview_dir = argv[2];
+	else if(argc != 1)
+	{
+		fprintf(stderr, "Utilisation : ecrans_gen [-p dossier] > app/ecrans_images.c\n");
+		return EXIT_FAILURE;
+	}
+
+	for(int e = 0; e < NB_ECRANS; e++)
+	{
+		memset(frame, 0, sizeof(frame));
+		draw(&descriptions_ecrans[e]);
+		compress(&images[e], descriptions_ecrans[e].nom);
+		if(preview_dir)
+			write_ppm(preview_dir, descriptions_ecrans[e].nom);
+		total += images[e].size + 2 * images[e].colors_nb;
+	}
+
+	printf("/**\n");
+	printf(" * @file ecrans_images.c\n");
+	printf(" * @brief Écrans fixes précalculés, compressés en plages (ILI9341_rle_image_t).\n");
+	printf(" *\n");
+	printf(" * Fichier généré par tools/ecrans_gen.c à partir de ecrans.c : ne pas le modifier.\n");
+	printf(" * %d x %d pixels par écran, %u octets non compressés :\n", WIDTH, HEIGHT, WIDTH * HEIGHT * 2);
+	for(int e = 0; e < NB_ECRANS; e++)
+		printf(" * - %s : %u couleurs, %u octets ;\n", descriptions_ecrans[e].nom, images[e].colors_nb, images[e].size);
+	printf(" * soit %u octets de flash.\n", total);
+	printf(" */\n\n");
+	printf("#include \"ecrans.h\"\n\n");
+	printf("#if USE_ECRANS_PRECALCULES\n\n");
+	printf("const uint32_t empreinte_images_ecrans = 0x%08Xu;\n", empreinte_ecrans());
+
+	for(int e = 0; e < NB_ECRANS; e++)
+	{
+		printf("\nstatic const uint16_t palette_%s[] = {", descriptions_ecrans[e].nom);
+		for(int i = 0; i < images[e].colors_nb; i++)
+			printf("%s0x%04X", i ? ", " : "", images[e].palette[i]);
+		printf("};\n\n");
+		printf("static const uint8_t donnees_%s[] = {", descriptions_ecrans[e].nom);
+		for(uint32_t i = 0; i < images[e].size; i++)
+			printf("%s0x%02X%s", i % 16 ? " " : "\n    ", images[e].data[i], i + 1 < images[e].size ? "," : "");
+		printf("\n};\n");
+	}
+
+	printf("\nconst ILI9341_rle_image_t images_ecrans[NB_ECRANS] = {\n");
+	for(int e = 0; e < NB_ECRANS; e++)
+		printf("    {%d, %d, palette_%s, donnees_%s, sizeof(donnees_%s)},\n", WIDTH, HEIGHT,
+				descriptions_ecrans[e].nom, descriptions_ecrans[e].nom, descriptions_ecrans[e].nom);
+	printf("};\n\n");
+	printf("#endif /* USE_ECRANS_PRECALCULES */\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/**
+ *******************************************************************************
+ * @file	flashlog_bench.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Banc d'essai PC (Linux) du journal en flash (stm32g4_flashlog.c) : usure des pages et
+ * 			reprise après coupure d'alimentation, sur la flash simulée de tools/simu/simu_flash.c
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -std=gnu11 -O2 -Wall -Itools/simu/stub -Itools/simu -Iapp -Idrivers/bsp -DFLASHLOG_READ=simu_flash_read_ecc \
+ * 			-o flashlog_bench tools/flashlog_bench.c tools/simu/simu_flash.c drivers/bsp/stm32g4_flashlog.c
+ * Utilisation :
+ * 		flashlog_bench [-n enregistrements] [-c opérations] [-g graine]
+ *
+ * 	-n : enregistrements ajoutés (défaut : 100000)
+ * 	-c : une coupure d'alimentation en moyenne toutes les c programmations ou effacements (défaut : 0, pas de coupure)
+ * 	-g : graine des coupures et des données (défaut : 1)
+ *
+ * L'état tenu en RAM est, comme pour app/scores.c, reconstruit à chaque redémarrage en rejouant le journal :
+ * ici un compteur et une somme. L'enregistrement k porte k et une valeur au hasard ; l'instantané porte le
+ * compteur et la somme. Après chaque coupure, l'état relu doit être celui du dernier ajout terminé
+ * (BSP_FLASHLOG_append a rendu true), ou celui de l'ajout interrompu s'il a été écrit en entier.
+ * Un double mot laissé à moitié écrit par une coupure lève une double erreur ECC à sa lecture, comme sur la cible
+ * (cf. simu_flash.c) : le journal doit l'ignorer au démarrage suivant au lieu de bloquer.
+ * Code de retour 1 si un état relu diffère, ou si un ajout échoue sans coupure.
+ */
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "simu.h"
+#include "stm32g4_flashlog.h"
+
+#define SNAPSHOT_FLAG		(1ULL << 47)
+#define FIELD_MASK			0xFFFFFFULL			//Compteur et valeur sur 24 bits (23 pour le compteur)
+
+typedef struct
+{
+	uint32_t count;
+	uint32_t sum;
+}state_t;
+
+static state_t ram;					//État de l'application, reconstruit au démarrage
+static uint32_t out_of_order = 0;	//Enregistrements rejoués hors de l'ordre attendu
+static jmp_buf reboot;
+static uint32_t rng_state;
+
+static uint32_t random32(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static void replay(uint64_t payload)
+{
+	uint32_t a = (uint32_t)((payload >> 24) & (FIELD_MASK >> 1));
+	uint32_t b = (uint32_t)(payload & FIELD_MASK);
+
+	if(payload & SNAPSHOT_FLAG)
+	{
+		ram.count = a;
+		ram.sum = b;
+		return;
+	}
+	if(a != ram.count + 1)
+		out_of_order++;
+	ram.count = a;
+	ram.sum = (ram.sum + b) & FIELD_MASK;
+}
+
+static uint16_t snapshot(uint64_t * records, uint16_t max)
+{
+	if(max < 1)
+		return 0;
+	records[0] = SNAPSHOT_FLAG | (uint64_t)ram.count << 24 | ram.sum;
+	return 1;
+}
+
+static void power_cut(void)
+{
+	longjmp(reboot, 1);
+}
+
+static bool same(const state_t * a, const state_t * b)
+{
+	return a->count == b->count && a->sum == b->sum;
+}
+
+int main(int argc, char ** argv)
+{
+	static uint32_t failures = 0, boots = 0;		//Statiques : conservées par longjmp
+	static state_t acked, pending;				//Dernier ajout terminé, ajout en cours
+	static uint64_t worst_ns = 0;
+	static uint32_t appends = 100000, cut_period = 0;
+	uint32_t seed = 1;
+	simu_flash_stats_t fs;
+	flashlog_stats_t ls;
+	uint64_t before_ns;
+	uint32_t e, e_min = UINT32_MAX, e_max = 0;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:c:g:")) != -1)
+	{
+		switch(opt)
+		{
+			case 'n':	appends = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			case 'c':	cut_period = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			case 'g':	seed = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			default:
+				fprintf(stderr, "Utilisation : flashlog_bench [-n enregistrements] [-c opérations] [-g graine]\n");
+				return EXIT_FAILURE;
+		}
+	}
+	if(appends == 0 || appends > (FIELD_MASK >> 1))
+	{
+		fprintf(stderr, "-n : de 1 à %llu\n", FIELD_MASK >> 1);
+		return EXIT_FAILURE;
+	}
+	rng_state = seed ? seed : 1;
+	simu_flash_reset(seed);
+
+	setjmp(reboot);				//Démarrage, puis chaque coupure d'alimentation
+	boots++;
+	simu_flash_set_power_cut(cut_period ? 1 + random32() % (2 * cut_period) : 0, &power_cut);
+	memset(&ram, 0, sizeof(ram));
+	BSP_FLASHLOG_init(&replay, &snapshot);
+	if(!same(&ram, &acked) && !(pending.count && same(&ram, &pending)))
+	{
+		failures++;
+		fprintf(stderr, "démarrage %u : état relu (%u, %06X), attendu (%u, %06X)\n", boots,
+				ram.count, ram.sum, acked.count, acked.sum);
+	}
+	acked = ram;
+	pending.count = 0;
+
+	while(acked.count < appends)
+	{
+		uint32_t value = random32() & FIELD_MASK;
+
+		pending.count = acked.count + 1;
+		pending.sum = (acked.sum + value) & FIELD_MASK;
+		simu_flash_get_stats(&fs);
+		before_ns = fs.busy_ns;
+		if(!BSP_FLASHLOG_append((uint64_t)pending.count << 24 | value))
+		{
+			failures++;
+			fprintf(stderr, "échec de l'ajout %u sans coupure\n", pending.count);
+			break;
+		}
+		ram = pending;
+		acked = pending;
+		pending.count = 0;
+		simu_flash_get_stats(&fs);
+		if(fs.busy_ns - before_ns > worst_ns)
+			worst_ns = fs.busy_ns - before_ns;
+	}
+	simu_flash_set_power_cut(0, NULL);
+
+	simu_flash_get_stats(&fs);
+	BSP_FLASHLOG_get_stats(&ls);
+	printf("%u enregistrements, %u démarrages (%u coupures d'alimentation)\n", appends, boots, fs.power_cuts);
+	printf("journal : %u changements de page, %u enregistrements ignorés (CRC ou ECC), %u hors d'ordre, %u erreurs\n",
+			ls.compactions, ls.corrupted, out_of_order, ls.errors);
+	printf("flash : %u programmations, %u effacements, %u déverrouillages, %u doubles erreurs ECC lues, %.1f s d'opérations (pire ajout : %.2f ms)\n",
+			fs.programs, fs.erases, fs.unlocks, fs.ecc_errors, fs.busy_ns / 1e9, worst_ns / 1e6);
+	for(uint16_t page = 0; page < FLASHLOG_PAGES_NB; page++)
+	{
+		e = simu_flash_get_erase_count(FLASHLOG_FIRST_PAGE + page);
+		e_min = e < e_min ? e : e_min;
+		e_max = e > e_max ? e : e_max;
+		printf("\tpage %u : %u effacements\n", FLASHLOG_FIRST_PAGE + page, e);
+	}
+	printf("usure : %u à %u effacements par page, soit %.1f enregistrements par effacement\n",
+			e_min, e_max, (double)appends / (fs.erases ? fs.erases : 1));
+	printf("avec BSP_FLASH_set_doubleword (effacement et réécriture de la page) : jusqu'à %u effacements d'une seule page\n",
+			appends);
+	printf("%s\n", failures ? "ÉCHEC" : "OK");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
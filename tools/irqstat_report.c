@@ -0,0 +1,241 @@
+/**
+ *******************************************************************************
+ * @file	irqstat_report.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Mise en forme PC (Linux) des statistiques d'interruptions écrites par BSP_IRQSTAT_dump()
+ * 			(cf. drivers/bsp/stm32g4_irqstat.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -o irqstat_report tools/irqstat_report.c
+ * Utilisation :
+ * 		irqstat_report [-b bauds] console.txt		(ou '-' pour lire l'entrée standard)
+ *
+ * Les lignes du dump peuvent être mêlées au reste de la console : seul le dernier dump complet
+ * (de la ligne "IRQSTAT" à la ligne "END") est analysé.
+ * Les sections masquées et latences plus longues que la durée d'un octet sur l'UART sont signalées :
+ * elles peuvent faire perdre des octets en réception.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOURCES_MAX		32
+#define HISTO_MAX		32
+#define NAME_MAX_LEN	32
+#define LINE_MAX_LEN	512
+
+typedef struct
+{
+	char name[NAME_MAX_LEN];
+	unsigned long count, nested, max_duration, max_latency;
+	unsigned long duration[HISTO_MAX];
+	unsigned long latency[HISTO_MAX];
+}source_t;
+
+typedef struct
+{
+	int mhz, shift, nb, max_depth;
+	source_t sources[SOURCES_MAX];
+	int sources_nb;
+	unsigned long mask_count, mask_longest;
+	char mask_site[LINE_MAX_LEN];
+	unsigned long mask_histo[HISTO_MAX];
+}dump_t;
+
+static dump_t current;
+static dump_t last;
+static int in_dump = 0;
+static int complete = 0;
+
+static source_t * find_source(const char * name)
+{
+	for(int i = 0; i < current.sources_nb; i++)
+		if(!strcmp(current.sources[i].name, name))
+			return &current.sources[i];
+	return NULL;
+}
+
+static int parse_histo(const char * p, unsigned long * histo)
+{
+	char * end;
+	for(int k = 0; k < current.nb; k++)
+	{
+		histo[k] = strtoul(p, &end, 10);
+		if(end == p)
+			return -1;
+		p = end;
+	}
+	return 0;
+}
+
+static void parse_line(const char * line)
+{
+	char name[NAME_MAX_LEN];
+	int offset;
+	source_t * s;
+
+	if(sscanf(line, "IRQSTAT %d %d %d %d", &current.mhz, &current.shift, &current.nb, &current.max_depth) == 4)
+	{
+		current.sources_nb = 0;
+		current.mask_count = current.mask_longest = 0;
+		in_dump = (current.nb > 0 && current.nb <= HISTO_MAX && current.mhz > 0);
+		return;
+	}
+	if(!in_dump)
+		return;
+	if(!strncmp(line, "END", 3))
+	{
+		last = current;
+		complete = 1;
+		in_dump = 0;
+	}
+	else if(!strncmp(line, "IRQ ", 4) && current.sources_nb < SOURCES_MAX)
+	{
+		s = &current.sources[current.sources_nb];
+		memset(s, 0, sizeof(*s));
+		if(sscanf(line, "IRQ %31s %lu %lu %lu %lu", s->name, &s->count, &s->nested, &s->max_duration, &s->max_latency) == 5)
+			current.sources_nb++;
+	}
+	else if(sscanf(line, "DUR %31s %n", name, &offset) == 1 && (s = find_source(name)))
+		parse_histo(line + offset, s->duration);
+	else if(sscanf(line, "LAT %31s %n", name, &offset) == 1 && (s = find_source(name)))
+		parse_histo(line + offset, s->latency);
+	else if(sscanf(line, "MASK %lu %lu %511s", &current.mask_count, &current.mask_longest, current.mask_site) == 3)
+		;
+	else if(!strncmp(line, "MSK", 3))
+		parse_histo(line + 3, current.mask_histo);
+}
+
+static double to_us(unsigned long cycles)
+{
+	return (double)cycles / last.mhz;
+}
+
+/**
+ * @brief Borne haute (en cycles) de la case contenant le centile demandé ; la dernière case est bornée par le maximum
+ */
+static unsigned long percentile(const unsigned long * histo, double p, unsigned long max)
+{
+	unsigned long total = 0, sum = 0;
+	for(int k = 0; k < last.nb; k++)
+		total += histo[k];
+	if(total == 0)
+		return 0;
+	for(int k = 0; k < last.nb - 1; k++)
+	{
+		sum += histo[k];
+		if(sum >= p * total)
+			return ((1ul << (k + last.shift)) < max) ? (1ul << (k + last.shift)) : max;
+	}
+	return max;
+}
+
+static void print_histo(const char * title, const unsigned long * histo)
+{
+	unsigned long total = 0, peak = 0;
+	for(int k = 0; k < last.nb; k++)
+	{
+		total += histo[k];
+		if(histo[k] > peak)
+			peak = histo[k];
+	}
+	if(total == 0)
+		return;
+	printf("    %s\n", title);
+	for(int k = 0; k < last.nb; k++)
+	{
+		if(histo[k] == 0)
+			continue;
+		if(k == 0)
+			printf("      %10s < %8.2f us", "", to_us(1ul << last.shift));
+		else if(k == last.nb - 1)
+			printf("      %10s >= %7.2f us", "", to_us(1ul << (k + last.shift - 1)));
+		else
+			printf("      %8.2f .. %8.2f us", to_us(1ul << (k + last.shift - 1)), to_us(1ul << (k + last.shift)));
+		printf(" %10lu ", histo[k]);
+		for(unsigned long n = 0; n < (histo[k] * 40 + peak - 1) / peak; n++)
+			putchar('#');
+		putchar('\n');
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	char line[LINE_MAX_LEN];
+	unsigned long bauds = 115200;
+	const char * path = NULL;
+	double byte_us;
+	FILE * in;
+	int warnings = 0;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-b") && i + 1 < argc)
+			bauds = strtoul(argv[++i], NULL, 10);
+		else
+			path = argv[i];
+	}
+	if(!path || bauds == 0)
+	{
+		fprintf(stderr, "usage : %s [-b bauds] console.txt|-\n", argv[0]);
+		return 1;
+	}
+	in = strcmp(path, "-") ? fopen(path, "r") : stdin;
+	if(!in)
+	{
+		perror(path);
+		return 1;
+	}
+	while(fgets(line, sizeof(line), in))
+		parse_line(line);
+	if(!complete)
+	{
+		fprintf(stderr, "aucun dump complet (IRQSTAT ... END) trouvé\n");
+		return 1;
+	}
+
+	byte_us = 10e6 / bauds;		//1 start + 8 données + 1 stop
+	printf("Horloge %d MHz, imbrication maximale : %d routine(s)\n\n", last.mhz, last.max_depth);
+	printf("%-10s %10s %8s | %9s %9s %9s | %9s %9s %9s\n", "IRQ", "count", "nested",
+			"dur p50", "dur p99", "dur max", "lat p50", "lat p99", "lat max");
+	for(int i = 0; i < last.sources_nb; i++)
+	{
+		source_t * s = &last.sources[i];
+		printf("%-10s %10lu %8lu | %9.2f %9.2f %9.2f |", s->name, s->count, s->nested,
+				to_us(percentile(s->duration, 0.5, s->max_duration)), to_us(percentile(s->duration, 0.99, s->max_duration)),
+				to_us(s->max_duration));
+		if(s->max_latency)
+			printf(" %9.2f %9.2f %9.2f\n", to_us(percentile(s->latency, 0.5, s->max_latency)),
+					to_us(percentile(s->latency, 0.99, s->max_latency)), to_us(s->max_latency));
+		else
+			printf(" %9s %9s %9s\n", "-", "-", "-");
+	}
+	printf("(durées propres et latences en us ; p50/p99 : borne haute de la case de l'histogramme)\n\n");
+
+	printf("Sections IT masquées : %lu, la plus longue : %.2f us dans %s\n", last.mask_count, to_us(last.mask_longest), last.mask_site);
+	print_histo("durée des sections masquées", last.mask_histo);
+	printf("\n");
+
+	for(int i = 0; i < last.sources_nb; i++)
+	{
+		source_t * s = &last.sources[i];
+		printf("  %s\n", s->name);
+		print_histo("durée", s->duration);
+		print_histo("latence", s->latency);
+		if(to_us(s->max_latency) > byte_us)
+		{
+			printf("    ! latence max > 1 octet UART (%.1f us à %lu bauds)\n", byte_us, bauds);
+			warnings++;
+		}
+	}
+	if(to_us(last.mask_longest) > byte_us)
+	{
+		printf("\n! la section masquée de %s (%.2f us) dure plus d'un octet UART à %lu bauds (%.1f us) : "
+				"des octets reçus peuvent être perdus\n", last.mask_site, to_us(last.mask_longest), bauds, byte_us);
+		warnings++;
+	}
+	return warnings ? 2 : 0;
+}
@@ -0,0 +1,241 @@
+/**
+ *******************************************************************************
+ * @file	kvstore_bench.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Banc d'essai PC (Linux) du stockage clé-valeur en flash (stm32g4_kvstore.c) : endurance,
+ * 			durée des écritures et reprise après coupure d'alimentation, sur la flash simulée de tools/simu/simu_flash.c
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -std=gnu11 -O2 -Wall -Itools/simu/stub -Itools/simu -Iapp -Idrivers/bsp -DKVSTORE_READ=simu_flash_read_ecc \
+ * 			-o kvstore_bench tools/kvstore_bench.c tools/simu/simu_flash.c drivers/bsp/stm32g4_kvstore.c
+ * Utilisation :
+ * 		kvstore_bench [-n écritures] [-k clés] [-l octets] [-d %] [-c opérations] [-g graine]
+ *
+ * 	-n : écritures (défaut : 100000)
+ * 	-k : clés écrites, au hasard (défaut : 16, KVSTORE_KEYS_MAX au plus)
+ * 	-l : longueur des valeurs ; 8 (défaut) : valeurs de 64 bits, comme BSP_FLASH_set_doubleword ;
+ * 	     sinon de 0 à l octets au hasard (KVSTORE_VALUE_MAX au plus)
+ * 	-d : pourcentage de suppressions parmi les écritures (défaut : 0)
+ * 	-c : une coupure d'alimentation en moyenne toutes les c programmations ou effacements (défaut : 0, pas de coupure)
+ * 	-g : graine des coupures et des données (défaut : 1)
+ *
+ * Après chaque coupure, le stockage est relu (BSP_KVSTORE_init, comme au démarrage) et comparé clé par clé
+ * au modèle tenu par l'outil : chaque clé doit avoir la valeur de sa dernière écriture terminée, sauf la clé
+ * en cours d'écriture, qui peut aussi avoir la nouvelle valeur.
+ * Un double mot laissé à moitié écrit ou effacé par une coupure lève une double erreur ECC à sa lecture, comme sur
+ * la cible (cf. simu_flash.c) : le stockage doit l'ignorer au démarrage suivant au lieu de bloquer.
+ * Avec -l 8, la même suite d'écritures est aussi comptée pour l'ancien BSP_FLASH_set_doubleword
+ * (effacement de la page et restitution des autres cases dès qu'un bit doit repasser à 1).
+ * Code de retour 1 si une valeur relue diffère, ou si une écriture échoue sans coupure.
+ */
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "simu.h"
+#include "stm32g4_kvstore.h"
+
+#define KEY(i)				((uint16_t)(0x0100 + (i)))
+#define PROGRAM_NS			81690		//Comme simu_flash.c
+#define ERASE_NS			22020000
+#define LEGACY_SLOTS		256			//Cases de stm32g4_flash.c
+
+typedef struct
+{
+	int32_t length;					//-1 : clé absente
+	uint8_t data[KVSTORE_VALUE_MAX];
+}value_t;
+
+static value_t model[KVSTORE_KEYS_MAX];		//Dernière écriture terminée de chaque clé
+static value_t pending;						//Écriture en cours
+static int32_t pending_key = -1;
+static jmp_buf reboot;
+static uint32_t rng_state;
+
+static uint32_t random32(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static void power_cut(void)
+{
+	longjmp(reboot, 1);
+}
+
+static bool stored_equals(uint16_t key, const value_t * v)
+{
+	static uint8_t data[KVSTORE_VALUE_MAX];
+	int32_t length = BSP_KVSTORE_get(key, data, sizeof(data));
+
+	return length == v->length && (length <= 0 || memcmp(data, v->data, (size_t)length) == 0);
+}
+
+static int compare_ns(const void * a, const void * b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+int main(int argc, char ** argv)
+{
+	static uint32_t failures = 0, boots = 0, done = 0;		//Statiques : conservées par longjmp
+	static uint64_t legacy[LEGACY_SLOTS], legacy_ns = 0, legacy_worst_ns = 0;
+	static uint32_t legacy_erases = 0;
+	static uint64_t * durations;
+	volatile uint32_t writes = 100000, keys = 16, max_length = 8, deletes = 0, cut_period = 0;	//Volatiles : lues après longjmp
+	volatile uint64_t total_ns = 0;
+	volatile uint32_t e_min = UINT32_MAX, e_max = 0;
+	uint32_t seed = 1;
+	simu_flash_stats_t fs;
+	kvstore_stats_t ks;
+	uint64_t before_ns;
+	uint32_t e;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:k:l:d:c:g:")) != -1)
+	{
+		switch(opt)
+		{
+			case 'n':	writes = (uint32_t)strtoul(optarg, NULL, 0);		break;
+			case 'k':	keys = (uint32_t)strtoul(optarg, NULL, 0);			break;
+			case 'l':	max_length = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			case 'd':	deletes = (uint32_t)strtoul(optarg, NULL, 0);		break;
+			case 'c':	cut_period = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			case 'g':	seed = (uint32_t)strtoul(optarg, NULL, 0);			break;
+			default:
+				fprintf(stderr, "Utilisation : kvstore_bench [-n écritures] [-k clés] [-l octets] [-d %%] [-c opérations] [-g graine]\n");
+				return EXIT_FAILURE;
+		}
+	}
+	if(writes == 0 || keys == 0 || keys > KVSTORE_KEYS_MAX || max_length > KVSTORE_VALUE_MAX || deletes > 100)
+	{
+		fprintf(stderr, "-n et -k : au moins 1, -k : %d au plus, -l : %d au plus, -d : 100 au plus\n",
+				KVSTORE_KEYS_MAX, KVSTORE_VALUE_MAX);
+		return EXIT_FAILURE;
+	}
+	durations = malloc(writes * sizeof(*durations));
+	if(durations == NULL)
+	{
+		perror("malloc");
+		return EXIT_FAILURE;
+	}
+	memset(legacy, 0xFF, sizeof(legacy));
+	for(uint32_t k = 0; k < KVSTORE_KEYS_MAX; k++)
+		model[k].length = -1;
+	rng_state = seed ? seed : 1;
+	simu_flash_reset(seed);
+
+	setjmp(reboot);				//Démarrage, puis chaque coupure d'alimentation
+	boots++;
+	simu_flash_set_power_cut(cut_period ? 1 + random32() % (2 * cut_period) : 0, &power_cut);
+	BSP_KVSTORE_init();
+	for(uint32_t k = 0; k < keys; k++)
+	{
+		if(stored_equals(KEY(k), &model[k]))
+			continue;
+		if((int32_t)k == pending_key && stored_equals(KEY(k), &pending))
+		{
+			model[k] = pending;			//L'écriture interrompue a été programmée en entier
+			done++;
+			continue;
+		}
+		failures++;
+		fprintf(stderr, "démarrage %u : clé 0x%04X différente de sa dernière écriture\n", boots, KEY(k));
+	}
+	pending_key = -1;
+
+	while(done < writes)
+	{
+		uint32_t k = random32() % keys;
+		bool ok;
+
+		if(random32() % 100 < deletes)
+			pending.length = -1;
+		else
+		{
+			pending.length = (int32_t)(max_length == 8 ? 8 : random32() % (max_length + 1));
+			for(int32_t i = 0; i < pending.length; i++)
+				pending.data[i] = (uint8_t)random32();
+		}
+		pending_key = (int32_t)k;
+		simu_flash_get_stats(&fs);
+		before_ns = fs.busy_ns;
+		if(pending.length < 0)
+			ok = BSP_KVSTORE_delete(KEY(k));
+		else
+			ok = BSP_KVSTORE_set(KEY(k), pending.data, (uint16_t)pending.length);
+		if(!ok)
+		{
+			failures++;
+			fprintf(stderr, "échec de l'écriture %u (clé 0x%04X) sans coupure\n", done + 1, KEY(k));
+			break;
+		}
+		simu_flash_get_stats(&fs);
+		durations[done] = fs.busy_ns - before_ns;
+		model[k] = pending;
+		pending_key = -1;
+		done++;
+
+		if(max_length == 8 && pending.length == 8 && k < LEGACY_SLOTS)		//Ancien BSP_FLASH_set_doubleword
+		{
+			uint64_t v, ns = PROGRAM_NS;
+
+			memcpy(&v, pending.data, 8);
+			if((legacy[k] & v) != v)
+			{
+				legacy_erases++;
+				ns += ERASE_NS;
+				for(uint32_t i = 0; i < LEGACY_SLOTS; i++)
+					if(i != k && legacy[i] != UINT64_MAX)
+						ns += PROGRAM_NS;
+			}
+			legacy[k] = v;
+			legacy_ns += ns;
+			legacy_worst_ns = ns > legacy_worst_ns ? ns : legacy_worst_ns;
+		}
+	}
+	simu_flash_set_power_cut(0, NULL);
+
+	BSP_KVSTORE_init();		//Dernier redémarrage, sans coupure
+	for(uint32_t k = 0; k < keys; k++)
+		if(!stored_equals(KEY(k), &model[k]))
+		{
+			failures++;
+			fprintf(stderr, "fin : clé 0x%04X différente de sa dernière écriture\n", KEY(k));
+		}
+
+	simu_flash_get_stats(&fs);
+	BSP_KVSTORE_get_stats(&ks);
+	for(uint32_t i = 0; i < done; i++)
+		total_ns += durations[i];
+	qsort(durations, done, sizeof(*durations), &compare_ns);
+	printf("%u écritures sur %u clés, %u démarrages (%u coupures d'alimentation)\n", done, keys, boots, fs.power_cuts);
+	printf("stockage : %u clés présentes, %u ramasse-miettes (%u enregistrements recopiés), %u écritures évitées, %u ignorés (CRC ou ECC), %u erreurs\n",
+			ks.keys, ks.collections, ks.copied, ks.unchanged, ks.corrupted, ks.errors);
+	printf("flash : %u programmations, %u effacements, %u déverrouillages (%.2f par écriture), %u doubles erreurs ECC lues\n",
+			fs.programs, fs.erases, fs.unlocks, (double)fs.unlocks / done, fs.ecc_errors);
+	if(done)
+		printf("durée d'une écriture : moyenne %.3f ms, médiane %.3f ms, 99 %% %.3f ms, pire %.2f ms\n",
+				total_ns / 1e6 / done, durations[done / 2] / 1e6, durations[done * 99ULL / 100] / 1e6, durations[done - 1] / 1e6);
+	for(uint16_t page = 0; page < KVSTORE_PAGES_NB; page++)
+	{
+		e = simu_flash_get_erase_count(KVSTORE_FIRST_PAGE + page);
+		e_min = e < e_min ? e : e_min;
+		e_max = e > e_max ? e : e_max;
+		printf("\tpage %u : %u effacements\n", KVSTORE_FIRST_PAGE + page, e);
+	}
+	printf("usure : %u à %u effacements par page, soit %.1f écritures par effacement\n",
+			e_min, e_max, (double)done / (fs.erases ? fs.erases : 1));
+	if(max_length == 8 && deletes == 0 && cut_period == 0)
+		printf("ancien BSP_FLASH_set_doubleword : %u effacements de la page 63, moyenne %.3f ms, pire %.2f ms par écriture\n",
+				legacy_erases, legacy_ns / 1e6 / done, legacy_worst_ns / 1e6);
+	printf("%s\n", failures ? "ÉCHEC" : "OK");
+	free(durations);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
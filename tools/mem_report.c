@@ -0,0 +1,232 @@
+/**
+ *******************************************************************************
+ * @file	mem_report.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Bilan PC (Linux) de l'occupation de la RAM, à partir du fichier .elf
+ * 			(complète les mesures faites sur la cible par drivers/bsp/stm32g4_memwatch.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -o mem_report tools/mem_report.c
+ * Utilisation :
+ * 		mem_report [-n nb] firmware.elf [fichiers .su...]
+ * 		mem_report Debug/firmware.elf $(find Debug -name '*.su')
+ *
+ * Affiche les sections chargées en RAM, la place laissée au tas et à la pile par le script d'édition de liens
+ * (_end, _estack, _Min_Stack_Size, _Min_Heap_Size), l'occupation de .data + .bss par rapport au budget
+ * _Static_Ram_Budget (code de retour 2 s'il est dépassé) et les plus gros objets en RAM.
+ * Les fichiers .su (option -fstack-usage du compilateur, "Generate per function stack usage information"
+ * dans STM32CubeIDE) donnent en plus les fonctions aux plus gros cadres de pile.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <elf.h>
+
+#define RAM_BASE		0x20000000u
+#define CCMSRAM_BASE	0x10000000u
+#define CCMSRAM_SIZE	0x2800u
+#define NAME_MAX_LEN	128
+#define LINE_MAX_LEN	512
+
+typedef struct
+{
+	char name[NAME_MAX_LEN];
+	uint32_t addr;
+	uint32_t size;
+}object_t;
+
+static object_t * objects = NULL;
+static int objects_nb = 0;
+static object_t * frames = NULL;
+static int frames_nb = 0;
+
+static int is_ram(uint32_t addr)
+{
+	return (addr >= RAM_BASE && addr < RAM_BASE + 0x01000000u) || (addr >= CCMSRAM_BASE && addr < CCMSRAM_BASE + CCMSRAM_SIZE);
+}
+
+static void add(object_t ** table, int * nb, const char * name, uint32_t addr, uint32_t size)
+{
+	*table = realloc(*table, (*nb + 1) * sizeof(object_t));
+	snprintf((*table)[*nb].name, NAME_MAX_LEN, "%s", name);
+	(*table)[*nb].addr = addr;
+	(*table)[*nb].size = size;
+	(*nb)++;
+}
+
+static int by_size(const void * a, const void * b)
+{
+	uint32_t sa = ((const object_t *)a)->size;
+	uint32_t sb = ((const object_t *)b)->size;
+	return (sa < sb) - (sa > sb);
+}
+
+/**
+ * @brief Valeur d'un symbole (0 s'il est absent)
+ */
+static uint32_t symbol(const Elf32_Sym * syms, int nb, const char * strtab, const char * name)
+{
+	for(int i = 0; i < nb; i++)
+		if(!strcmp(strtab + syms[i].st_name, name))
+			return syms[i].st_value;
+	return 0;
+}
+
+/**
+ * @brief Lit un fichier .su : "fichier.c:ligne:colonne:fonction<TAB>octets<TAB>static|dynamic|bounded"
+ */
+static void load_su(const char * path)
+{
+	char line[LINE_MAX_LEN];
+	char * tab;
+	char * name;
+	FILE * f = fopen(path, "r");
+
+	if(!f)
+	{
+		perror(path);
+		return;
+	}
+	while(fgets(line, sizeof(line), f))
+	{
+		tab = strchr(line, '\t');
+		if(!tab)
+			continue;
+		*tab = '\0';
+		name = strrchr(line, ':');
+		add(&frames, &frames_nb, name ? name + 1 : line, 0, (uint32_t)strtoul(tab + 1, NULL, 10));
+	}
+	fclose(f);
+}
+
+int main(int argc, char ** argv)
+{
+	const char * path = NULL;
+	int shown = 15;
+	FILE * f;
+	Elf32_Ehdr eh;
+	Elf32_Shdr * sh;
+	Elf32_Sym * syms = NULL;
+	char * shstr;
+	char * strtab = NULL;
+	int syms_nb = 0;
+	uint32_t ram = 0;
+	uint32_t estack, end, min_stack, min_heap;
+	uint32_t statics, budget;
+	long free_bytes;
+	int status = 0;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-n") && i + 1 < argc)
+			shown = atoi(argv[++i]);
+		else if(strlen(argv[i]) > 3 && !strcmp(argv[i] + strlen(argv[i]) - 3, ".su"))
+			load_su(argv[i]);
+		else
+			path = argv[i];
+	}
+	if(!path)
+	{
+		fprintf(stderr, "usage : %s [-n nb] firmware.elf [fichiers .su...]\n", argv[0]);
+		return 1;
+	}
+	f = fopen(path, "rb");
+	if(!f)
+	{
+		perror(path);
+		return 1;
+	}
+	if(fread(&eh, sizeof(eh), 1, f) != 1 || memcmp(eh.e_ident, ELFMAG, SELFMAG) || eh.e_ident[EI_CLASS] != ELFCLASS32)
+	{
+		fprintf(stderr, "%s : fichier ELF32 attendu\n", path);
+		return 1;
+	}
+	sh = calloc(eh.e_shnum, sizeof(Elf32_Shdr));
+	fseek(f, eh.e_shoff, SEEK_SET);
+	if(fread(sh, sizeof(Elf32_Shdr), eh.e_shnum, f) != eh.e_shnum)
+	{
+		fprintf(stderr, "%s : table des sections illisible\n", path);
+		return 1;
+	}
+	shstr = malloc(sh[eh.e_shstrndx].sh_size);
+	fseek(f, sh[eh.e_shstrndx].sh_offset, SEEK_SET);
+	if(fread(shstr, 1, sh[eh.e_shstrndx].sh_size, f) != sh[eh.e_shstrndx].sh_size)
+		return 1;
+
+	printf("Sections en RAM :\n");
+	for(int i = 0; i < eh.e_shnum; i++)
+	{
+		if((sh[i].sh_flags & SHF_ALLOC) && sh[i].sh_size && is_ram(sh[i].sh_addr))
+		{
+			printf("  %-24s 0x%08x %8u octets%s\n", shstr + sh[i].sh_name, sh[i].sh_addr, sh[i].sh_size,
+					(sh[i].sh_type == SHT_NOBITS) ? "" : " (recopiés depuis la flash au démarrage)");
+			ram += sh[i].sh_size;
+		}
+		if(sh[i].sh_type == SHT_SYMTAB)
+		{
+			syms_nb = sh[i].sh_size / sizeof(Elf32_Sym);
+			syms = malloc(sh[i].sh_size);
+			strtab = malloc(sh[sh[i].sh_link].sh_size);
+			fseek(f, sh[i].sh_offset, SEEK_SET);
+			if(fread(syms, sizeof(Elf32_Sym), syms_nb, f) != (size_t)syms_nb)
+				return 1;
+			fseek(f, sh[sh[i].sh_link].sh_offset, SEEK_SET);
+			if(fread(strtab, 1, sh[sh[i].sh_link].sh_size, f) != sh[sh[i].sh_link].sh_size)
+				return 1;
+		}
+	}
+	fclose(f);
+	if(!syms)
+	{
+		fprintf(stderr, "%s : pas de table des symboles (fichier strippé ?)\n", path);
+		return 1;
+	}
+
+	estack = symbol(syms, syms_nb, strtab, "_estack");
+	end = symbol(syms, syms_nb, strtab, "_end");
+	min_stack = symbol(syms, syms_nb, strtab, "_Min_Stack_Size");
+	min_heap = symbol(syms, syms_nb, strtab, "_Min_Heap_Size");
+	printf("  %-24s %19u octets\n\n", "total", ram);
+	if(estack && end)
+	{
+		free_bytes = (long)estack - (long)end - (long)min_stack;
+		printf("RAM : 0x%08x .. 0x%08x (%u octets)\n", RAM_BASE, estack, estack - RAM_BASE);
+		printf("  données statiques : %u octets (jusqu'à _end = 0x%08x)\n", end - RAM_BASE, end);
+		printf("  réserve de pile   : %u octets (_Min_Stack_Size)\n", min_stack);
+		printf("  réserve de tas    : %u octets (_Min_Heap_Size, vérifiée à l'édition de liens seulement)\n", min_heap);
+		printf("  libre pour le tas : %ld octets ; la pile peut aussi y déborder (cf. BSP_MEMWATCH_dump)\n\n", free_bytes);
+		if(free_bytes < 0)
+			status = 2;
+	}
+	budget = symbol(syms, syms_nb, strtab, "_Static_Ram_Budget");
+	if(budget)
+	{
+		statics = (symbol(syms, syms_nb, strtab, "_edata") - symbol(syms, syms_nb, strtab, "_sdata"))
+				+ (symbol(syms, syms_nb, strtab, "_ebss") - symbol(syms, syms_nb, strtab, "_sbss"));
+		printf(".data + .bss : %u octets sur un budget de %u (_Static_Ram_Budget)%s\n\n", statics, budget,
+				(statics > budget) ? "   ! budget dépassé" : "");
+		if(statics > budget)
+			status = 2;
+	}
+
+	for(int i = 0; i < syms_nb; i++)
+		if(ELF32_ST_TYPE(syms[i].st_info) == STT_OBJECT && syms[i].st_size && is_ram(syms[i].st_value))
+			add(&objects, &objects_nb, strtab + syms[i].st_name, syms[i].st_value, syms[i].st_size);
+	qsort(objects, objects_nb, sizeof(object_t), by_size);
+	printf("Plus gros objets en RAM :\n");
+	for(int i = 0; i < objects_nb && i < shown; i++)
+		printf("  %8u  0x%08x  %s\n", objects[i].size, objects[i].addr, objects[i].name);
+
+	if(frames_nb)
+	{
+		qsort(frames, frames_nb, sizeof(object_t), by_size);
+		printf("\nPlus gros cadres de pile (fichiers .su) :\n");
+		for(int i = 0; i < frames_nb && i < shown; i++)
+			printf("  %8u  %s%s\n", frames[i].size, frames[i].name,
+					(min_stack && frames[i].size > min_stack / 2) ? "   ! plus de la moitié de _Min_Stack_Size" : "");
+	}
+	return status;
+}
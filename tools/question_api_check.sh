@@ -0,0 +1,41 @@
+#!/bin/sh
+#*******************************************************************************
+# @file		question_api_check.sh
+# @author	hugog
+# @date		Oct 18, 2026
+# @brief	Vérification PC (Linux) : aucune fonction de app/ ne prend ni ne renvoie une Question par valeur
+#*******************************************************************************
+# Utilisation (depuis la racine du dépôt) :
+# 		sh tools/question_api_check.sh
+#
+# Chaque fichier de app/ est compilé pour le PC comme par le simulateur (en-têtes de tools/simu/stub) ;
+# gcc -aux-info écrit alors le prototype de chaque fonction déclarée ou définie, statiques comprises,
+# avec les types tels que le compilateur les voit (typedef conservés, noms des paramètres retirés).
+# Tout prototype où Question n'est pas suivi de * est une recopie de la structure à chaque appel :
+# la fonction doit prendre un const Question * (cf. app/question.h).
+# Les fichiers sont compilés avec app/config.h tel quel : un module désactivé (USE_xxx à 0) n'est pas vérifié.
+# Code de retour 1 si un tel prototype est trouvé ou si un fichier ne compile pas.
+
+CFLAGS="-std=gnu11 -Itools/simu/stub -Itools/simu -Iapp -Idrivers/bsp -DFLASHLOG_READ=simu_flash_read_ecc"
+AUX=$(mktemp) || exit 1
+trap 'rm -f "$AUX"' EXIT
+status=0
+
+for source in app/*.c; do
+	if ! gcc $CFLAGS -fsyntax-only -aux-info "$AUX" "$source"; then
+		echo "$source : ne compile pas" >&2
+		status=1
+		continue
+	fi
+	# Prototypes de app/ (le commentaire d'en-tête donne le fichier, celui de fin les paramètres nommés)
+	if grep '^/\* app/' "$AUX" | sed 's|^/\* \([^ ]*\) \*/ \([^;]*\);.*|\1 \2|' | grep -E '\bQuestion\b *([^ *]|$)'; then
+		status=1
+	fi
+done
+
+if [ $status -eq 0 ]; then
+	echo "OK : aucune Question passée par valeur"
+else
+	echo "ÉCHEC : Question passée ou renvoyée par valeur (ci-dessus), utiliser const Question *" >&2
+fi
+exit $status
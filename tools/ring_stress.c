@@ -0,0 +1,248 @@
+/**
+ *******************************************************************************
+ * @file	ring_stress.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Test de charge PC (Linux, pthreads) des files sans verrou : SPSC (drivers/bsp/stm32g4_ring.h)
+ * 			et MPSC (drivers/bsp/stm32g4_mpsc.h, file d'évènements de l'ordonnanceur)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -std=gnu11 -O2 -Wall -Wextra -pthread -Idrivers/bsp -o ring_stress tools/ring_stress.c
+ * 		(ou avec -fsanitize=thread à la place de -O2, pour que ThreadSanitizer vérifie aussi les barrières)
+ * Utilisation :
+ * 		ring_stress [-n éléments] [-p producteurs] [-s taille]
+ *
+ * 	-n : éléments envoyés par chaque producteur (défaut : 1000000)
+ * 	-p : producteurs de la file MPSC (défaut : 4)
+ * 	-s : taille des files, puissance de 2 (défaut : 8 ; petite, pour que les files soient souvent pleines)
+ *
+ * Un thread par producteur et un pour le consommateur, chacun sur sa propre file d'exécution :
+ * sur PC les accès sont réellement simultanés, ce qui est plus dur que sur la cible (une IT interrompt l'autre).
+ * 	- SPSC : un producteur, un consommateur. Chaque élément porte son numéro et des données qui en dépendent :
+ * 	  le consommateur vérifie qu'aucun élément n'est perdu, dupliqué, déplacé, ni lu à moitié écrit.
+ * 	  push/pop et write_slot/publish, read_slot/release sont utilisés en alternance.
+ * 	- MPSC : -p producteurs, un consommateur, éléments du type de la file de l'ordonnanceur (event_t).
+ * 	  Pour chaque producteur, le consommateur vérifie le nombre d'éléments et leur ordre.
+ * 	  Les refus (file pleine) sont recomptés et comparés au compteur lost de la file.
+ * Code de retour 1 si une vérification échoue.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stm32g4_ring.h"
+#include "stm32g4_mpsc.h"
+
+#define PRODUCERS_MAX		32
+#define PAYLOAD_WORDS		15				//Élément SPSC de 64 octets, comme une petite trame
+
+typedef struct
+{
+	uint32_t sequence;
+	uint32_t payload[PAYLOAD_WORDS];
+}frame_t;
+
+typedef struct						//Comme event_t de stm32g4_scheduler.c
+{
+	uint8_t event;						//Producteur
+	uint32_t param;						//Numéro de l'élément chez ce producteur
+}event_t;
+
+RING_DEFINE(frame_ring, frame_t)
+MPSC_DEFINE(event_queue, event_t)
+
+static uint32_t items = 1000000;
+static uint32_t producers = 4;
+
+static frame_ring_t ring;
+static event_queue_t queue;
+static uint32_t refused[PRODUCERS_MAX];		//Refus (file pleine) vus par chaque producteur MPSC
+
+static uint32_t payload_word(uint32_t sequence, uint32_t i)
+{
+	return sequence * 2654435761u + i;
+}
+
+static void * spsc_producer(void * arg)
+{
+	frame_t f;
+	frame_t * slot;
+
+	(void)arg;
+	for(uint32_t s = 0; s < items; s++)
+	{
+		if(s & 1)				//Sans recopie
+		{
+			while((slot = frame_ring_write_slot(&ring)) == NULL)
+				sched_yield();
+			slot->sequence = s;
+			for(uint32_t i = 0; i < PAYLOAD_WORDS; i++)
+				slot->payload[i] = payload_word(s, i);
+			frame_ring_publish(&ring);
+		}
+		else
+		{
+			f.sequence = s;
+			for(uint32_t i = 0; i < PAYLOAD_WORDS; i++)
+				f.payload[i] = payload_word(s, i);
+			while(!frame_ring_push(&ring, &f))
+				sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static uint32_t spsc_consume(void)
+{
+	uint32_t errors = 0, expected = 0;
+	frame_t f;
+	const frame_t * p;
+
+	while(expected < items)
+	{
+		if(expected & 2)			//Sans recopie
+		{
+			p = frame_ring_read_slot(&ring);
+			if(p == NULL)
+			{
+				sched_yield();
+				continue;
+			}
+			f = *p;
+			frame_ring_release(&ring);
+		}
+		else if(!frame_ring_pop(&ring, &f))
+		{
+			sched_yield();
+			continue;
+		}
+		if(f.sequence != expected)
+		{
+			if(errors++ < 10)
+				fprintf(stderr, "SPSC : élément %u reçu, %u attendu\n", f.sequence, expected);
+			expected = f.sequence;
+		}
+		for(uint32_t i = 0; i < PAYLOAD_WORDS; i++)
+			if(f.payload[i] != payload_word(f.sequence, i))
+			{
+				if(errors++ < 10)
+					fprintf(stderr, "SPSC : élément %u lu à moitié écrit\n", f.sequence);
+				break;
+			}
+		expected++;
+	}
+	if(!frame_ring_is_empty(&ring))
+	{
+		errors++;
+		fprintf(stderr, "SPSC : %u éléments en trop dans la file\n", frame_ring_count(&ring));
+	}
+	return errors;
+}
+
+static void * mpsc_producer(void * arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	event_t e = { .event = (uint8_t)id };
+
+	for(uint32_t s = 0; s < items; s++)
+	{
+		e.param = s;
+		while(!event_queue_post(&queue, &e))
+		{
+			refused[id]++;
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static uint32_t mpsc_consume(void)
+{
+	static uint32_t expected[PRODUCERS_MAX];
+	uint32_t errors = 0, received = 0, lost = 0;
+	event_t e;
+
+	while(received < items * producers)
+	{
+		if(!event_queue_pop(&queue, &e))
+		{
+			sched_yield();
+			continue;
+		}
+		received++;
+		if(e.event >= producers)
+		{
+			if(errors++ < 10)
+				fprintf(stderr, "MPSC : producteur %u inconnu\n", e.event);
+			continue;
+		}
+		if(e.param != expected[e.event])
+		{
+			if(errors++ < 10)
+				fprintf(stderr, "MPSC : producteur %u, élément %u reçu, %u attendu\n", e.event, e.param, expected[e.event]);
+		}
+		expected[e.event] = e.param + 1;
+	}
+	for(uint32_t p = 0; p < producers; p++)
+	{
+		lost += refused[p];
+		if(expected[p] != items)
+		{
+			errors++;
+			fprintf(stderr, "MPSC : producteur %u, dernier élément reçu %u sur %u\n", p, expected[p], items);
+		}
+	}
+	if(!event_queue_is_empty(&queue) || event_queue_get_lost(&queue) != lost)
+	{
+		errors++;
+		fprintf(stderr, "MPSC : file non vide, ou %u refus comptés par la file pour %u vus par les producteurs\n",
+				event_queue_get_lost(&queue), lost);
+	}
+	printf("MPSC : %u producteurs, %u éléments reçus, %u refus (file pleine)\n", producers, received, lost);
+	return errors;
+}
+
+int main(int argc, char ** argv)
+{
+	static frame_t frames[1024];
+	static event_queue_slot_t slots[1024];
+	pthread_t threads[PRODUCERS_MAX];
+	uint32_t size = 8, errors;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:p:s:")) != -1)
+	{
+		switch(opt)
+		{
+			case 'n':	items = (uint32_t)strtoul(optarg, NULL, 0);		break;
+			case 'p':	producers = (uint32_t)strtoul(optarg, NULL, 0);	break;
+			case 's':	size = (uint32_t)strtoul(optarg, NULL, 0);		break;
+			default:
+				fprintf(stderr, "Utilisation : ring_stress [-n éléments] [-p producteurs] [-s taille]\n");
+				return EXIT_FAILURE;
+		}
+	}
+	if(items == 0 || producers == 0 || producers > PRODUCERS_MAX || size > 1024
+			|| !frame_ring_init(&ring, frames, size) || !event_queue_init(&queue, slots, size))
+	{
+		fprintf(stderr, "-n : au moins 1, -p : de 1 à %d, -s : puissance de 2, 1024 au plus\n", PRODUCERS_MAX);
+		return EXIT_FAILURE;
+	}
+
+	pthread_create(&threads[0], NULL, &spsc_producer, NULL);
+	errors = spsc_consume();
+	pthread_join(threads[0], NULL);
+	printf("SPSC : %u éléments de %zu octets reçus, file de %u\n", items, sizeof(frame_t), size);
+
+	for(uint32_t p = 0; p < producers; p++)
+		pthread_create(&threads[p], NULL, &mpsc_producer, (void *)(uintptr_t)p);
+	errors += mpsc_consume();
+	for(uint32_t p = 0; p < producers; p++)
+		pthread_join(threads[p], NULL);
+
+	printf("%s\n", errors ? "ÉCHEC" : "OK");
+	return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
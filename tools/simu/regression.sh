@@ -0,0 +1,79 @@
+#!/bin/sh
+#*******************************************************************************
+# @file		regression.sh
+# @author	hugog
+# @date		Oct 18, 2026
+# @brief	Non-régression de l'affichage (Linux) : chaque scénario de tools/simu/scenarios est joué par le
+# 			simulateur, et chacune de ses captures est comparée à l'image de référence de tools/simu/references
+#*******************************************************************************
+# Utilisation (depuis la racine du dépôt) :
+# 		sh tools/simu/regression.sh			compare les captures aux références ; code de retour 1 si une diffère
+# 		sh tools/simu/regression.sh -u		remplace les références par les captures (après un changement voulu
+# 											de l'affichage : vérifier les images avant de les enregistrer)
+#
+# Le simulateur est compilé avec la ligne de commande de tools/simu/simu.c, dans un dossier temporaire.
+# Les scénarios n'ont que des captures nommées (option -s du simulateur : pas de capture automatique),
+# sur la graine 1 et une mémoire flash vierge : les images ne dépendent que du code de app/ et du BSP.
+# Les références sont enregistrées compressées (scenario/capture.ppm.gz, quelques ko par écran).
+# En cas de différence, les captures restent dans le dossier temporaire indiqué, à comparer aux références
+# (« convert capture.ppm capture.png » pour un PNG).
+
+SIMU_DIR=tools/simu
+NO_AUTO_CAPTURE=4000000000
+
+update=0
+if [ "$1" = "-u" ]; then
+	update=1
+elif [ $# -ne 0 ]; then
+	echo "Utilisation : sh $SIMU_DIR/regression.sh [-u]" >&2
+	exit 2
+fi
+
+WORK=$(mktemp -d) && mkdir "$WORK/out" "$WORK/ref" || exit 2
+
+# Ligne de compilation de l'en-tête de simu.c, entre « Compilation : » et « Utilisation : »
+build=$(sed -n '/Compilation :/,/Utilisation :/p' $SIMU_DIR/simu.c | sed '1d;$d' | sed 's/^ \*[ \t]*//; s/\\$//' | tr '\n' ' ')
+if ! eval "$build -o $WORK/simu"; then
+	echo "ÉCHEC : le simulateur ne compile pas" >&2
+	exit 2
+fi
+
+status=0
+for scenario in $SIMU_DIR/scenarios/*.txt; do
+	name=$(basename "$scenario" .txt)
+	references=$SIMU_DIR/references/$name
+	mkdir "$WORK/ref/$name"
+
+	if [ $update -eq 1 ]; then
+		if ! "$WORK/simu" -g 1 -s $NO_AUTO_CAPTURE -o "$WORK/out/$name" "$scenario" > "$WORK/$name.log"; then
+			echo "$name : le scénario n'a pas abouti (cf. $WORK/$name.log)" >&2
+			status=1
+			continue
+		fi
+		rm -rf "$references"
+		mkdir -p "$references"
+		for capture in "$WORK/out/$name"/*.ppm; do
+			gzip -9 -n -c "$capture" > "$references/$(basename "$capture").gz"
+		done
+		echo "$name : $(ls "$references" | wc -l) références enregistrées"
+		continue
+	fi
+
+	for reference in "$references"/*.ppm.gz; do
+		[ -f "$reference" ] && gzip -d -c "$reference" > "$WORK/ref/$name/$(basename "$reference" .gz)"
+	done
+	if "$WORK/simu" -g 1 -s $NO_AUTO_CAPTURE -o "$WORK/out/$name" -c "$WORK/ref/$name" "$scenario" > "$WORK/$name.log" \
+			&& [ "$(ls "$WORK/out/$name" | wc -l)" -eq "$(ls "$WORK/ref/$name" | wc -l)" ]; then		# Aucune capture disparue
+		echo "$name : OK ($(ls "$WORK/out/$name" | wc -l) écrans)"
+	else
+		grep 'simu: .*\(diffèrent\|absente\)' "$WORK/$name.log"
+		echo "$name : $(ls "$WORK/out/$name" | wc -l) captures pour $(ls "$WORK/ref/$name" | wc -l) références"
+		echo "$name : ÉCHEC, captures dans $WORK/out/$name" >&2
+		status=1
+	fi
+done
+
+if [ $status -eq 0 ]; then
+	rm -rf "$WORK"
+fi
+exit $status
@@ -0,0 +1,414 @@
+/**
+ *******************************************************************************
+ * @file	simu.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC (Linux) du jeu : app/ et le BSP compilés pour le PC, écran ILI9341 virtuel,
+ * 			boutons rejoués depuis un script, captures d'écran et coût SPI de chaque écran
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -std=gnu11 -O2 -Wall -Itools/simu/stub -Itools/simu -Iapp -Idrivers/bsp -Dmain=jeu_main \
+ * 			-DFLASHLOG_READ=simu_flash_read_ecc -o simu \
+ * 			tools/simu/simu.c tools/simu/simu_hal.c tools/simu/simu_ili9341.c tools/simu/simu_flash.c \
+ * 			app/affichage.c app/argent.c app/banque_sd.c app/bouton.c app/ecrans.c app/ecrans_images.c \
+ * 			app/main.c app/question.c app/scores.c \
+ * 			drivers/bsp/stm32g4_scheduler.c drivers/bsp/stm32g4_swtimer.c drivers/bsp/stm32g4_button.c \
+ * 			drivers/bsp/stm32g4_flashlog.c \
+ * 			drivers/bsp/tft_ili9341/stm32g4_ili9341.c drivers/bsp/tft_ili9341/stm32g4_fonts.c \
+ * 			drivers/bsp/tft_ili9341/stm32g4_ili9341_anim.c
+ * Utilisation :
+ * 		simu [-o dossier] [-c dossier de référence] [-t ms] [-g graine] [-b rebonds] [-s octets] [-a ns] script
+ *
+ * 	-o : dossier des captures (défaut : .)
+ * 	-c : compare chaque capture à celle de même nom du dossier de référence ; code de retour 1 si une diffère
+ * 	-t : durée simulée (défaut : date de la commande fin, ou dernière date du script plus 2 s)
+ * 	-g : graine de BSP_RNG_get, donc du tirage des questions (défaut : 1)
+ * 	-b : rebonds simulés à chaque front d'un bouton (défaut : 0)
+ * 	-s : une capture automatique est faite quand au moins ce nombre d'octets de pixels a été envoyé depuis la
+ * 	     précédente et que l'écran est ensuite resté SIMU_QUIET_MS sans recevoir de pixel (défaut : 4096)
+ * 	-a : surcoût d'un appel au SPI du BSP, en ns (défaut : 300)
+ *
+ * Script : une commande par ligne, datée en ms depuis le démarrage, ou relativement à la ligne précédente (+ms).
+ * 		# Première question, 30 000 sur la trappe de droite
+ * 		1000 appui centre			enfonce puis relâche (100 ms, ou durée donnée en troisième argument)
+ * 		+7000 appui droit
+ * 		+300 enfonce haut			maintient (répétition du bouton)
+ * 		+1500 relache haut
+ * 		+50 capture placement		capture nommée placement.ppm
+ * 		+5000 fin
+ * 	Boutons : haut, droit, centre, gauche, bas (câblage de app/bouton.c).
+ *
+ * Le jeu tourne sur le temps virtuel de simu_hal.c : seuls les transferts SPI, HAL_Delay et les attentes
+ * du séquenceur le font avancer. Le temps de calcul de la cible n'est pas simulé, les durées affichées sont
+ * donc un minimum. Les captures sont au format PPM (P6) : « convert capture.ppm capture.png » pour un PNG.
+ * Pour chaque capture : octets envoyés à l'écran depuis la précédente (commandes, paramètres, pixels),
+ * transactions (CS) et durée SPI estimée sur la cible. Les messages du jeu (printf, DLOG) s'intercalent.
+ * Non-régression de chaque écran : tools/simu/regression.sh joue les scénarios de tools/simu/scenarios et compare
+ * leurs captures aux images de tools/simu/references (-c).
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "simu.h"
+
+#undef main							//-Dmain=jeu_main ne renomme que celle du jeu (app/main.c)
+
+#define SIMU_QUIET_MS			50		//Durée sans pixel après laquelle un écran est considéré comme dessiné
+#define SIMU_NAME_LEN			48
+
+typedef enum
+{
+	ACTION_PIN = 0,
+	ACTION_CAPTURE,
+	ACTION_END
+}action_e;
+
+typedef struct
+{
+	uint32_t date;
+	uint32_t order;					//Ordre dans le script, à date égale
+	uint8_t action;					//action_e
+	uint8_t button;
+	bool level;
+	char name[SIMU_NAME_LEN];
+}script_event_t;
+
+typedef struct
+{
+	const char * name;
+	uint8_t port;
+	uint16_t pin;
+}simu_button_t;
+
+static const simu_button_t buttons[] = {
+	{"haut",	0, GPIO_PIN_0},
+	{"droit",	0, GPIO_PIN_1},
+	{"centre",	1, GPIO_PIN_5},
+	{"gauche",	0, GPIO_PIN_9},
+	{"bas",		0, GPIO_PIN_10}};
+#define SIMU_BUTTONS_NB	(sizeof(buttons) / sizeof(buttons[0]))
+
+static script_event_t * events = NULL;
+static uint32_t events_nb = 0;
+static uint32_t events_max = 0;
+static uint32_t next_event = 0;
+static uint32_t end_date = 0;
+
+static const char * out_dir = ".";
+static const char * ref_dir = NULL;
+static uint32_t bounces = 0;
+static uint64_t auto_threshold = 4096;
+
+static simu_spi_stats_t last;					//Compteurs à la dernière capture
+static uint32_t last_capture_date = 0;
+static uint64_t pixels_seen = 0;				//Compteur de pixels à la dernière milliseconde
+static uint32_t last_pixel_date = 0;
+static uint32_t auto_captures = 0;
+static uint32_t captures = 0;
+static uint32_t mismatches = 0;
+static simu_spi_stats_t screen_max;				//Écran le plus coûteux
+static char screen_max_name[SIMU_NAME_LEN] = "";
+
+extern void jeu_main(void);
+
+/* Script ---------------------------------------------------------------------*/
+
+static void add_event(uint32_t date, action_e action, uint8_t button, bool level, const char * name)
+{
+	if(events_nb == events_max)
+	{
+		events_max = events_max ? 2 * events_max : 64;
+		events = realloc(events, events_max * sizeof(script_event_t));
+		if(events == NULL)
+		{
+			perror("realloc");
+			exit(EXIT_FAILURE);
+		}
+	}
+	events[events_nb] = (script_event_t){date, events_nb, (uint8_t)action, button, level, ""};
+	if(name)
+		snprintf(events[events_nb].name, SIMU_NAME_LEN, "%s", name);
+	events_nb++;
+}
+
+/**
+ * @brief Front d'un bouton, suivi de rebonds : le contact oscille une milliseconde sur deux avant de se stabiliser
+ */
+static void add_edge(uint32_t date, uint8_t button, bool level)
+{
+	for(uint32_t i = 0; i < bounces; i++)
+	{
+		add_event(date + 2 * i, ACTION_PIN, button, level, NULL);
+		add_event(date + 2 * i + 1, ACTION_PIN, button, !level, NULL);
+	}
+	add_event(date + 2 * bounces, ACTION_PIN, button, level, NULL);
+}
+
+static int find_button(const char * name)
+{
+	for(uint32_t b = 0; b < SIMU_BUTTONS_NB; b++)
+		if(strcmp(name, buttons[b].name) == 0)
+			return (int)b;
+	return -1;
+}
+
+static int compare_events(const void * a, const void * b)
+{
+	const script_event_t * ea = a;
+	const script_event_t * eb = b;
+
+	if(ea->date != eb->date)
+		return ea->date < eb->date ? -1 : 1;
+	return ea->order < eb->order ? -1 : (ea->order > eb->order);
+}
+
+static void load_script(const char * path)
+{
+	FILE * f = fopen(path, "r");
+	char line[256], date_s[16], command[16], arg[SIMU_NAME_LEN], arg2[16];
+	uint32_t date = 0, last_date = 0, line_nb = 0;
+	int fields, button;
+	bool has_end = false;
+
+	if(f == NULL)
+	{
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	while(fgets(line, sizeof(line), f))
+	{
+		line_nb++;
+		line[strcspn(line, "#\r\n")] = '\0';
+		fields = sscanf(line, "%15s %15s %47s %15s", date_s, command, arg, arg2);
+		if(fields <= 0)
+			continue;
+		date = (uint32_t)strtoul(date_s + (date_s[0] == '+'), NULL, 10) + (date_s[0] == '+' ? last_date : 0);
+		last_date = date;
+		button = fields >= 3 ? find_button(arg) : -1;
+
+		if(strcmp(command, "appui") == 0 && button >= 0)
+		{
+			add_edge(date, (uint8_t)button, false);
+			add_edge(date + (fields >= 4 ? (uint32_t)strtoul(arg2, NULL, 10) : 100), (uint8_t)button, true);
+		}
+		else if(strcmp(command, "enfonce") == 0 && button >= 0)
+			add_edge(date, (uint8_t)button, false);
+		else if(strcmp(command, "relache") == 0 && button >= 0)
+			add_edge(date, (uint8_t)button, true);
+		else if(strcmp(command, "capture") == 0 && fields >= 3)
+			add_event(date, ACTION_CAPTURE, 0, false, arg);
+		else if(strcmp(command, "fin") == 0)
+		{
+			add_event(date, ACTION_END, 0, false, NULL);
+			has_end = true;
+		}
+		else
+		{
+			fprintf(stderr, "%s:%u : commande inconnue ou bouton invalide\n", path, line_nb);
+			exit(EXIT_FAILURE);
+		}
+	}
+	fclose(f);
+	if(!has_end && end_date == 0)
+		add_event(last_date + 2000, ACTION_END, 0, false, NULL);
+	qsort(events, events_nb, sizeof(script_event_t), compare_events);
+}
+
+/* Captures -------------------------------------------------------------------*/
+
+static void write_ppm(const char * path)
+{
+	uint16_t w = simu_lcd_width(), h = simu_lcd_height();
+	FILE * f = fopen(path, "wb");
+	uint16_t color;
+
+	if(f == NULL)
+	{
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(f, "P6\n%u %u\n255\n", w, h);
+	for(uint16_t y = 0; y < h; y++)
+		for(uint16_t x = 0; x < w; x++)
+		{
+			color = simu_lcd_get_pixel(x, y);
+			fputc(((color >> 11) & 0x1F) * 255 / 31, f);
+			fputc(((color >> 5) & 0x3F) * 255 / 63, f);
+			fputc((color & 0x1F) * 255 / 31, f);
+		}
+	fclose(f);
+}
+
+/**
+ * @brief Nombre de pixels qui diffèrent entre deux fichiers PPM, -1 si la référence est absente ou de taille différente
+ */
+static long compare_ppm(const char * path, const char * ref_path)
+{
+	FILE * a = fopen(path, "rb");
+	FILE * b = fopen(ref_path, "rb");
+	unsigned wa, ha, wb, hb, ma, mb;
+	uint8_t pa[3], pb[3];
+	long diff = -1;
+
+	if(a && b && fscanf(a, "P6 %u %u %u", &wa, &ha, &ma) == 3 && fscanf(b, "P6 %u %u %u", &wb, &hb, &mb) == 3
+			&& wa == wb && ha == hb && fgetc(a) != EOF && fgetc(b) != EOF)
+	{
+		diff = 0;
+		for(unsigned long i = 0; i < (unsigned long)wa * ha; i++)
+		{
+			if(fread(pa, 3, 1, a) != 1 || fread(pb, 3, 1, b) != 1)
+			{
+				diff = -1;
+				break;
+			}
+			if(memcmp(pa, pb, 3))
+				diff++;
+		}
+	}
+	if(a)
+		fclose(a);
+	if(b)
+		fclose(b);
+	return diff;
+}
+
+static void capture(const char * name, uint32_t now)
+{
+	char path[512], ref_path[512];
+	simu_spi_stats_t s;
+	uint64_t bytes;
+	long diff;
+
+	simu_lcd_get_stats(&s);
+	snprintf(path, sizeof(path), "%s/%s.ppm", out_dir, name);
+	write_ppm(path);
+	captures++;
+
+	bytes = s.command_bytes + s.parameter_bytes + s.pixel_bytes - last.command_bytes - last.parameter_bytes - last.pixel_bytes;
+	printf("simu: %-16s %7u ms  %8llu octets (commandes %llu, paramètres %llu, pixels %llu)  %6u transactions  SPI %8.2f ms\n",
+			name, now, (unsigned long long)bytes,
+			(unsigned long long)(s.command_bytes - last.command_bytes),
+			(unsigned long long)(s.parameter_bytes - last.parameter_bytes),
+			(unsigned long long)(s.pixel_bytes - last.pixel_bytes),
+			s.transactions - last.transactions, (s.spi_ns - last.spi_ns) / 1e6);
+	if(s.spi_ns - last.spi_ns > screen_max.spi_ns)
+	{
+		screen_max = (simu_spi_stats_t){.spi_ns = s.spi_ns - last.spi_ns};
+		snprintf(screen_max_name, sizeof(screen_max_name), "%s", name);
+	}
+
+	if(ref_dir)
+	{
+		snprintf(ref_path, sizeof(ref_path), "%s/%s.ppm", ref_dir, name);
+		diff = compare_ppm(path, ref_path);
+		if(diff)
+		{
+			mismatches++;
+			if(diff < 0)
+				printf("simu: %s : référence %s absente ou de taille différente\n", name, ref_path);
+			else
+				printf("simu: %s : %ld pixels diffèrent de %s\n", name, diff, ref_path);
+		}
+	}
+	last = s;
+	last_capture_date = now;
+}
+
+static void finish(uint32_t now)
+{
+	simu_spi_stats_t s;
+
+	simu_lcd_get_stats(&s);
+	printf("simu: fin à %u ms : %u captures, %llu octets envoyés à l'écran en %u transactions, SPI %.1f ms (%.1f %% du temps)\n",
+			now, captures, (unsigned long long)(s.command_bytes + s.parameter_bytes + s.pixel_bytes), s.transactions,
+			s.spi_ns / 1e6, now ? s.spi_ns / 1e4 / now : 0.0);
+	if(screen_max_name[0])
+		printf("simu: écran le plus coûteux : %s (SPI %.2f ms)\n", screen_max_name, screen_max.spi_ns / 1e6);
+	if(ref_dir)
+		printf("simu: %u captures différentes de %s\n", mismatches, ref_dir);
+	exit(mismatches ? 1 : 0);
+}
+
+/**
+ * @brief Chaque milliseconde virtuelle : script, captures automatiques, fin de la simulation
+ */
+void simu_on_tick(uint32_t now)
+{
+	simu_spi_stats_t s;
+	char name[SIMU_NAME_LEN];
+	script_event_t * e;
+
+	simu_lcd_get_stats(&s);
+	if(s.pixel_bytes != pixels_seen)
+	{
+		pixels_seen = s.pixel_bytes;
+		last_pixel_date = now;
+	}
+	else if(s.pixel_bytes - last.pixel_bytes >= auto_threshold && now - last_pixel_date >= SIMU_QUIET_MS)
+	{
+		snprintf(name, sizeof(name), "ecran_%03u", ++auto_captures);
+		capture(name, now);
+	}
+
+	while(next_event < events_nb && events[next_event].date <= now)
+	{
+		e = &events[next_event++];
+		switch(e->action)
+		{
+			case ACTION_PIN:
+				simu_set_input(buttons[e->button].port, buttons[e->button].pin, e->level);
+				break;
+			case ACTION_CAPTURE:
+				capture(e->name, now);
+				break;
+			default:
+				if(end_date == 0)
+					finish(now);
+				break;
+		}
+	}
+	if(end_date && now >= end_date)
+		finish(now);
+}
+
+/* Programme ------------------------------------------------------------------*/
+
+static void usage(void)
+{
+	fprintf(stderr, "Utilisation : simu [-o dossier] [-c dossier de référence] [-t ms] [-g graine] [-b rebonds] [-s octets] [-a ns] script\n");
+	exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+	int i;
+
+	for(i = 1; i < argc - 1 && argv[i][0] == '-'; i += 2)
+	{
+		switch(argv[i][1])
+		{
+			case 'o': out_dir = argv[i + 1];								break;
+			case 'c': ref_dir = argv[i + 1];								break;
+			case 't': end_date = (uint32_t)strtoul(argv[i + 1], NULL, 10);	break;
+			case 'g': simu_set_rng_seed((uint32_t)strtoul(argv[i + 1], NULL, 0));	break;
+			case 'b': bounces = (uint32_t)strtoul(argv[i + 1], NULL, 10);	break;
+			case 's': auto_threshold = strtoull(argv[i + 1], NULL, 10);		break;
+			case 'a': simu_lcd_set_call_overhead((uint32_t)strtoul(argv[i + 1], NULL, 10));	break;
+			default: usage();
+		}
+	}
+	if(i != argc - 1)
+		usage();
+	if(mkdir(out_dir, 0755) && errno != EEXIST)
+	{
+		perror(out_dir);
+		return EXIT_FAILURE;
+	}
+	load_script(argv[i]);
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	jeu_main();						//Ne rend jamais la main : la simulation se termine dans simu_on_tick()
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,63 @@
+/**
+ *******************************************************************************
+ * @file	simu.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC : interfaces entre le temps virtuel et les périphériques simulés
+ *******************************************************************************
+ */
+
+#ifndef SIMU_H_
+#define SIMU_H_
+
+#include "stm32g4xx_hal.h"
+
+#define SIMU_CORE_MHZ			170		//Horloge du cœur et des bus (SYSTEM_CLOCK_MHZ)
+
+typedef struct
+{
+	uint64_t command_bytes;			//Octets envoyés avec D/C à 0
+	uint64_t parameter_bytes;		//Paramètres des commandes, hors pixels
+	uint64_t pixel_bytes;			//Données de la commande d'écriture en mémoire (0x2C)
+	uint64_t ignored_bytes;			//Octets envoyés avec CS à 1
+	uint32_t transactions;			//Fronts descendants de CS
+	uint64_t spi_ns;				//Durée estimée des transferts sur la cible
+}simu_spi_stats_t;
+
+typedef struct
+{
+	uint32_t programs;				//Doubles mots programmés
+	uint32_t erases;				//Pages effacées
+	uint32_t unlocks;				//Déverrouillages (HAL_FLASH_Unlock sur une flash verrouillée)
+	uint32_t errors;				//Opérations refusées (flash verrouillée, double mot non effacé...)
+	uint32_t power_cuts;
+	uint32_t ecc_errors;			//Lectures par simu_flash_read_ecc d'un double mot à l'ECC faux
+	uint64_t busy_ns;				//Durée cumulée des opérations sur la cible
+}simu_flash_stats_t;
+
+/* simu_hal.c : temps virtuel, GPIO, EXTI */
+void simu_advance_ns(uint64_t ns);
+void simu_next_tick(void);
+void simu_set_input(uint8_t port, uint16_t pin, bool level);
+void simu_set_rng_seed(uint32_t seed);
+
+/* simu_ili9341.c : SPI et contrôleur de l'écran */
+void simu_lcd_pin_changed(uint8_t port, uint16_t pin, bool level);
+void simu_lcd_set_call_overhead(uint32_t ns);
+void simu_lcd_get_stats(simu_spi_stats_t * stats);
+uint16_t simu_lcd_width(void);
+uint16_t simu_lcd_height(void);
+uint16_t simu_lcd_get_pixel(uint16_t x, uint16_t y);
+
+/* simu_flash.c : flash (effacement, programmation, coupures d'alimentation) */
+void simu_flash_reset(uint32_t seed);
+uint64_t simu_flash_read(uint32_t address);
+bool simu_flash_read_ecc(uint32_t address, uint64_t * value);
+void simu_flash_set_power_cut(uint32_t operations, void (*cut)(void));
+uint32_t simu_flash_get_erase_count(uint16_t page);
+void simu_flash_get_stats(simu_flash_stats_t * stats);
+
+/* simu.c : appelée à chaque milliseconde virtuelle, après l'IT SysTick */
+void simu_on_tick(uint32_t now);
+
+#endif /* SIMU_H_ */
@@ -0,0 +1,221 @@
+/**
+ *******************************************************************************
+ * @file	simu_flash.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC : flash du STM32G431 (64 pages de 2 ko), effacement par page, programmation
+ * 			par double mot, coupures d'alimentation
+ *******************************************************************************
+ */
+
+/*
+ * Comme sur la cible :
+ * 	- un effacement met tous les bits de la page à 1, une programmation ne peut que les mettre à 0 ;
+ * 	- on ne programme qu'un double mot (8 octets) aligné et effacé : sinon HAL_FLASH_Program échoue (PROGERR) ;
+ * 	- programmer ou effacer sans HAL_FLASH_Unlock échoue.
+ * Les durées sont celles de la fiche technique (valeurs typiques), cumulées dans simu_flash_stats_t.busy_ns :
+ * la cible ne peut pas exécuter de code en flash pendant ce temps.
+ *
+ * Coupure d'alimentation (simu_flash_set_power_cut) : l'opération en cours est laissée à moitié faite
+ * (une partie des bits à 0 d'un double mot programmé reste à 1, une partie des bits d'une page effacée reste à 0),
+ * puis la fonction donnée est appelée ; elle ne doit pas revenir (longjmp vers le redémarrage de l'outil).
+ * Le double mot ainsi laissé à moitié programmé ou effacé a un ECC faux : sur la cible, le lire lève une double erreur ECC,
+ * donc une NMI. Il reste dans cet état jusqu'au prochain effacement de sa page.
+ * 	- simu_flash_read est la lecture directe en mémoire : sur un tel double mot, elle arrête l'outil,
+ * 	  comme NMI_Handler qui boucle sans fin sur la cible ;
+ * 	- simu_flash_read_ecc est BSP_FLASH_read_ecc (stm32g4_flash.c) : elle rend false, et l'erreur est comptée.
+ * À substituer à la lecture de la cible : -DFLASHLOG_READ=simu_flash_read_ecc, -DKVSTORE_READ=simu_flash_read_ecc.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "simu.h"
+
+#define PAGES_NB			64
+#define SLOTS_NB			(FLASH_PAGE_SIZE / 8)
+#define ERASED				UINT64_MAX
+#define PROGRAM_NS			81690		//Double mot : 81,69 µs
+#define ERASE_NS			22020000	//Page : 22,02 ms
+
+static uint64_t cells[PAGES_NB][SLOTS_NB];		//Complément du contenu : une flash neuve (tout à 0 ici) est effacée
+static bool torn[PAGES_NB][SLOTS_NB];			//Opération interrompue sur ce double mot : ECC faux
+static uint32_t erase_counts[PAGES_NB];
+static simu_flash_stats_t stats;
+static bool unlocked = false;
+static uint32_t cut_countdown = 0;
+static void (*cut_fun)(void) = NULL;
+static uint64_t rng_state = 88172645463325252ULL;
+
+static uint64_t random64(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return rng_state;
+}
+
+/**
+ * @return true si la coupure d'alimentation programmée survient pendant cette opération
+ */
+static bool power_cut_now(void)
+{
+	return cut_countdown && --cut_countdown == 0;
+}
+
+static void power_cut(void)
+{
+	stats.power_cuts++;
+	unlocked = false;
+	if(cut_fun)
+		cut_fun();
+}
+
+/**
+ * @brief Flash entièrement effacée, usure et compteurs remis à zéro
+ */
+void simu_flash_reset(uint32_t seed)
+{
+	memset(cells, 0, sizeof(cells));
+	memset(torn, 0, sizeof(torn));
+	memset(erase_counts, 0, sizeof(erase_counts));
+	memset(&stats, 0, sizeof(stats));
+	unlocked = false;
+	rng_state = 88172645463325252ULL ^ seed;
+}
+
+static uint32_t cell_index(uint32_t address)
+{
+	uint32_t offset = address - FLASH_BASE;
+
+	if(address < FLASH_BASE || offset >= PAGES_NB * FLASH_PAGE_SIZE || offset % 8)
+	{
+		fprintf(stderr, "simu_flash : adresse 0x%08X hors de la flash ou non alignée\n", (unsigned)address);
+		exit(EXIT_FAILURE);
+	}
+	return offset / 8;
+}
+
+/**
+ * @brief Lecture directe d'un double mot : arrête l'outil sur un double mot à l'ECC faux (NMI non traitée sur la cible)
+ */
+uint64_t simu_flash_read(uint32_t address)
+{
+	uint32_t i = cell_index(address);
+
+	if(torn[i / SLOTS_NB][i % SLOTS_NB])
+	{
+		fprintf(stderr, "simu_flash_read : double erreur ECC à 0x%08X (opération interrompue), NMI non traitée : la cible reste bloquée\n",
+				(unsigned)address);
+		exit(EXIT_FAILURE);
+	}
+	return ~cells[i / SLOTS_NB][i % SLOTS_NB];
+}
+
+/**
+ * @brief Lecture d'un double mot comme BSP_FLASH_read_ecc
+ * @return false sur un double mot à l'ECC faux (opération interrompue) : value n'a alors pas de sens
+ */
+bool simu_flash_read_ecc(uint32_t address, uint64_t * value)
+{
+	uint32_t i = cell_index(address);
+
+	*value = ~cells[i / SLOTS_NB][i % SLOTS_NB];
+	if(torn[i / SLOTS_NB][i % SLOTS_NB])
+	{
+		stats.ecc_errors++;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief La prochaine coupure d'alimentation survient pendant la n-ième opération (programmation ou effacement) à venir
+ * @param operations : 0 pour ne pas couper
+ * @param cut : appelée après la coupure, ne doit pas revenir
+ */
+void simu_flash_set_power_cut(uint32_t operations, void (*cut)(void))
+{
+	cut_countdown = operations;
+	cut_fun = cut;
+}
+
+uint32_t simu_flash_get_erase_count(uint16_t page)
+{
+	return page < PAGES_NB ? erase_counts[page] : 0;
+}
+
+void simu_flash_get_stats(simu_flash_stats_t * s)
+{
+	*s = stats;
+}
+
+/* HAL ------------------------------------------------------------------------*/
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+	if(!unlocked)
+		stats.unlocks++;
+	unlocked = true;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+	unlocked = false;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+	uint32_t i = cell_index(Address);
+	uint64_t * cell = &cells[i / SLOTS_NB][i % SLOTS_NB];
+
+	if(TypeProgram != FLASH_TYPEPROGRAM_DOUBLEWORD || !unlocked || *cell != 0 || torn[i / SLOTS_NB][i % SLOTS_NB])
+	{
+		stats.errors++;
+		return HAL_ERROR;
+	}
+	stats.programs++;
+	stats.busy_ns += PROGRAM_NS;
+	if(power_cut_now())
+	{
+		*cell = ~(Data | random64());		//Une partie des bits à programmer reste à 1
+		torn[i / SLOTS_NB][i % SLOTS_NB] = true;
+		power_cut();
+		return HAL_ERROR;
+	}
+	*cell = ~Data;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef * pEraseInit, uint32_t * PageError)
+{
+	uint32_t page;
+
+	*PageError = 0xFFFFFFFF;
+	if(!unlocked || pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES || pEraseInit->Page + pEraseInit->NbPages > PAGES_NB)
+	{
+		stats.errors++;
+		return HAL_ERROR;
+	}
+	for(page = pEraseInit->Page; page < pEraseInit->Page + pEraseInit->NbPages; page++)
+	{
+		stats.erases++;
+		stats.busy_ns += ERASE_NS;
+		erase_counts[page]++;
+		if(power_cut_now())
+		{
+			for(uint16_t slot = 0; slot < SLOTS_NB; slot++)
+			{
+				cells[page][slot] &= random64();		//Une partie des bits reste à 0
+				torn[page][slot] = cells[page][slot] != 0;
+			}
+			*PageError = page;
+			power_cut();
+			return HAL_ERROR;
+		}
+		memset(cells[page], 0, sizeof(cells[page]));
+		memset(torn[page], 0, sizeof(torn[page]));
+	}
+	return HAL_OK;
+}
@@ -0,0 +1,199 @@
+/**
+ *******************************************************************************
+ * @file	simu_hal.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC : HAL, GPIO, EXTI, repos et RNG sur le temps virtuel
+ *******************************************************************************
+ */
+
+/*
+ * Le temps virtuel n'avance que lorsque la cible attendrait : transferts SPI (simu_ili9341.c),
+ * HAL_Delay, __WFI et BSP_IDLE_sleep. Le calcul lui-même ne coûte rien.
+ * Chaque milliseconde écoulée joue l'IT SysTick (HAL_IncTick puis BSP_SWTIMER_process_it, comme
+ * stm32g4_systick.c), puis le script de simu.c. Les IT sont donc appelées au milieu d'un dessin,
+ * comme sur la cible, mais jamais au milieu d'une instruction : il n'y a pas de concurrence.
+ */
+
+#include <stdlib.h>
+#include "simu.h"
+#include "stm32g4_gpio.h"
+#include "stm32g4_extit.h"
+#include "stm32g4_idle.h"
+#include "stm32g4_rng.h"
+#include "stm32g4_swtimer.h"
+
+GPIO_TypeDef simu_gpio_ports[SIMU_GPIO_PORTS_NB] = {{0}, {1}, {2}};
+SPI_TypeDef simu_spi[2] = {{0}, {1}};
+uint32_t simu_primask = 0;
+
+static uint32_t tick = 0;
+static uint64_t elapsed_ns = 0;					//Depuis la dernière milliseconde
+static uint16_t levels[SIMU_GPIO_PORTS_NB];		//Niveau des broches (sorties écrites, entrées imposées ou tirées)
+static uint16_t it_pins[SIMU_GPIO_PORTS_NB];	//Broches configurées en IT
+static callback_extit_t extit_callbacks[16];
+static volatile bool woken = false;				//Une IT externe réveille BSP_IDLE_sleep
+static uint32_t rng_state = 1;
+
+/* Temps virtuel --------------------------------------------------------------*/
+
+static void tick_elapsed(void)
+{
+	tick++;
+	BSP_SWTIMER_process_it();
+	simu_on_tick(tick);
+}
+
+/**
+ * @brief Fait avancer le temps virtuel ; chaque milliseconde franchie joue l'IT SysTick
+ */
+void simu_advance_ns(uint64_t ns)
+{
+	elapsed_ns += ns;
+	while(elapsed_ns >= 1000000)
+	{
+		elapsed_ns -= 1000000;
+		tick_elapsed();
+	}
+}
+
+/**
+ * @brief Attend la prochaine IT SysTick
+ */
+void simu_next_tick(void)
+{
+	elapsed_ns = 0;
+	tick_elapsed();
+}
+
+HAL_StatusTypeDef HAL_Init(void)
+{
+	return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return tick;
+}
+
+void HAL_Delay(uint32_t delay_ms)
+{
+	uint32_t start = tick;
+
+	delay_ms++;								//Comme la HAL : au moins delay_ms millisecondes entières
+	while(tick - start < delay_ms)
+		simu_next_tick();
+}
+
+void __WFI(void)
+{
+	simu_next_tick();
+}
+
+void NVIC_SystemReset(void)
+{
+	printf("simu: NVIC_SystemReset() à %u ms\n", tick);
+	exit(2);
+}
+
+/**
+ * @brief Même contrat que stm32g4_idle.c : réveil à l'échéance ou à la première IT externe
+ */
+void BSP_IDLE_init(void)
+{
+}
+
+void BSP_IDLE_sleep(uint32_t max_ms)
+{
+	uint32_t start = tick;
+
+	if(max_ms == 0)
+		return;
+	woken = false;
+	while(!woken && tick - start < max_ms)
+		simu_next_tick();
+}
+
+/* GPIO et EXTI ---------------------------------------------------------------*/
+
+void BSP_GPIO_pin_config(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin, uint32_t GPIO_Mode, uint32_t GPIO_Pull, uint32_t GPIO_Speed, uint32_t GPIO_Alternate)
+{
+	(void)GPIO_Speed;
+	(void)GPIO_Alternate;
+	if(GPIO_Mode & 0x10000000u)
+		it_pins[GPIOx->port] |= (uint16_t)GPIO_Pin;
+	else
+		it_pins[GPIOx->port] &= (uint16_t)~GPIO_Pin;
+	if(GPIO_Pull == GPIO_PULLUP)
+		levels[GPIOx->port] |= (uint16_t)GPIO_Pin;
+	else if(GPIO_Pull == GPIO_PULLDOWN)
+		levels[GPIOx->port] &= (uint16_t)~GPIO_Pin;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if(PinState == GPIO_PIN_SET)
+		levels[GPIOx->port] |= GPIO_Pin;
+	else
+		levels[GPIOx->port] &= (uint16_t)~GPIO_Pin;
+	simu_lcd_pin_changed(GPIOx->port, GPIO_Pin, PinState == GPIO_PIN_SET);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin)
+{
+	return (levels[GPIOx->port] & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin)
+{
+	HAL_GPIO_WritePin(GPIOx, GPIO_Pin, HAL_GPIO_ReadPin(GPIOx, GPIO_Pin) == GPIO_PIN_SET ? GPIO_PIN_RESET : GPIO_PIN_SET);
+}
+
+/**
+ * @brief Niveau imposé de l'extérieur sur une entrée (bouton) ; un front sur une broche en IT appelle le callback EXTI
+ */
+void simu_set_input(uint8_t port, uint16_t pin, bool level)
+{
+	bool before = (levels[port] & pin) != 0;
+	uint8_t pin_number = BSP_EXTIT_gpiopin_to_pin_number(pin);
+
+	if(level)
+		levels[port] |= pin;
+	else
+		levels[port] &= (uint16_t)~pin;
+	if(before != level && (it_pins[port] & pin) && extit_callbacks[pin_number])
+	{
+		woken = true;
+		extit_callbacks[pin_number](pin_number);
+	}
+}
+
+void BSP_EXTIT_set_callback(callback_extit_t fun, uint8_t pin_number, bool enable)
+{
+	if(pin_number < 16)
+		extit_callbacks[pin_number] = enable ? fun : NULL;
+}
+
+uint8_t BSP_EXTIT_gpiopin_to_pin_number(uint16_t GPIO_PIN_x)
+{
+	return GPIO_PIN_x ? (uint8_t)__builtin_ctz(GPIO_PIN_x) : 16;
+}
+
+/* RNG : reproductible d'une exécution à l'autre (graine -g) ------------------*/
+
+void simu_set_rng_seed(uint32_t seed)
+{
+	rng_state = seed ? seed : 1;
+}
+
+void BSP_RNG_init(void)
+{
+}
+
+uint32_t BSP_RNG_get(void)
+{
+	rng_state ^= rng_state << 13;			//xorshift32
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
@@ -0,0 +1,257 @@
+/**
+ *******************************************************************************
+ * @file	simu_ili9341.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC : bus SPI et contrôleur ILI9341 virtuels, mémoire d'image RGB565 240 x 320
+ *******************************************************************************
+ */
+
+/*
+ * Le pilote réel (stm32g4_ili9341.c) est compilé tel quel : le contrôleur virtuel ne voit que ce que verrait
+ * l'écran, les niveaux de CS et D/C (WRX) et les octets du SPI dans l'ordre où ils sortent (trames de 16 bits :
+ * poids fort en premier). Il décode les fenêtres (0x2A, 0x2B), l'orientation (0x36) et l'écriture en mémoire (0x2C).
+ * Les octets sont comptés par nature et leur durée sur la cible, 8 périodes d'horloge SPI chacun plus un surcoût
+ * par appel du BSP, fait avancer le temps virtuel.
+ */
+
+#include <string.h>
+#include "simu.h"
+#include "stm32g4_spi.h"
+#include "tft_ili9341/stm32g4_ili9341.h"
+
+#define PANEL_WIDTH				240		//Colonnes physiques
+#define PANEL_HEIGHT			320		//Lignes physiques
+#define MAC_MY					0x80
+#define MAC_MX					0x40
+#define MAC_MV					0x20
+
+typedef enum
+{
+	CMD_NONE = 0,
+	CMD_COLUMN_ADDR = 0x2A,
+	CMD_PAGE_ADDR = 0x2B,
+	CMD_GRAM = 0x2C,
+	CMD_MAC = 0x36
+}command_e;
+
+static uint16_t gram[PANEL_HEIGHT][PANEL_WIDTH];
+static bool cs_low = false;
+static bool dc_data = true;
+static uint8_t command = CMD_NONE;
+static uint8_t params[4];
+static uint32_t params_nb = 0;
+static uint8_t mac = 0;
+static uint16_t sc, ec, sp, ep;					//Fenêtre : colonnes et pages, dans le repère logique
+static uint16_t column, page;					//Prochain pixel écrit
+static uint8_t pixel_high;
+static uint32_t prescalers[2] = {2, 2};
+static bool frames_16bit[2];
+static uint32_t call_overhead_ns = 300;			//Appel du BSP et de la HAL, attente de fin de transfert
+static simu_spi_stats_t stats;
+
+/* Contrôleur -----------------------------------------------------------------*/
+
+static uint16_t logical_width(void)
+{
+	return (mac & MAC_MV) ? PANEL_HEIGHT : PANEL_WIDTH;
+}
+
+static uint16_t logical_height(void)
+{
+	return (mac & MAC_MV) ? PANEL_WIDTH : PANEL_HEIGHT;
+}
+
+/**
+ * @brief Pixel de la mémoire physique correspondant à une colonne et une page, selon l'orientation
+ */
+static uint16_t * gram_at(uint16_t x, uint16_t y)
+{
+	uint16_t c = (mac & MAC_MV) ? y : x;
+	uint16_t r = (mac & MAC_MV) ? x : y;
+
+	if(mac & MAC_MX)
+		c = PANEL_WIDTH - 1 - c;
+	if(mac & MAC_MY)
+		r = PANEL_HEIGHT - 1 - r;
+	return &gram[r][c];
+}
+
+static void write_pixel(uint16_t color)
+{
+	if(page > ep)
+		return;								//Au-delà de la fenêtre : ignoré
+	if(column < logical_width() && page < logical_height())
+		*gram_at(column, page) = color;
+	if(++column > ec)
+	{
+		column = sc;
+		page++;
+	}
+}
+
+static void receive_byte(uint8_t byte)
+{
+	if(!cs_low)
+	{
+		stats.ignored_bytes++;
+		return;
+	}
+	if(!dc_data)
+	{
+		stats.command_bytes++;
+		command = byte;
+		params_nb = 0;
+		if(command == CMD_GRAM)
+		{
+			column = sc;
+			page = sp;
+		}
+		return;
+	}
+	if(command == CMD_GRAM)
+	{
+		stats.pixel_bytes++;
+		if(params_nb++ & 1)
+			write_pixel((uint16_t)(pixel_high << 8 | byte));
+		else
+			pixel_high = byte;
+		return;
+	}
+	stats.parameter_bytes++;
+	if(params_nb < sizeof(params))
+		params[params_nb] = byte;
+	params_nb++;
+	if(command == CMD_COLUMN_ADDR && params_nb == 4)
+	{
+		sc = (uint16_t)(params[0] << 8 | params[1]);
+		ec = (uint16_t)(params[2] << 8 | params[3]);
+	}
+	else if(command == CMD_PAGE_ADDR && params_nb == 4)
+	{
+		sp = (uint16_t)(params[0] << 8 | params[1]);
+		ep = (uint16_t)(params[2] << 8 | params[3]);
+	}
+	else if(command == CMD_MAC && params_nb == 1)
+		mac = byte;
+}
+
+/**
+ * @brief Appelée à chaque écriture d'une broche : suit CS et D/C de l'écran
+ */
+void simu_lcd_pin_changed(uint8_t port, uint16_t pin, bool level)
+{
+	if(port == ILI9341_CS_PORT->port && pin == ILI9341_CS_PIN)
+	{
+		if(cs_low && !level)
+			return;
+		if(!level)
+			stats.transactions++;
+		cs_low = !level;
+	}
+	else if(port == ILI9341_WRX_PORT->port && pin == ILI9341_WRX_PIN)
+		dc_data = level;
+}
+
+uint16_t simu_lcd_width(void)
+{
+	return logical_width();
+}
+
+uint16_t simu_lcd_height(void)
+{
+	return logical_height();
+}
+
+/**
+ * @brief Pixel affiché, dans l'orientation courante
+ */
+uint16_t simu_lcd_get_pixel(uint16_t x, uint16_t y)
+{
+	return *gram_at(x, y);
+}
+
+void simu_lcd_set_call_overhead(uint32_t ns)
+{
+	call_overhead_ns = ns;
+}
+
+void simu_lcd_get_stats(simu_spi_stats_t * s)
+{
+	*s = stats;
+}
+
+/* SPI ------------------------------------------------------------------------*/
+
+/**
+ * @brief Durée de count octets sur la cible, écoulée sur le temps virtuel
+ */
+static void spi_elapse(SPI_TypeDef * SPIx, uint32_t count)
+{
+	uint64_t ns = call_overhead_ns + (uint64_t)count * 8 * prescalers[SPIx->id] * 1000 / SIMU_CORE_MHZ;
+
+	stats.spi_ns += ns;
+	simu_advance_ns(ns);
+}
+
+void BSP_SPI_Init(SPI_TypeDef* SPIx, SPI_Mode_e SPI_Mode, SPI_Rank_e SPI_Rank, uint16_t SPI_BAUDRATEPRESCALER_x)
+{
+	(void)SPI_Mode;
+	(void)SPI_Rank;
+	BSP_SPI_setBaudRate(SPIx, SPI_BAUDRATEPRESCALER_x);
+	frames_16bit[SPIx->id] = false;
+}
+
+void BSP_SPI_setBaudRate(SPI_TypeDef* SPIx, uint16_t SPI_BaudRatePrescaler)
+{
+	prescalers[SPIx->id] = 2U << (SPI_BaudRatePrescaler >> 3);
+}
+
+uint32_t BSP_SPI_getBaudrate(SPI_TypeDef* SPIx)
+{
+	return SIMU_CORE_MHZ * 1000000U / prescalers[SPIx->id];
+}
+
+void BSP_SPI_SetDataSize(SPI_TypeDef* SPIx, uint32_t DataSize)
+{
+	frames_16bit[SPIx->id] = (DataSize == SPI_DATASIZE_16BIT);
+}
+
+void BSP_SPI_WriteNoRegister(SPI_TypeDef* SPIx, uint8_t data)
+{
+	if(SPIx == SPI1)
+		receive_byte(data);
+	spi_elapse(SPIx, 1);
+}
+
+/**
+ * @brief En trames de 16 bits, count est un nombre de trames lues en mémoire (petit boutiste) et émises poids fort en premier
+ */
+void BSP_SPI_WriteMultiNoRegister(SPI_TypeDef* SPIx, uint8_t* data, uint16_t count)
+{
+	uint32_t bytes = frames_16bit[SPIx->id] ? 2U * count : count;
+
+	for(uint32_t i = 0; i < count && SPIx == SPI1; i++)
+	{
+		if(frames_16bit[SPIx->id])
+		{
+			receive_byte(data[2 * i + 1]);
+			receive_byte(data[2 * i]);
+		}
+		else
+			receive_byte(data[i]);
+	}
+	spi_elapse(SPIx, bytes);
+}
+
+void BSP_SPI_ReadMultiNoRegister(SPI_TypeDef* SPIx, uint8_t* data, uint16_t count)
+{
+	memset(data, 0, frames_16bit[SPIx->id] ? 2U * count : count);
+	spi_elapse(SPIx, frames_16bit[SPIx->id] ? 2U * count : count);
+}
+
+uint8_t BSP_SPI_ReadNoRegister(SPI_TypeDef* SPIx)
+{
+	spi_elapse(SPIx, 1);
+	return 0;
+}
@@ -0,0 +1,2 @@
+/* Simulateur PC : cf. stm32g4xx_hal.h */
+#include "stm32g4xx_hal.h"
@@ -0,0 +1,148 @@
+/**
+ *******************************************************************************
+ * @file	stm32g4xx_hal.h
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Simulateur PC : remplace la HAL et CMSIS. Seul ce qu'utilisent app/ et les modules
+ * 			du BSP compilés dans le simulateur est déclaré (cf. tools/simu/simu.c).
+ *******************************************************************************
+ */
+
+#ifndef SIMU_STM32G4XX_HAL_H_
+#define SIMU_STM32G4XX_HAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define STM32G431xx
+
+/* Types et constantes de la HAL ---------------------------------------------*/
+typedef enum
+{
+	HAL_OK = 0,
+	HAL_ERROR,
+	HAL_BUSY,
+	HAL_TIMEOUT
+}HAL_StatusTypeDef;
+
+typedef enum
+{
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+}GPIO_PinState;
+
+typedef enum
+{
+	RESET = 0,
+	SET = 1
+}FlagStatus;
+
+typedef struct
+{
+	uint8_t port;					//0 pour GPIOA, 1 pour GPIOB...
+}GPIO_TypeDef;
+
+typedef struct
+{
+	uint8_t id;
+}SPI_TypeDef;
+
+extern GPIO_TypeDef simu_gpio_ports[];
+extern SPI_TypeDef simu_spi[];
+
+#define GPIOA						(&simu_gpio_ports[0])
+#define GPIOB						(&simu_gpio_ports[1])
+#define GPIOC						(&simu_gpio_ports[2])
+#define SIMU_GPIO_PORTS_NB			3
+#define SPI1						(&simu_spi[0])
+#define SPI2						(&simu_spi[1])
+
+#define GPIO_PIN_0					((uint16_t)0x0001)
+#define GPIO_PIN_1					((uint16_t)0x0002)
+#define GPIO_PIN_2					((uint16_t)0x0004)
+#define GPIO_PIN_3					((uint16_t)0x0008)
+#define GPIO_PIN_4					((uint16_t)0x0010)
+#define GPIO_PIN_5					((uint16_t)0x0020)
+#define GPIO_PIN_6					((uint16_t)0x0040)
+#define GPIO_PIN_7					((uint16_t)0x0080)
+#define GPIO_PIN_8					((uint16_t)0x0100)
+#define GPIO_PIN_9					((uint16_t)0x0200)
+#define GPIO_PIN_10					((uint16_t)0x0400)
+#define GPIO_PIN_11					((uint16_t)0x0800)
+#define GPIO_PIN_12					((uint16_t)0x1000)
+#define GPIO_PIN_13					((uint16_t)0x2000)
+#define GPIO_PIN_14					((uint16_t)0x4000)
+#define GPIO_PIN_15					((uint16_t)0x8000)
+
+#define GPIO_MODE_INPUT				0x00000000u
+#define GPIO_MODE_OUTPUT_PP			0x00000001u
+#define GPIO_MODE_AF_PP				0x00000002u
+#define GPIO_MODE_ANALOG			0x00000003u
+#define GPIO_MODE_IT_RISING			0x10110000u
+#define GPIO_MODE_IT_FALLING		0x10210000u
+#define GPIO_MODE_IT_RISING_FALLING	0x10310000u
+#define GPIO_NOPULL					0x00000000u
+#define GPIO_PULLUP					0x00000001u
+#define GPIO_PULLDOWN				0x00000002u
+#define GPIO_SPEED_FREQ_LOW			0x00000000u
+#define GPIO_SPEED_FREQ_MEDIUM		0x00000001u
+#define GPIO_SPEED_FREQ_HIGH		0x00000002u
+#define GPIO_SPEED_FREQ_VERY_HIGH	0x00000003u
+
+#define SPI_BAUDRATEPRESCALER_2		0x00000000u
+#define SPI_BAUDRATEPRESCALER_4		0x00000008u
+#define SPI_BAUDRATEPRESCALER_8		0x00000010u
+#define SPI_BAUDRATEPRESCALER_16	0x00000018u
+#define SPI_BAUDRATEPRESCALER_32	0x00000020u
+#define SPI_BAUDRATEPRESCALER_64	0x00000028u
+#define SPI_BAUDRATEPRESCALER_128	0x00000030u
+#define SPI_BAUDRATEPRESCALER_256	0x00000038u
+#define SPI_DATASIZE_8BIT			0x00000700u
+#define SPI_DATASIZE_16BIT			0x00000F00u
+
+/* Flash : fonctions définies par l'outil qui simule la flash (tools/simu/simu_flash.c) ---*/
+#define FLASH_BASE					0x08000000UL
+#define FLASH_PAGE_SIZE				0x00000800U
+#define FLASH_TYPEPROGRAM_DOUBLEWORD	0x00000000U
+#define FLASH_TYPEERASE_PAGES		0x00000000U
+#define FLASH_BANK_1				0x00000001U
+
+typedef struct
+{
+	uint32_t TypeErase;
+	uint32_t Banks;
+	uint32_t Page;
+	uint32_t NbPages;
+}FLASH_EraseInitTypeDef;
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef * pEraseInit, uint32_t * PageError);
+uint64_t simu_flash_read(uint32_t address);		//Lecture directe de la flash simulée
+bool simu_flash_read_ecc(uint32_t address, uint64_t * value);	//Lecture comme BSP_FLASH_read_ecc (cf. FLASHLOG_READ, KVSTORE_READ)
+
+/* Cœur : les IT sont simulées par le simulateur lui-même (pas de concurrence) ------*/
+extern uint32_t simu_primask;
+#define __disable_irq()				(simu_primask = 1)
+#define __enable_irq()				(simu_primask = 0)
+#define __get_PRIMASK()				(simu_primask)
+#define __set_PRIMASK(p)			(simu_primask = (p))
+#define __DSB()						((void)0)
+#define __ISB()						((void)0)
+#define __DMB()						((void)0)
+#define __NOP()						((void)0)
+void __WFI(void);
+void NVIC_SystemReset(void);
+
+/* Fonctions de la HAL simulées (tools/simu/simu_hal.c) ----------------------*/
+HAL_StatusTypeDef HAL_Init(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t delay_ms);
+void HAL_GPIO_WritePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_TogglePin(GPIO_TypeDef * GPIOx, uint16_t GPIO_Pin);
+
+#endif /* SIMU_STM32G4XX_HAL_H_ */
@@ -0,0 +1,220 @@
+/**
+ *******************************************************************************
+ * @file	telemetry_decode.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Décodeur PC (Linux) des trames de télémétrie (cf. drivers/bsp/stm32g4_telemetry.c)
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -o telemetry_decode tools/telemetry_decode.c
+ * Utilisation :
+ * 		telemetry_decode capture.bin		(ou '-' pour lire l'entrée standard)
+ * 		stty -F /dev/ttyACM0 115200 raw && telemetry_decode - < /dev/ttyACM0
+ *
+ * Chaque trame se termine par un octet 0x00 ; son contenu est encodé en COBS.
+ * Après décodage : [canal][séquence][charge utile][CRC16 LSB][CRC16 MSB]
+ * Les trames dont le CRC est faux, ou dont la séquence saute, sont signalées.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TELEMETRY_MAX_PAYLOAD	250
+#define FRAME_MAX				(2 + TELEMETRY_MAX_PAYLOAD + 2)
+#define ENCODED_MAX				(FRAME_MAX + FRAME_MAX / 254 + 2)
+
+//Doit rester identique à telemetry_channel_t (drivers/bsp/stm32g4_telemetry.h)
+enum
+{
+	CHANNEL_RAW = 0,
+	CHANNEL_TEXT,
+	CHANNEL_LD19_FRAME,
+	CHANNEL_ADC_BLOCK,
+	CHANNEL_GAME_EVENT
+};
+
+#define LD19_POINTS			12
+#define LD19_FRAME_SIZE		(4 * 2 + LD19_POINTS * 3)
+#define GAME_EVENT_SIZE		10
+
+static uint64_t frames = 0;
+static uint64_t crc_errors = 0;
+static uint64_t format_errors = 0;
+static uint64_t lost_frames = 0;
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polynôme 0x1021, valeur initiale 0xFFFF), identique au calcul du périphérique CRC
+ */
+static uint16_t crc16(const uint8_t * p, size_t len)
+{
+	uint16_t crc = 0xFFFF;
+	while(len--)
+	{
+		crc ^= (uint16_t)(*p++ << 8);
+		for(int i = 0; i < 8; i++)
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+	}
+	return crc;
+}
+
+/**
+ * @brief Décode un bloc COBS (sans le délimiteur final)
+ * @return taille décodée, ou -1 si le bloc est mal formé
+ */
+static int cobs_decode(const uint8_t * in, size_t len, uint8_t * out, size_t out_size)
+{
+	size_t i = 0;
+	size_t n = 0;
+
+	while(i < len)
+	{
+		uint8_t code = in[i++];
+		if(code == 0 || i + code - 1 > len)
+			return -1;
+		for(uint8_t k = 1; k < code; k++)
+		{
+			if(n >= out_size)
+				return -1;
+			out[n++] = in[i++];
+		}
+		if(code != 0xFF && i < len)	//Un code inférieur à 0xFF remplace un zéro, sauf en fin de bloc
+		{
+			if(n >= out_size)
+				return -1;
+			out[n++] = 0;
+		}
+	}
+	return (int)n;
+}
+
+static uint16_t u16(const uint8_t * p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t u32(const uint8_t * p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void print_payload(uint8_t channel, const uint8_t * p, size_t len)
+{
+	switch(channel)
+	{
+		case CHANNEL_TEXT:
+			printf("text \"%.*s\"", (int)len, (const char *)p);
+			return;
+		case CHANNEL_LD19_FRAME:
+			if(len != LD19_FRAME_SIZE)
+				break;
+			printf("ld19 t=%u speed=%u angle=%u->%u |", u16(p), u16(p + 2), u16(p + 4), u16(p + 6));
+			for(int i = 0; i < LD19_POINTS; i++)
+				printf(" %u(%u)", u16(p + 8 + 3 * i), p[10 + 3 * i]);
+			return;
+		case CHANNEL_ADC_BLOCK:
+			if(len % 2)
+				break;
+			printf("adc");
+			for(size_t i = 0; i < len; i += 2)
+				printf(" %4u=%4umV", u16(p + i), (unsigned)(u16(p + i) * 3300u / 4096u));
+			return;
+		case CHANNEL_GAME_EVENT:
+			if(len != GAME_EVENT_SIZE)
+				break;
+			printf("game t=%ums event=%u state=%u value=%d", u32(p), p[4], p[5], (int32_t)u32(p + 6));
+			return;
+		default:
+			break;
+	}
+	if(channel != CHANNEL_RAW && channel < 0x80)
+		format_errors++;
+	printf("raw");
+	for(size_t i = 0; i < len; i++)
+		printf(" %02x", p[i]);
+}
+
+static void handle_frame(const uint8_t * encoded, size_t len)
+{
+	static int previous_seq = -1;
+	uint8_t frame[FRAME_MAX];
+	int n;
+
+	if(len == 0)	//Délimiteurs consécutifs : rien à décoder
+		return;
+	n = cobs_decode(encoded, len, frame, sizeof(frame));
+	if(n < 4)
+	{
+		printf("[trame mal formée (%zu octets)]\n", len);
+		format_errors++;
+		return;
+	}
+	if(crc16(frame, (size_t)n - 2) != u16(frame + n - 2))
+	{
+		printf("[CRC faux sur une trame de %d octets]\n", n);
+		crc_errors++;
+		return;
+	}
+	frames++;
+	if(previous_seq >= 0 && frame[1] != (uint8_t)(previous_seq + 1))
+	{
+		uint8_t gap = (uint8_t)(frame[1] - previous_seq - 1);
+		printf("[%u trame(s) perdue(s)]\n", gap);
+		lost_frames += gap;
+	}
+	previous_seq = frame[1];
+
+	printf("#%03u ch=%u ", frame[1], frame[0]);
+	print_payload(frame[0], frame + 2, (size_t)n - 4);
+	printf("\n");
+	fflush(stdout);
+}
+
+int main(int argc, char ** argv)
+{
+	FILE * in;
+	uint8_t encoded[ENCODED_MAX];
+	size_t len = 0;
+	uint64_t bytes = 0;
+	int overflow = 0;
+	int c;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "usage : %s capture.bin|-\n", argv[0]);
+		return 1;
+	}
+	in = strcmp(argv[1], "-") ? fopen(argv[1], "rb") : stdin;
+	if(!in)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	while((c = fgetc(in)) != EOF)
+	{
+		bytes++;
+		if(c == 0)
+		{
+			if(overflow)
+			{
+				printf("[trame trop longue ignorée]\n");
+				format_errors++;
+			}
+			else
+				handle_frame(encoded, len);
+			len = 0;
+			overflow = 0;
+		}
+		else if(len < sizeof(encoded))
+			encoded[len++] = (uint8_t)c;
+		else
+			overflow = 1;	//On attend le prochain délimiteur pour se resynchroniser
+	}
+
+	fprintf(stderr, "[telemetry : %llu octet(s), %llu trame(s), %llu perdue(s), %llu CRC faux, %llu mal formée(s)]\n",
+			(unsigned long long)bytes, (unsigned long long)frames, (unsigned long long)lost_frames,
+			(unsigned long long)crc_errors, (unsigned long long)format_errors);
+	return 0;
+}
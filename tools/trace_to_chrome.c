@@ -0,0 +1,234 @@
+/**
+ *******************************************************************************
+ * @file	trace_to_chrome.c
+ * @author	hugog
+ * @date	Oct 18, 2026
+ * @brief	Conversion PC (Linux) d'une trace écrite par BSP_TRACE_dump() (drivers/bsp/stm32g4_trace.c)
+ * 			au format JSON "Trace Event" de chrome://tracing et ui.perfetto.dev
+ *******************************************************************************
+ * Compilation :
+ * 		gcc -O2 -Wall -o trace_to_chrome tools/trace_to_chrome.c
+ * Utilisation :
+ * 		trace_to_chrome < capture_uart.txt > trace.json
+ * 		trace_to_chrome capture_uart.txt trace.json
+ *
+ * La capture peut contenir d'autres lignes (printf de l'application) : seul le dernier bloc TRACE ... END est lu.
+ * Les dates (cycles DWT, 32 bits) sont déroulées d'un évènement au suivant puis converties en µs.
+ * Une ligne par source : routines d'interruption, chaque périphérique SPI, chaque UART, chaque machine à états.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Identifiants de stm32g4_trace.h */
+#define TRACE_ISR_ENTER			1
+#define TRACE_ISR_EXIT			2
+#define TRACE_SPI_BEGIN			3
+#define TRACE_SPI_END			4
+#define TRACE_UART_RX_BEGIN		5
+#define TRACE_UART_RX_END		6
+#define TRACE_STATE				7
+
+#define LINE_MAX_LEN	256
+#define NAME_MAX_LEN	32
+#define SOURCES_MAX		64
+#define MACHINES_MAX	256
+
+/* Lignes (tid) du fichier JSON */
+#define TID_IRQ			1
+#define TID_SPI			10
+#define TID_UART		20
+#define TID_STATE		30
+#define TID_USER		300
+
+typedef struct
+{
+	uint32_t timestamp;
+	unsigned id;
+	unsigned arg;
+}event_t;
+
+static const char * spi_names[] = {"ILI9341", "XPT2046", "SD"};
+
+static char sources[SOURCES_MAX][NAME_MAX_LEN];
+static event_t * events = NULL;
+static int events_nb = 0;
+static unsigned mhz = 170;
+static int open_isr = 0;						//Profondeur d'imbrication des routines d'interruption
+static int state_open[MACHINES_MAX];			//Dernier état de chaque machine, -1 si aucun
+static FILE * out;
+static int first_output = 1;
+
+static void emit(const char * ph, double us, int tid, const char * name, const char * args)
+{
+	fprintf(out, "%s\n  {\"ph\":\"%s\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s\"%s%s%s}",
+			first_output ? "" : ",", ph, tid, us, name, args ? ",\"args\":{" : "", args ? args : "", args ? "}" : "");
+	first_output = 0;
+}
+
+static void thread_name(int tid, const char * name)
+{
+	char args[NAME_MAX_LEN + 16];
+
+	snprintf(args, sizeof(args), "\"name\":\"%s\"", name);
+	fprintf(out, "%s\n  {\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{%s}}", first_output ? "" : ",", tid, args);
+	first_output = 0;
+}
+
+static const char * source_name(unsigned id)
+{
+	static char unknown[NAME_MAX_LEN];
+
+	if(id < SOURCES_MAX && sources[id][0])
+		return sources[id];
+	snprintf(unknown, sizeof(unknown), "IRQ %u", id);
+	return unknown;
+}
+
+/**
+ * @brief Lit la capture et conserve le dernier bloc TRACE ... END complet
+ */
+static int load(FILE * in)
+{
+	char line[LINE_MAX_LEN];
+	char name[NAME_MAX_LEN];
+	unsigned long ts;
+	unsigned id, arg, nb;
+	int in_block = 0;
+	int complete = 0;
+	event_t * block = NULL;
+	int block_nb = 0;
+
+	while(fgets(line, sizeof(line), in))
+	{
+		if(sscanf(line, "TRACE %u %u", &mhz, &nb) == 2)
+		{
+			in_block = 1;
+			block_nb = 0;
+			memset(sources, 0, sizeof(sources));
+		}
+		else if(!in_block)
+			continue;
+		else if(sscanf(line, "SRC %u %31s", &id, name) == 2 && id < SOURCES_MAX)
+			snprintf(sources[id], NAME_MAX_LEN, "%s", name);
+		else if(sscanf(line, "E %lx %u %u", &ts, &id, &arg) == 3)
+		{
+			block = realloc(block, (block_nb + 1) * sizeof(event_t));
+			block[block_nb++] = (event_t){(uint32_t)ts, id, arg};
+		}
+		else if(!strncmp(line, "END", 3))
+		{
+			free(events);
+			events = block;
+			events_nb = block_nb;
+			block = NULL;
+			block_nb = 0;
+			in_block = 0;
+			complete = 1;
+		}
+	}
+	free(block);
+	return complete;
+}
+
+int main(int argc, char ** argv)
+{
+	FILE * in = stdin;
+	char name[NAME_MAX_LEN];
+	char args[64];
+	double us = 0;
+	uint32_t previous = 0;
+	unsigned machine;
+	int tid;
+
+	out = stdout;
+	if(argc > 1 && !(in = fopen(argv[1], "r")))
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	if(argc > 2 && !(out = fopen(argv[2], "w")))
+	{
+		perror(argv[2]);
+		return 1;
+	}
+	if(!load(in) || mhz == 0)
+	{
+		fprintf(stderr, "aucun bloc TRACE ... END complet dans la capture\n");
+		return 1;
+	}
+	for(int i = 0; i < MACHINES_MAX; i++)
+		state_open[i] = -1;
+
+	fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	thread_name(TID_IRQ, "Interruptions");
+	for(unsigned d = 0; d < sizeof(spi_names) / sizeof(spi_names[0]); d++)
+	{
+		snprintf(name, sizeof(name), "SPI %s", spi_names[d]);
+		thread_name(TID_SPI + d, name);
+	}
+
+	for(int i = 0; i < events_nb; i++)
+	{
+		event_t * e = &events[i];
+
+		if(i)
+			us += (double)(int32_t)(e->timestamp - previous) / mhz;	//Deltas signés : les rafales UART sont closes à leur dernier octet
+		previous = e->timestamp;
+		switch(e->id)
+		{
+			case TRACE_ISR_ENTER:
+				emit("B", us, TID_IRQ, source_name(e->arg), NULL);
+				open_isr++;
+				break;
+			case TRACE_ISR_EXIT:
+				if(open_isr == 0)
+					break;				//Entrée écrasée par le buffer circulaire
+				emit("E", us, TID_IRQ, source_name(e->arg), NULL);
+				open_isr--;
+				break;
+			case TRACE_SPI_BEGIN:
+			case TRACE_SPI_END:
+				if(e->arg >= sizeof(spi_names) / sizeof(spi_names[0]))
+					break;
+				emit((e->id == TRACE_SPI_BEGIN) ? "B" : "E", us, TID_SPI + e->arg, spi_names[e->arg], NULL);
+				break;
+			case TRACE_UART_RX_BEGIN:
+				snprintf(name, sizeof(name), "UART%u RX", (e->arg & 0x0F) + 1);
+				emit("B", us, TID_UART + (e->arg & 0x0F), name, NULL);
+				break;
+			case TRACE_UART_RX_END:
+				snprintf(name, sizeof(name), "UART%u RX", (e->arg & 0x0F) + 1);
+				snprintf(args, sizeof(args), "\"octets\":%u", e->arg >> 4);
+				emit("E", us, TID_UART + (e->arg & 0x0F), name, args);
+				break;
+			case TRACE_STATE:
+				machine = e->arg >> 8;
+				tid = TID_STATE + machine;
+				if(state_open[machine] >= 0)
+				{
+					snprintf(name, sizeof(name), "état %d", state_open[machine]);
+					emit("E", us, tid, name, NULL);
+				}
+				else
+				{
+					snprintf(name, sizeof(name), "Machine à états %u", machine);
+					thread_name(tid, name);
+				}
+				state_open[machine] = e->arg & 0xFF;
+				snprintf(name, sizeof(name), "état %d", state_open[machine]);
+				emit("B", us, tid, name, NULL);
+				break;
+			default:
+				snprintf(name, sizeof(name), "évènement %u", e->id);
+				snprintf(args, sizeof(args), "\"arg\":%u", e->arg);
+				emit("i", us, TID_USER, name, args);
+				break;
+		}
+	}
+	fprintf(out, "\n]}\n");
+	fprintf(stderr, "%d évènements, %.3f ms\n", events_nb, us / 1000);
+	return 0;
+}